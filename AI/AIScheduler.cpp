@@ -0,0 +1,112 @@
+#include "AIScheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // Urgency tiers: overdue enemies first, then stale plans, then the rest by wait / interval
+    constexpr float OVERDUE_BONUS = 2.0e6f;
+    constexpr float STALE_BONUS = 1.0e6f;
+    
+    // Non-negative floats order the same as their bit patterns
+    std::uint32_t orderedBits(float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+    
+    double microsecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+void AIScheduler::run(EnemyPool& enemies, EnemyNavigator& navigator, const SpatialGrid& grid, const sf::Vector2f& target)
+{
+    auto start = std::chrono::steady_clock::now();
+    navigator.prepare(enemies, grid, target);
+    
+    // Queue every grounded enemy that is due (or overdue, or stale). Airborne
+    // ones cannot act on a decision until they land, so only grounded ticks
+    // count as waiting
+    queue.clear();
+    for (std::size_t i = 0; i < enemies.size(); i++) 
+    {
+        if (!enemies.onGround[i] || enemies.state[i] == EnemyState::DEAD) 
+        {
+            continue;
+        }
+        
+        std::uint32_t wait = std::min(enemies.thinkWait[i], 0xFFFFFFFEu) + 1;
+        enemies.thinkWait[i] = wait;
+        float dx = enemies.positionX[i] - target.x;
+        float dy = enemies.positionY[i] - target.y;
+        float distance = std::sqrt(dx * dx + dy * dy);
+        float interval = std::min(1.0f + distance / distanceFalloff, float(maxWaitTicks));
+        bool stale = navigator.needsThink(enemies, i);
+        if (!stale && wait < interval) 
+        {
+            continue;
+        }
+        
+        float urgency = wait >= maxWaitTicks ? OVERDUE_BONUS + wait 
+                      : stale ? STALE_BONUS - distance / distanceFalloff 
+                      : wait / interval;
+        queue.push_back((std::uint64_t(orderedBits(std::max(urgency, 0.0f))) << 32) | ~std::uint32_t(i));
+    }
+    std::make_heap(queue.begin(), queue.end());
+    
+    // Most urgent first until the budget runs out; overdue enemies think regardless
+    std::size_t thinks = 0;
+    bool withinBudget = true;
+    while (!queue.empty()) 
+    {
+        std::pop_heap(queue.begin(), queue.end());
+        std::size_t index = ~std::uint32_t(queue.back());
+        queue.pop_back();
+        
+        std::uint32_t wait = enemies.thinkWait[index];
+        if (withinBudget) 
+        {
+            withinBudget = (maxThinksPerTick == 0 || thinks < maxThinksPerTick) &&
+                           (budgetMicroseconds <= 0.0f || microsecondsSince(start) < budgetMicroseconds);
+        }
+        if (!withinBudget) 
+        {
+            // Out of budget: only overdue enemies, which come first, still get to think
+            if (wait < maxWaitTicks) 
+            {
+                stats.deferred += queue.size() + 1;
+                break;
+            }
+            stats.overdueThinks++;
+        }
+        
+        navigator.think(enemies, index);
+        enemies.thinkWait[index] = 0;
+        stats.longestWait = std::max(stats.longestWait, wait);
+        thinks++;
+    }
+    
+    navigator.move(enemies);
+    
+    double elapsed = microsecondsSince(start);
+    stats.ticks++;
+    stats.thinks += thinks;
+    stats.microseconds += elapsed;
+    stats.worstTickMicroseconds = std::max(stats.worstTickMicroseconds, elapsed);
+    stats.lastTickMicroseconds = elapsed;
+}
+
+AISchedulerStats AIScheduler::getStats() const
+{
+    return stats;
+}
+
+void AIScheduler::resetStats()
+{
+    stats = AISchedulerStats();
+}
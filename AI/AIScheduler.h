@@ -0,0 +1,102 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Enemy/EnemyPool.h"
+#include "../Nav/EnemyNavigator.h"
+#include "../Physics/SpatialGrid.h"
+
+/**
+ * @struct AISchedulerStats
+ * @brief Decisions made and put off by an AIScheduler
+ * 
+ * Counts accumulate over run() calls until resetStats(); divide by ticks
+ * for per-tick figures.
+ */
+struct AISchedulerStats
+{
+    std::size_t ticks = 0;             ///< run() calls
+    std::size_t thinks = 0;            ///< EnemyNavigator::think() calls
+    std::size_t overdueThinks = 0;     ///< Thinks forced past the budget by maxWaitTicks
+    std::size_t deferred = 0;          ///< Enemies due to think that were left for a later tick
+    std::uint32_t longestWait = 0;     ///< Most grounded ticks an enemy went between thinks
+    double microseconds = 0.0;         ///< Time spent in run(), movement and graph rebuilds included
+    double worstTickMicroseconds = 0.0;
+    double lastTickMicroseconds = 0.0;
+};
+
+/**
+ * @class AIScheduler
+ * @brief Spreads enemy decisions over ticks under a per-tick time budget
+ * 
+ * Thinking (route lookups) is the expensive part of enemy AI; following a
+ * plan is not. Each tick, run() lets some enemies think and then moves
+ * every grounded enemy along its latest plan with EnemyNavigator::move().
+ * 
+ * Which enemies think is decided by urgency: the ticks an enemy has spent
+ * on the ground since it last thought (EnemyPool::thinkWait), divided by
+ * the interval it should think at. That interval grows with the distance
+ * to the target (one tick more per distanceFalloff pixels, up to
+ * maxWaitTicks), so enemies near the player react every tick or two while
+ * far ones think a few times a second. Enemies whose plan has gone stale
+ * (EnemyNavigator::needsThink(), e.g. they just landed on another span)
+ * come first, nearest first. Enemies think in urgency order until the
+ * budget is spent; the rest are deferred to a later tick.
+ * 
+ * Starvation guarantee: a grounded enemy that has waited maxWaitTicks
+ * thinks on that tick even if the budget is already spent. Size the
+ * budget so that enemies / maxWaitTicks thinks fit into it, or
+ * overdueThinks will show the overrun.
+ * 
+ * @note budgetMicroseconds is wall-clock time, so with it set which enemies
+ *       think depends on how fast the machine is, and two runs of the same
+ *       inputs can diverge. It is off by default: recordings, replays,
+ *       rollback and network play need identical results, and bound the
+ *       work with maxThinksPerTick, which is deterministic.
+ * 
+ * @example
+ * @code
+ * AIScheduler scheduler;
+ * scheduler.budgetMicroseconds = 1000.0f;  // Live play only (see the note)
+ * world.navigator = &navigator;
+ * world.aiScheduler = &scheduler;  // World::step() runs it instead of steer()
+ * @endcode
+ */
+class AIScheduler
+{
+public:
+    /**
+     * @brief Lets the most urgent enemies think, then moves all of them
+     * 
+     * @param enemies   Pool to steer
+     * @param navigator Makes the decisions and the moves
+     * @param grid      Platform broadphase the enemies collide with
+     * @param target    Point to chase: center X and feet Y (e.g. the player's)
+     */
+    void run(EnemyPool& enemies, EnemyNavigator& navigator, const SpatialGrid& grid, const sf::Vector2f& target);
+    
+    /** @brief Counters since the last resetStats() */
+    AISchedulerStats getStats() const;
+    
+    /** @brief Zeroes the counters */
+    void resetStats();
+    
+    /** @brief Wall-clock microseconds per tick for prepare() and thinking; 0 for no time limit */
+    float budgetMicroseconds = 0.0f;
+    
+    /** @brief Most thinks per tick (deterministic); 0 for no limit */
+    std::size_t maxThinksPerTick = 64;
+    
+    /** @brief No grounded enemy goes longer than this many ticks without thinking */
+    std::uint32_t maxWaitTicks = 60;
+    
+    /** @brief Pixels of distance to the target that add one tick to an enemy's think interval */
+    float distanceFalloff = 256.0f;
+    
+private:
+    /** @brief Candidates for this tick as (urgency bits << 32 | ~index), a max-heap */
+    std::vector<std::uint64_t> queue;
+    
+    AISchedulerStats stats;
+};
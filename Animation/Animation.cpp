@@ -1,50 +1,109 @@
 #include <SFML/Graphics.hpp>
 #include "Animation.h"
+#include "TextureCache.h"
+#include "../Profiling/Profiler.h"
 #include <string>
 #include <iostream>
 
 
 // In SFML 3.0, Sprite has no default constructor - it needs a texture.
 // We use std::optional to handle this, but the header declares sf::Sprite directly.
-// Solution: Initialize sprite in loadFromFile using placement or reassignment.
+// Solution: Initialize sprite in setClip using placement or reassignment.
 
-Animation::Animation() : frameCount(0), currentFrame(0), fps(5.0f), 
-                         frameTime(0.0f), isPlaying(true), loop(true),
-                         textureLoaded(false) {
+Animation::Animation() : currentFrame(0), fps(5.0f), 
+                         frameTime(0.0f), isPlaying(true), loop(true) {
     // Sprite cannot be initialized without a texture in SFML 3.0
-    // It will be created in loadFromFile
+    // It will be created in setClip
 }
 
-// Load texture and set up animation
+// Load (or reuse) the sheet through the shared cache and play it
 bool Animation::loadFromFile(const std::string& filename, 
                              const sf::Vector2u& frameSize, 
                              unsigned int frameCount,
                              float fps) 
 {
-    if (!texture.loadFromFile(filename)) 
+    ClipHandle loaded = TextureCache::global().getClip(filename, frameSize, frameCount, fps);
+    if (!loaded) 
     {
-        std::cout << "Failed to load texture from file: " << filename << std::endl;
         return false;
     }
     
-    this->frameSize = frameSize;
-    this->frameCount = frameCount;
-    this->fps = fps;
-    this->currentFrame = 0;
-    this->frameTime = 0.0f;
+    setClip(loaded);
+    return true;
+}
+
+// Switch to a shared clip and restart playback
+void Animation::setClip(ClipHandle newClip) 
+{
+    residency = nullptr;
+    applyClip(std::move(newClip));
+}
+
+// Remember a residency clip; play() loads it
+void Animation::bindLazy(ClipResidency& clipResidency, ClipResidency::ClipId id) 
+{
+    applyClip(nullptr);
+    residency = &clipResidency;
+    lazyClip = id;
+}
+
+// Let the residency evict the clip while it is not needed
+void Animation::release() 
+{
+    if (residency && clip) 
+    {
+        clip.reset();
+        sprite.reset();
+    }
+}
+
+void Animation::applyClip(ClipHandle newClip) 
+{
+    clip = std::move(newClip);
+    currentFrame = 0;
+    frameTime = 0.0f;
     
-    // Create sprite with the loaded texture
-    sprite.emplace(texture);
-    textureLoaded = true;
-    updateTextureRect();
+    if (!clip || !clip->texture) 
+    {
+        sprite.reset();
+        return;
+    }
     
-    return true;
+    fps = clip->fps;
+    
+    // Keep position/scale/origin if the sprite already exists
+    if (sprite.has_value()) 
+    {
+        sprite->setTexture(*clip->texture);
+    }
+    else 
+    {
+        sprite.emplace(*clip->texture);
+        sprite->setPosition(spritePosition);
+        sprite->setScale(spriteScale);
+        sprite->setOrigin(spriteOrigin);
+    }
+    updateTextureRect();
+}
+
+// Number of frames in the current clip
+unsigned int Animation::getFrameCount() const 
+{
+    return clip ? clip->frameCount() : 0;
+}
+
+// Frame currently displayed
+unsigned int Animation::getCurrentFrame() const 
+{
+    return currentFrame;
 }
 
 // Update animation based on delta time
 void Animation::update(float deltaTime) 
 {
-    if (!isPlaying || frameCount == 0 || !textureLoaded) return;
+    PROFILE_SCOPE("Animation::update");
+    unsigned int frameCount = getFrameCount();
+    if (!isPlaying || frameCount == 0) return;
     
     float timePerFrame = 1.0f / fps; // Calculate how long each frame should last
     frameTime += deltaTime; // Add the time that has passed since the last frame
@@ -57,7 +116,16 @@ void Animation::update(float deltaTime)
         
         if (currentFrame >= frameCount) 
         {
+            if (loop) 
+            {
                 currentFrame = 0;
+            }
+            else 
+            {
+                // One-shot clips (e.g. death) stop on their last frame
+                currentFrame = frameCount - 1;
+                isPlaying = false;
+            }
         }
         
         updateTextureRect();
@@ -67,7 +135,7 @@ void Animation::update(float deltaTime)
 // Set the current frame manually
 void Animation::setFrame(unsigned int frame) 
 {
-    if (frame < frameCount) 
+    if (frame < getFrameCount()) 
     {
         currentFrame = frame;
         updateTextureRect();
@@ -77,6 +145,10 @@ void Animation::setFrame(unsigned int frame)
 // Play the animation
 void Animation::play() 
 {
+    if (residency && !clip) 
+    {
+        applyClip(residency->acquire(lazyClip));
+    }
     isPlaying = true;
 }
 
@@ -106,6 +178,7 @@ void Animation::setfps(float speed)
 // Set position
 void Animation::setPosition(const sf::Vector2f& position) 
 {
+    spritePosition = position;
     if (sprite.has_value()) 
     {
         sprite->setPosition(position);
@@ -115,16 +188,13 @@ void Animation::setPosition(const sf::Vector2f& position)
 // Get position
 sf::Vector2f Animation::getPosition() const 
 {
-    if (sprite.has_value()) 
-    {
-        return sprite->getPosition();
-    }
-    return sf::Vector2f(0, 0);
+    return spritePosition;
 }
 
 // Set scale (useful for flipping horizontally)
 void Animation::setScale(const sf::Vector2f& scale) 
 {
+    spriteScale = scale;
     if (sprite.has_value()) 
     {
         sprite->setScale(scale);
@@ -134,6 +204,7 @@ void Animation::setScale(const sf::Vector2f& scale)
 // Set origin (for proper flipping/rotation)
 void Animation::setOrigin(const sf::Vector2f& origin) 
 {
+    spriteOrigin = origin;
     if (sprite.has_value()) 
     {
         sprite->setOrigin(origin);
@@ -150,26 +221,37 @@ const sf::Sprite& Animation::getSprite() const
     return sprite.value();
 }
 
+// Queue the current frame into a batch instead of drawing the sprite
+void Animation::emit(SpriteBatch& batch, int layer, sf::Color color) const 
+{
+    if (!sprite.has_value() || !clip || !clip->texture) 
+    {
+        return;
+    }
+    
+    batch.draw(*clip->texture, sprite->getTextureRect(), sprite->getPosition(), 
+               sprite->getOrigin(), sprite->getScale().x < 0.0f, color, layer);
+}
+
 // Update the texture rectangle to show the current frame
 void Animation::updateTextureRect() 
 {
-    if (!sprite.has_value()) return;
+    if (!sprite.has_value() || !clip) return;
     
-    unsigned int framesPerRow = texture.getSize().x / frameSize.x;
-    if (framesPerRow == 0) return;  // Guard against division by zero
+    unsigned int frameCount = clip->frameCount();
+    if (frameCount == 0) return;  // Guard against an empty clip
     
     // Clamp currentFrame to valid range to prevent blank/garbage frames
-    if (frameCount > 0 && currentFrame >= frameCount)
+    if (currentFrame >= frameCount)
      {
         currentFrame = frameCount - 1;
     }
     
-    unsigned int row = currentFrame / framesPerRow;
-    unsigned int col = currentFrame % framesPerRow;
+    sprite->setTextureRect(clip->frames[currentFrame]);
     
-    sf::IntRect rect;
-    rect.position = sf::Vector2i(col * frameSize.x, row * frameSize.y);
-    rect.size = sf::Vector2i(frameSize.x, frameSize.y);
-    
-    sprite->setTextureRect(rect);
+    // Trimmed atlas frames carry their own origin
+    if (currentFrame < clip->pivots.size()) 
+    {
+        sprite->setOrigin(clip->pivots[currentFrame]);
+    }
 }
\ No newline at end of file
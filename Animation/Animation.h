@@ -2,6 +2,9 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <optional>
+#include "AnimationClip.h"
+#include "ClipResidency.h"
+#include "../Render/SpriteBatch.h"
 
 /**
  * @class Animation
@@ -11,7 +14,13 @@
  * It supports variable frame rates, looping, and standard playback controls.
  * 
  * @note SFML 3.0 requires a texture at sprite construction, so the sprite
- *       is stored as std::optional and created when loadFromFile() is called.
+ *       is stored as std::optional and created when a clip is assigned.
+ * @note The texture and frame layout live in a shared AnimationClip. An
+ *       Animation only stores playback state, so many instances of the same
+ *       animation cost one texture in total.
+ * @note With bindLazy() the clip comes from a ClipResidency and is only
+ *       loaded on the first play(); position, scale and origin set before
+ *       that are kept and applied once the sprite exists.
  * 
  * @example
  * @code
@@ -45,11 +54,54 @@ public:
      * @return true if the texture was loaded successfully, false otherwise
      * 
      * @note Frames are read left-to-right, top-to-bottom from the sprite sheet
+     * @note The sheet is fetched through TextureCache::global(), so loading the
+     *       same file again reuses the already uploaded texture
      */
     bool loadFromFile(const std::string& filename, 
                       const sf::Vector2u& frameSize, 
                       unsigned int frameCount,
                       float fps = 10.0f);
+    
+    /**
+     * @brief Plays a shared clip, resetting playback to its first frame
+     * 
+     * @param newClip Clip to play (nullptr clears the animation)
+     */
+    void setClip(ClipHandle newClip);
+    
+    /**
+     * @brief Plays a residency clip, loading it on the first play()
+     * 
+     * Clears the current clip. play() acquires the clip (which pins it in
+     * the residency) and release() lets go of it again, so the residency may
+     * evict it while this animation is not showing.
+     * 
+     * @param residency Residency the clip is declared in (must outlive the binding)
+     * @param id        Clip to play
+     */
+    void bindLazy(ClipResidency& residency, ClipResidency::ClipId id);
+    
+    /**
+     * @brief Drops a lazily bound clip so the residency may evict it
+     * 
+     * The next play() acquires it again. Does nothing for clips assigned
+     * with setClip() or loadFromFile().
+     */
+    void release();
+    
+    /**
+     * @brief Gets the number of frames in the current clip
+     * 
+     * @return Frame count, or 0 if no clip is assigned
+     */
+    unsigned int getFrameCount() const;
+    
+    /**
+     * @brief Gets the frame currently displayed
+     * 
+     * @return 0-based frame index
+     */
+    unsigned int getCurrentFrame() const;
 
     /**
      * @brief Updates the animation based on elapsed time
@@ -64,12 +116,14 @@ public:
     /**
      * @brief Manually sets the current animation frame
      * 
-     * @param frame Frame index to display (0-based, must be < frameCount)
+     * @param frame Frame index to display (0-based, must be < getFrameCount())
      */
     void setFrame(unsigned int frame);
     
     /**
      * @brief Starts or resumes the animation playback
+     * 
+     * Acquires the clip first if it is lazily bound and not held yet.
      */
     void play();
 
@@ -86,6 +140,8 @@ public:
     /**
      * @brief Sets the animation playback speed
      * 
+     * Overrides the clip's default speed for this instance only.
+     * 
      * @param speed Frames per second (higher = faster animation)
      */
     void setfps(float speed);
@@ -101,7 +157,7 @@ public:
     /**
      * @brief Gets the current position of the animation sprite
      * 
-     * @return Current position, or (0,0) if texture not loaded
+     * @return Last position set (also before the texture is loaded)
      */
     sf::Vector2f getPosition() const;
 
@@ -129,29 +185,35 @@ public:
      * @brief Gets the underlying sprite for rendering
      * 
      * @return Reference to the internal sf::Sprite
-     * @warning Only call after loadFromFile() succeeds, otherwise undefined behavior
+     * @warning Only call after a clip is assigned, otherwise throws
      */
     const sf::Sprite& getSprite() const;
+    
+    /**
+     * @brief Queues the current frame into a sprite batch
+     * 
+     * Uses the sprite's position, origin and horizontal flip (negative X
+     * scale), so the result matches drawing getSprite() directly.
+     * 
+     * @param batch Batch to append to
+     * @param layer Draw layer passed to SpriteBatch::draw
+     * @param color Vertex color
+     */
+    void emit(SpriteBatch& batch, int layer = 0, sf::Color color = sf::Color::White) const;
 
     /// @name Public Members
     /// @{
     
-    /** @brief The sprite used for rendering (created after texture loads) */
+    /** @brief The sprite used for rendering (created when a clip is assigned) */
     std::optional<sf::Sprite> sprite;
     
-    /** @brief The loaded texture (sprite sheet) */
-    sf::Texture texture;    
-    
-    /** @brief Size of each frame in pixels (width, height) */
-    sf::Vector2u frameSize;
-    
-    /** @brief Total number of frames in the animation */
-    unsigned int frameCount;
+    /** @brief Shared texture and frame layout being played */
+    ClipHandle clip;
     
     /** @brief Current frame index (0-based) */
     unsigned int currentFrame;
     
-    /** @brief Animation speed in frames per second */
+    /** @brief Playback speed in frames per second (starts at the clip's fps) */
     float fps;
     
     /** @brief Time accumulator for frame switching */
@@ -163,16 +225,35 @@ public:
     /** @brief Whether the animation loops when it reaches the end */
     bool loop;
     
-    /** @brief Whether a texture has been successfully loaded */
-    bool textureLoaded;
-    
     /// @}
 
     /**
      * @brief Updates the texture rectangle to display the current frame
      * 
-     * Calculates the correct region of the sprite sheet based on
-     * currentFrame and frameSize, then applies it to the sprite.
+     * Looks up the clip's rectangle for currentFrame and applies it
+     * to the sprite.
      */
     void updateTextureRect();
+    
+private:
+    /** @brief setClip() without touching the lazy binding */
+    void applyClip(ClipHandle newClip);
+    
+    /** @brief Residency of a lazily bound clip (nullptr if not bound) */
+    ClipResidency* residency = nullptr;
+    
+    /** @brief Lazily bound clip */
+    ClipResidency::ClipId lazyClip = ClipResidency::NO_CLIP;
+    
+    /// @name Sprite Transform
+    /// Kept here too so a sprite created later, or again, starts out the same
+    /// @{
+    
+    sf::Vector2f spritePosition;
+    
+    sf::Vector2f spriteScale = sf::Vector2f(1.0f, 1.0f);
+    
+    sf::Vector2f spriteOrigin;
+    
+    /// @}
 };
@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct AnimationClip
+ * @brief Immutable, shareable description of one animation
+ * 
+ * A clip holds everything about an animation that does not change while it
+ * plays: the texture, the rectangle of every frame and the default speed.
+ * Clips are created by TextureCache and handed out as shared pointers, so
+ * any number of Animation instances can play the same clip while the
+ * texture is decoded and uploaded only once.
+ */
+struct AnimationClip
+{
+    /** @brief Texture the frames are cut from (shared with other clips) */
+    std::shared_ptr<const sf::Texture> texture;
+    
+    /** @brief Texture rectangle of each frame, in playback order */
+    std::vector<sf::IntRect> frames;
+    
+    /**
+     * @brief Per-frame sprite origin (optional, same length as frames)
+     * 
+     * Atlas frames are trimmed to their opaque pixels, so each one needs its
+     * own origin to stay centered on the untrimmed frame. Empty for plain
+     * sprite sheets, where the caller sets a single origin.
+     */
+    std::vector<sf::Vector2f> pivots;
+    
+    /** @brief Default playback speed in frames per second */
+    float fps = 10.0f;
+    
+    /** @brief Size of a frame in pixels (width, height) */
+    sf::Vector2u frameSize;
+    
+    /** @brief Total number of frames in the clip */
+    unsigned int frameCount() const { return static_cast<unsigned int>(frames.size()); }
+};
+
+/** @brief Shared, read-only reference to a clip */
+using ClipHandle = std::shared_ptr<const AnimationClip>;
@@ -0,0 +1,231 @@
+#include "ClipResidency.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+
+namespace
+{
+    // Same estimate as TextureCache::residentBytes()
+    std::size_t textureBytes(const sf::Texture& texture)
+    {
+        return static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+    }
+}
+
+ClipResidency::ClipResidency(std::size_t memoryBudget, TextureCache& cache)
+    : memoryBudget(memoryBudget),
+      cache(cache)
+{
+}
+
+ClipResidency::ClipId ClipResidency::declareSheet(const std::string& name, const std::string& path,
+                                                  const sf::Vector2u& frameSize, unsigned int frameCount, float fps)
+{
+    Entry entry;
+    entry.name = name;
+    entry.paths.push_back(path);
+    entry.frameSize = frameSize;
+    entry.frameCount = frameCount;
+    entry.fps = fps;
+    entry.sheet = true;
+    return declare(std::move(entry));
+}
+
+ClipResidency::ClipId ClipResidency::declareFrames(const std::string& name, const std::vector<std::string>& framePaths, float fps)
+{
+    Entry entry;
+    entry.name = name;
+    entry.paths = framePaths;
+    entry.frameCount = static_cast<unsigned int>(framePaths.size());
+    entry.fps = fps;
+    entry.sheet = false;
+    return declare(std::move(entry));
+}
+
+ClipResidency::ClipId ClipResidency::declare(Entry entry)
+{
+    auto found = names.find(entry.name);
+    if (found != names.end()) 
+    {
+        Entry& old = entries[found->second];
+        if (old.paths == entry.paths && old.frameSize == entry.frameSize && old.frameCount == entry.frameCount && 
+            old.fps == entry.fps && old.sheet == entry.sheet) 
+        {
+            return found->second; // Same source declared again (e.g. a second player)
+        }
+        counters.residentBytes -= old.bytes;
+        counters.residentClips -= old.clip ? 1 : 0;
+        old = std::move(entry);
+        return found->second;
+    }
+    
+    ClipId id = static_cast<ClipId>(entries.size());
+    names[entry.name] = id;
+    entries.push_back(std::move(entry));
+    counters.declaredClips++;
+    return id;
+}
+
+ClipResidency::ClipId ClipResidency::find(const std::string& name) const
+{
+    auto found = names.find(name);
+    return found != names.end() ? found->second : NO_CLIP;
+}
+
+ClipHandle ClipResidency::acquire(ClipId id)
+{
+    if (id >= entries.size()) 
+    {
+        return nullptr;
+    }
+    
+    Entry& entry = entries[id];
+    entry.lastUsed = ++useCounter;
+    if (entry.clip) 
+    {
+        counters.hits++;
+        return entry.clip;
+    }
+    
+    counters.misses++;
+    if (!load(entry)) 
+    {
+        return nullptr;
+    }
+    
+    // Hold our own reference while trimming so the new clip is not the victim
+    ClipHandle clip = entry.clip;
+    trim();
+    return clip;
+}
+
+bool ClipResidency::prefetch(ClipId id)
+{
+    if (id >= entries.size()) 
+    {
+        return false;
+    }
+    
+    Entry& entry = entries[id];
+    entry.lastUsed = ++useCounter;
+    if (entry.clip) 
+    {
+        return true;
+    }
+    if (!load(entry)) 
+    {
+        return false;
+    }
+    counters.prefetches++;
+    trim();
+    return entry.clip != nullptr;
+}
+
+bool ClipResidency::isResident(ClipId id) const
+{
+    return id < entries.size() && entries[id].clip != nullptr;
+}
+
+void ClipResidency::trim()
+{
+    while (counters.residentBytes > memoryBudget) 
+    {
+        // Least recently used clip that nobody outside the residency holds
+        Entry* victim = nullptr;
+        for (Entry& entry : entries) 
+        {
+            if (entry.clip && entry.clip.use_count() == 1 && (!victim || entry.lastUsed < victim->lastUsed)) 
+            {
+                victim = &entry;
+            }
+        }
+        if (!victim) 
+        {
+            break; // Everything left is in use; it stays even over budget
+        }
+        counters.residentBytes -= victim->bytes;
+        counters.residentClips--;
+        counters.evictions++;
+        victim->clip = nullptr;
+        victim->bytes = 0;
+    }
+}
+
+bool ClipResidency::load(Entry& entry)
+{
+    ClipHandle clip = entry.sheet ? cache.getClip(entry.paths.front(), entry.frameSize, entry.frameCount, entry.fps)
+                                  : loadFrames(entry);
+    if (!clip || !clip->texture) 
+    {
+        counters.loadFailures++;
+        return false;
+    }
+    
+    entry.clip = clip;
+    entry.bytes = textureBytes(*clip->texture);
+    counters.residentBytes += entry.bytes;
+    counters.residentClips++;
+    return true;
+}
+
+ClipHandle ClipResidency::loadFrames(const Entry& entry) const
+{
+    if (entry.paths.empty()) 
+    {
+        return nullptr;
+    }
+    
+    std::vector<sf::Image> images(entry.paths.size());
+    sf::Vector2u sheetSize(0, 0);
+    for (std::size_t i = 0; i < entry.paths.size(); i++) 
+    {
+        if (!images[i].loadFromFile(entry.paths[i])) 
+        {
+            std::cout << "Failed to load clip frame: " << entry.paths[i] << std::endl;
+            return nullptr;
+        }
+        sheetSize.x += images[i].getSize().x;
+        sheetSize.y = std::max(sheetSize.y, images[i].getSize().y);
+    }
+    // Frames side by side in one texture, so the clip is a single draw batch
+    sf::Image sheet(sheetSize, sf::Color::Transparent);
+    auto clip = std::make_shared<AnimationClip>();
+    clip->fps = entry.fps;
+    unsigned int x = 0;
+    for (const sf::Image& image : images) 
+    {
+        sf::Vector2u size = image.getSize();
+        if (!sheet.copy(image, sf::Vector2u(x, 0))) 
+        {
+            return nullptr;
+        }
+        clip->frames.push_back(sf::IntRect(sf::Vector2i(x, 0), sf::Vector2i(size)));
+        clip->pivots.push_back(sf::Vector2f(size.x / 2.0f, size.y / 2.0f));
+        clip->frameSize.x = std::max(clip->frameSize.x, size.x);
+        clip->frameSize.y = std::max(clip->frameSize.y, size.y);
+        x += size.x;
+    }
+    
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromImage(sheet)) 
+    {
+        std::cout << "Failed to create texture for clip: " << entry.name << std::endl;
+        return nullptr;
+    }
+    clip->texture = texture;
+    return clip;
+}
+
+ResidencyStats ClipResidency::getStats() const
+{
+    return counters;
+}
+
+void ClipResidency::resetStats()
+{
+    counters.hits = 0;
+    counters.misses = 0;
+    counters.prefetches = 0;
+    counters.evictions = 0;
+    counters.loadFailures = 0;
+}
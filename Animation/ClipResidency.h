@@ -0,0 +1,173 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AnimationClip.h"
+#include "TextureCache.h"
+
+/**
+ * @struct ResidencyStats
+ * @brief Memory use and hit/miss counters of a ClipResidency
+ */
+struct ResidencyStats
+{
+    std::size_t declaredClips = 0;  ///< Clips known to the residency
+    std::size_t residentClips = 0;  ///< Clips whose texture is in memory
+    std::size_t residentBytes = 0;  ///< Texture memory they hold (RGBA8)
+    std::size_t hits = 0;           ///< acquire() calls served from memory
+    std::size_t misses = 0;         ///< acquire() calls that had to load
+    std::size_t prefetches = 0;     ///< Clips loaded ahead of use by prefetch()
+    std::size_t evictions = 0;      ///< Clips dropped to meet the budget
+    std::size_t loadFailures = 0;   ///< Loads whose files could not be read
+};
+
+/**
+ * @class ClipResidency
+ * @brief Loads clips on first use and evicts idle ones under a memory cap
+ * 
+ * Clips are declared up front by name and source (a sprite sheet, or one
+ * image per frame), which costs no texture memory. A clip's texture is only
+ * loaded when it is first acquired, usually by Animation::play() or a
+ * renderer meeting the clip for the first time, or ahead of time through
+ * prefetch(), e.g. for the enemy families in a level's spawn table.
+ * 
+ * A clip is pinned while anyone other than the residency holds its handle.
+ * Whenever the resident clips exceed memoryBudget, unpinned clips are
+ * evicted, least recently acquired first; pinned clips stay even over
+ * budget. An evicted clip is simply loaded again on its next acquire().
+ * 
+ * @example
+ * @code
+ * ClipResidency residency(16u << 20);
+ * ClipResidency::ClipId run = residency.declareSheet("player/run", "assets/Player/RUN.png", {96, 84}, 8, 15.0f);
+ * 
+ * Animation animation;
+ * animation.bindLazy(residency, run);  // nothing loaded yet
+ * animation.play();                    // loads (miss) and starts playing
+ * @endcode
+ * 
+ * @note Not thread-safe; like TextureCache, use it from the rendering thread.
+ */
+class ClipResidency
+{
+public:
+    /** @brief Index of a declared clip */
+    using ClipId = std::uint32_t;
+    
+    /** @brief Returned by find() for unknown names */
+    static constexpr ClipId NO_CLIP = 0xFFFFFFFFu;
+    
+    /**
+     * @brief Creates an empty residency
+     * 
+     * @param memoryBudget Texture bytes to stay under (see memoryBudget)
+     * @param cache        Cache sprite sheets are loaded through, so a sheet
+     *                     also used elsewhere is not loaded twice
+     */
+    explicit ClipResidency(std::size_t memoryBudget = 64u << 20, TextureCache& cache = TextureCache::global());
+    
+    /**
+     * @brief Declares a clip cut from a sprite sheet (see TextureCache::getClip)
+     * 
+     * Declaring a name again with the same source returns the existing id;
+     * a different source replaces the old one and unloads its clip.
+     * 
+     * @return Id for acquire() and prefetch()
+     */
+    ClipId declareSheet(const std::string& name, const std::string& path,
+                        const sf::Vector2u& frameSize, unsigned int frameCount, float fps);
+    
+    /**
+     * @brief Declares a clip stored as one image file per frame
+     * 
+     * The frames are laid side by side in a single texture when the clip
+     * loads. Each frame gets a pivot at its center, like atlas frames.
+     * 
+     * @return Id for acquire() and prefetch()
+     */
+    ClipId declareFrames(const std::string& name, const std::vector<std::string>& framePaths, float fps);
+    
+    /**
+     * @brief Looks up a declared clip by name
+     * 
+     * @return Its id, or NO_CLIP
+     */
+    ClipId find(const std::string& name) const;
+    
+    /**
+     * @brief Gets a clip, loading it if it is not resident
+     * 
+     * Counts a hit or a miss and marks the clip as most recently used. The
+     * returned handle pins the clip until it is released.
+     * 
+     * @return The clip, or nullptr if the id is unknown or its files failed to load
+     */
+    ClipHandle acquire(ClipId id);
+    
+    /**
+     * @brief Loads a clip ahead of use without pinning it
+     * 
+     * Counts neither a hit nor a miss; the later acquire() is a hit unless
+     * the clip was evicted in between.
+     * 
+     * @return true if the clip is resident afterwards
+     */
+    bool prefetch(ClipId id);
+    
+    /** @brief Checks whether a clip's texture is in memory */
+    bool isResident(ClipId id) const;
+    
+    /**
+     * @brief Evicts unpinned clips until the resident set fits memoryBudget
+     * 
+     * Runs after every load; call it after lowering memoryBudget.
+     */
+    void trim();
+    
+    /** @brief Counters and current memory use (copy) */
+    ResidencyStats getStats() const;
+    
+    /** @brief Zeroes hits, misses, prefetches, evictions and load failures */
+    void resetStats();
+    
+    /** @brief Texture bytes the resident clips may use before eviction starts */
+    std::size_t memoryBudget;
+    
+private:
+    /** @brief One declared clip and its residency */
+    struct Entry
+    {
+        std::string name;
+        std::vector<std::string> paths;   ///< One sheet, or one file per frame
+        sf::Vector2u frameSize;           ///< Sheet slicing (sheets only)
+        unsigned int frameCount = 0;      ///< Sheet slicing (sheets only)
+        float fps = 10.0f;
+        bool sheet = true;
+        ClipHandle clip;                  ///< Set while resident
+        std::size_t bytes = 0;            ///< Texture memory while resident
+        std::uint64_t lastUsed = 0;       ///< useCounter at the latest acquire/prefetch
+    };
+    
+    /** @brief Adds or replaces a declaration */
+    ClipId declare(Entry entry);
+    
+    /** @brief Loads an entry's texture; false on failure */
+    bool load(Entry& entry);
+    
+    /** @brief Loads the frame images of a declareFrames() clip into one texture */
+    ClipHandle loadFrames(const Entry& entry) const;
+    
+    TextureCache& cache;
+    
+    std::vector<Entry> entries;
+    
+    std::unordered_map<std::string, ClipId> names;
+    
+    /** @brief Bumped on every acquire/prefetch to order entries by use */
+    std::uint64_t useCounter = 0;
+    
+    ResidencyStats counters;
+};
@@ -0,0 +1,136 @@
+#include "TextureAtlas.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace
+{
+    // One parsed "frame" record
+    struct FrameRecord
+    {
+        unsigned int index = 0;
+        unsigned int page = 0;
+        sf::IntRect rect;
+        sf::Vector2f pivot;
+    };
+}
+
+bool TextureAtlas::loadFromFile(const std::string& manifestPath, float fps, TextureCache& cache)
+{
+    std::ifstream file(manifestPath);
+    if (!file) 
+    {
+        std::cout << "Failed to open atlas manifest: " << manifestPath << std::endl;
+        return false;
+    }
+    
+    // Page files are stored next to the manifest
+    std::string directory;
+    std::size_t slash = manifestPath.find_last_of("/\\");
+    if (slash != std::string::npos) 
+    {
+        directory = manifestPath.substr(0, slash + 1);
+    }
+    
+    pages.clear();
+    clips.clear();
+    std::map<std::string, std::vector<FrameRecord>> records;
+    
+    std::string line;
+    while (std::getline(file, line)) 
+    {
+        std::istringstream in(line);
+        std::string kind;
+        if (!(in >> kind) || kind[0] == '#') 
+        {
+            continue;
+        }
+        
+        if (kind == "page") 
+        {
+            unsigned int index = 0;
+            std::string pageFile;
+            if (!(in >> index >> pageFile)) 
+            {
+                std::cout << "Malformed atlas record: " << line << std::endl;
+                return false;
+            }
+            
+            // AtlasPacker lists pages in order; anything else would leave holes
+            if (index != pages.size() || index >= MAX_PAGES) 
+            {
+                std::cout << "Atlas page " << index << " out of order or beyond " << MAX_PAGES 
+                          << " pages: " << manifestPath << std::endl;
+                return false;
+            }
+            
+            std::shared_ptr<const sf::Texture> texture = cache.getTexture(directory + pageFile);
+            if (!texture) 
+            {
+                return false;
+            }
+            pages.push_back(texture);
+        }
+        else if (kind == "frame") 
+        {
+            std::string clipName;
+            FrameRecord record;
+            int x, y, w, h;
+            float offsetX, offsetY, sourceW, sourceH;
+            if (!(in >> clipName >> record.index >> record.page >> x >> y >> w >> h 
+                     >> offsetX >> offsetY >> sourceW >> sourceH)) 
+            {
+                std::cout << "Malformed atlas record: " << line << std::endl;
+                return false;
+            }
+            record.rect = sf::IntRect(sf::Vector2i(x, y), sf::Vector2i(w, h));
+            
+            // Origin that puts the untrimmed frame's center on the sprite position
+            record.pivot = sf::Vector2f(sourceW / 2.0f - offsetX, sourceH / 2.0f - offsetY);
+            records[clipName].push_back(record);
+        }
+    }
+    
+    for (auto& entry : records) 
+    {
+        std::vector<FrameRecord>& frames = entry.second;
+        std::sort(frames.begin(), frames.end(), 
+                  [](const FrameRecord& a, const FrameRecord& b) { return a.index < b.index; });
+        
+        unsigned int page = frames.front().page;
+        if (page >= pages.size() || !pages[page]) 
+        {
+            std::cout << "Atlas clip " << entry.first << " references missing page " << page << std::endl;
+            return false;
+        }
+        
+        auto clip = std::make_shared<AnimationClip>();
+        clip->texture = pages[page];
+        clip->fps = fps;
+        clip->frames.reserve(frames.size());
+        clip->pivots.reserve(frames.size());
+        for (const FrameRecord& frame : frames) 
+        {
+            clip->frames.push_back(frame.rect);
+            clip->pivots.push_back(frame.pivot);
+            clip->frameSize.x = std::max(clip->frameSize.x, static_cast<unsigned int>(frame.rect.size.x));
+            clip->frameSize.y = std::max(clip->frameSize.y, static_cast<unsigned int>(frame.rect.size.y));
+        }
+        clips[entry.first] = clip;
+    }
+    
+    return true;
+}
+
+ClipHandle TextureAtlas::getClip(const std::string& name) const
+{
+    auto found = clips.find(name);
+    return found != clips.end() ? found->second : nullptr;
+}
+
+std::size_t TextureAtlas::pageCount() const
+{
+    return pages.size();
+}
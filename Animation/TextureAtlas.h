@@ -0,0 +1,78 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AnimationClip.h"
+#include "TextureCache.h"
+
+/**
+ * @class TextureAtlas
+ * @brief Runtime loader for atlases produced by Tools/AtlasPacker
+ * 
+ * The packer turns the per-frame PNGs under assets/Enemies into a few large
+ * pages plus a text manifest. This class reads the manifest, fetches the
+ * pages through TextureCache and builds one AnimationClip per animation
+ * (e.g. "dragon/Walk") whose frames point straight into the page.
+ * 
+ * Manifest format (one record per line, '#' starts a comment):
+ * @code
+ * page  <index> <file>
+ * frame <clip> <frame> <page> <x> <y> <w> <h> <offsetX> <offsetY> <sourceW> <sourceH>
+ * @endcode
+ * Page files are relative to the manifest. (x, y, w, h) is the trimmed frame
+ * inside the page; (offsetX, offsetY) is where the trimmed rectangle sat in
+ * the original (sourceW x sourceH) frame, used to compute per-frame pivots.
+ * 
+ * @note All frames of one clip must live on the same page; the packer
+ *       guarantees this.
+ * 
+ * @example
+ * @code
+ * TextureAtlas atlas;
+ * atlas.loadFromFile("assets/Enemies/atlas.txt");
+ * 
+ * Animation walk;
+ * walk.setClip(atlas.getClip("dragon/Walk"));
+ * @endcode
+ */
+class TextureAtlas
+{
+public:
+    /** @brief Most pages a manifest may list; AtlasPacker refuses to write more */
+    static constexpr std::size_t MAX_PAGES = 64;
+    
+    /**
+     * @brief Loads a manifest and all of its pages
+     * 
+     * @param manifestPath Path to the manifest written by AtlasPacker
+     * @param fps          Default playback speed given to every clip
+     * @param cache        Cache used to load (and share) the page textures
+     * @return true if the manifest and every page loaded successfully; false
+     *         also if pages are not listed as 0, 1, 2, ... in order or there
+     *         are more than MAX_PAGES of them
+     */
+    bool loadFromFile(const std::string& manifestPath, 
+                      float fps = 10.0f, 
+                      TextureCache& cache = TextureCache::global());
+    
+    /**
+     * @brief Gets a clip by name
+     * 
+     * @param name Clip name as "<family>/<animation>", e.g. "jinn_animation/Magic_Attack"
+     * @return Shared clip, or nullptr if the atlas has no such clip
+     */
+    ClipHandle getClip(const std::string& name) const;
+    
+    /**
+     * @brief Number of page textures the atlas uses
+     */
+    std::size_t pageCount() const;
+    
+private:
+    /** @brief Page textures, indexed by page number */
+    std::vector<std::shared_ptr<const sf::Texture>> pages;
+    
+    /** @brief Clip name -> clip */
+    std::unordered_map<std::string, ClipHandle> clips;
+};
@@ -0,0 +1,131 @@
+#include "TextureCache.h"
+#include <iostream>
+
+TextureCache& TextureCache::global()
+{
+    static TextureCache cache;
+    return cache;
+}
+
+std::shared_ptr<const sf::Texture> TextureCache::getTexture(const std::string& path)
+{
+    auto found = textures.find(path);
+    if (found != textures.end()) 
+    {
+        if (std::shared_ptr<const sf::Texture> texture = found->second.lock()) 
+        {
+            cacheHits++;
+            return texture;
+        }
+    }
+    
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromFile(path)) 
+    {
+        std::cout << "Failed to load texture from file: " << path << std::endl;
+        return nullptr;
+    }
+    
+    textureLoads++;
+    textures[path] = texture;
+    return texture;
+}
+
+std::shared_ptr<const sf::Texture> TextureCache::find(const std::string& path) const
+{
+    auto found = textures.find(path);
+    return found != textures.end() ? found->second.lock() : nullptr;
+}
+
+void TextureCache::adopt(const std::string& path, std::shared_ptr<const sf::Texture> texture)
+{
+    textureLoads++;
+    textures[path] = texture;
+}
+
+ClipHandle TextureCache::getClip(const std::string& path, 
+                                 const sf::Vector2u& frameSize, 
+                                 unsigned int frameCount, 
+                                 float fps)
+{
+    std::string key = path + "|" + std::to_string(frameSize.x) + "x" + std::to_string(frameSize.y) + 
+                      "|" + std::to_string(frameCount) + "|" + std::to_string(fps);
+    
+    auto found = clips.find(key);
+    if (found != clips.end()) 
+    {
+        if (ClipHandle clip = found->second.lock()) 
+        {
+            cacheHits++;
+            return clip;
+        }
+    }
+    
+    std::shared_ptr<const sf::Texture> texture = getTexture(path);
+    if (!texture) 
+    {
+        return nullptr;
+    }
+    
+    auto clip = std::make_shared<AnimationClip>();
+    clip->texture = texture;
+    clip->fps = fps;
+    clip->frameSize = frameSize;
+    
+    // Slice frames left-to-right, top-to-bottom
+    unsigned int framesPerRow = frameSize.x > 0 ? texture->getSize().x / frameSize.x : 0;
+    if (framesPerRow > 0) 
+    {
+        clip->frames.reserve(frameCount);
+        for (unsigned int i = 0; i < frameCount; i++) 
+        {
+            unsigned int row = i / framesPerRow;
+            unsigned int col = i % framesPerRow;
+            clip->frames.push_back(sf::IntRect(
+                sf::Vector2i(col * frameSize.x, row * frameSize.y),
+                sf::Vector2i(frameSize.x, frameSize.y)
+            ));
+        }
+    }
+    
+    clips[key] = clip;
+    return clip;
+}
+
+void TextureCache::purge()
+{
+    for (auto it = textures.begin(); it != textures.end(); ) 
+    {
+        it = it->second.expired() ? textures.erase(it) : std::next(it);
+    }
+    for (auto it = clips.begin(); it != clips.end(); ) 
+    {
+        it = it->second.expired() ? clips.erase(it) : std::next(it);
+    }
+}
+
+std::size_t TextureCache::residentTextures() const
+{
+    std::size_t count = 0;
+    for (const auto& entry : textures) 
+    {
+        if (!entry.second.expired()) 
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+std::size_t TextureCache::residentBytes() const
+{
+    std::size_t bytes = 0;
+    for (const auto& entry : textures) 
+    {
+        if (std::shared_ptr<const sf::Texture> texture = entry.second.lock()) 
+        {
+            bytes += static_cast<std::size_t>(texture->getSize().x) * texture->getSize().y * 4;
+        }
+    }
+    return bytes;
+}
@@ -0,0 +1,114 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "AnimationClip.h"
+
+/**
+ * @class TextureCache
+ * @brief Loads each texture and clip once and shares it by reference count
+ * 
+ * Textures and clips are keyed by file path (plus slicing parameters for
+ * clips). The cache itself only keeps weak references: a texture stays in
+ * memory while at least one clip or caller holds its shared pointer and is
+ * freed as soon as the last one lets go. Loading the same sheet for 500
+ * enemies therefore decodes and uploads the PNG a single time.
+ * 
+ * @example
+ * @code
+ * ClipHandle walk = TextureCache::global().getClip("assets/Player/WALK.png", {96, 84}, 7, 12.0f);
+ * 
+ * Animation a, b;
+ * a.setClip(walk);  // both animations share one texture
+ * b.setClip(walk);
+ * @endcode
+ * 
+ * @note Not thread-safe. Use it from the main (rendering) thread only;
+ *       AssetLoader decodes on workers and adopts textures on the main thread.
+ */
+class TextureCache
+{
+public:
+    /**
+     * @brief Gets the process-wide cache used by Animation::loadFromFile
+     */
+    static TextureCache& global();
+    
+    /**
+     * @brief Gets a texture, loading it on first use
+     * 
+     * @param path Path to the image file
+     * @return Shared texture, or nullptr if the file could not be loaded
+     */
+    std::shared_ptr<const sf::Texture> getTexture(const std::string& path);
+    
+    /**
+     * @brief Looks up a texture without loading it
+     * 
+     * @param path Path to the image file
+     * @return Shared texture, or nullptr if it is not currently loaded
+     */
+    std::shared_ptr<const sf::Texture> find(const std::string& path) const;
+    
+    /**
+     * @brief Registers a texture that was loaded elsewhere (e.g. by AssetLoader)
+     * 
+     * Later getTexture()/getClip() calls for the same path return it. The
+     * cache still only holds a weak reference.
+     * 
+     * @param path    Path the texture was loaded from
+     * @param texture Loaded texture
+     */
+    void adopt(const std::string& path, std::shared_ptr<const sf::Texture> texture);
+    
+    /**
+     * @brief Gets a clip sliced from a horizontal/grid sprite sheet
+     * 
+     * Frames are read left-to-right, top-to-bottom, like Animation always did.
+     * 
+     * @param path       Path to the sprite sheet image file
+     * @param frameSize  Size of each frame in pixels
+     * @param frameCount Number of frames in the clip
+     * @param fps        Default playback speed in frames per second
+     * @return Shared clip, or nullptr if the texture could not be loaded
+     */
+    ClipHandle getClip(const std::string& path, 
+                       const sf::Vector2u& frameSize, 
+                       unsigned int frameCount, 
+                       float fps);
+    
+    /**
+     * @brief Drops bookkeeping for textures and clips nobody references
+     */
+    void purge();
+    
+    /**
+     * @brief Number of textures currently alive
+     */
+    std::size_t residentTextures() const;
+    
+    /**
+     * @brief Approximate GPU memory of all live textures (RGBA8)
+     */
+    std::size_t residentBytes() const;
+    
+    /// @name Statistics
+    /// @{
+    
+    /** @brief Number of textures decoded from disk */
+    unsigned int textureLoads = 0;
+    
+    /** @brief Number of getTexture/getClip calls served from the cache */
+    unsigned int cacheHits = 0;
+    
+    /// @}
+    
+private:
+    /** @brief Path -> weakly held texture */
+    std::unordered_map<std::string, std::weak_ptr<const sf::Texture>> textures;
+    
+    /** @brief Path + slicing parameters -> weakly held clip */
+    std::unordered_map<std::string, std::weak_ptr<const AnimationClip>> clips;
+};
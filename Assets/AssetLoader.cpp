@@ -0,0 +1,147 @@
+#include "AssetLoader.h"
+#include <algorithm>
+#include <iostream>
+
+AssetLoader::AssetLoader(unsigned int workerCount, TextureCache& cache)
+    : cache(cache)
+{
+    if (workerCount == 0) 
+    {
+        // Leave one core for the main thread, which keeps rendering
+        unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;
+    }
+    
+    for (unsigned int i = 0; i < workerCount; i++) 
+    {
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+    }
+}
+
+AssetLoader::~AssetLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorkers.notify_all();
+    for (std::thread& worker : workers) 
+    {
+        worker.join();
+    }
+}
+
+TextureFuture AssetLoader::requestTexture(const std::string& path)
+{
+    // Already in flight: share the pending result
+    auto found = inFlight.find(path);
+    if (found != inFlight.end()) 
+    {
+        return found->second;
+    }
+    
+    auto job = std::make_unique<Job>();
+    job->path = path;
+    TextureFuture future = job->promise.get_future().share();
+    
+    // Already cached: resolve immediately without touching the disk
+    std::shared_ptr<const sf::Texture> cached = cache.find(path);
+    if (cached) 
+    {
+        job->promise.set_value(cached);
+        return future;
+    }
+    
+    inFlight[path] = future;
+    requested++;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        decodeQueue.push_back(std::move(job));
+    }
+    wakeWorkers.notify_one();
+    return future;
+}
+
+std::size_t AssetLoader::uploadPending(std::size_t maxUploads)
+{
+    std::size_t uploads = 0;
+    while (uploads < maxUploads) 
+    {
+        std::unique_ptr<Job> job;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (uploadQueue.empty()) 
+            {
+                break;
+            }
+            job = std::move(uploadQueue.front());
+            uploadQueue.pop_front();
+        }
+        
+        std::shared_ptr<sf::Texture> texture;
+        if (job->decoded) 
+        {
+            texture = std::make_shared<sf::Texture>();
+            if (!texture->loadFromImage(job->image)) 
+            {
+                texture.reset();
+            }
+        }
+        
+        if (texture) 
+        {
+            cache.adopt(job->path, texture);
+            loaded.push_back(texture);
+            uploads++;
+        }
+        else 
+        {
+            std::cout << "Failed to load texture from file: " << job->path << std::endl;
+            failed++;
+        }
+        
+        completed++;
+        inFlight.erase(job->path);
+        job->promise.set_value(texture);
+    }
+    return uploads;
+}
+
+float AssetLoader::getProgress() const
+{
+    return requested == 0 ? 1.0f : static_cast<float>(completed) / static_cast<float>(requested);
+}
+
+bool AssetLoader::isFinished() const
+{
+    return completed == requested;
+}
+
+void AssetLoader::releaseLoaded()
+{
+    loaded.clear();
+}
+
+void AssetLoader::workerLoop()
+{
+    for (;;) 
+    {
+        std::unique_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeWorkers.wait(lock, [this]() { return stopping || !decodeQueue.empty(); });
+            if (stopping) 
+            {
+                return;
+            }
+            job = std::move(decodeQueue.front());
+            decodeQueue.pop_front();
+        }
+        
+        // Decoding needs no GL context, so it runs here in parallel
+        job->decoded = job->image.loadFromFile(job->path);
+        
+        std::lock_guard<std::mutex> lock(mutex);
+        uploadQueue.push_back(std::move(job));
+    }
+}
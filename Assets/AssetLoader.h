@@ -0,0 +1,154 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "../Animation/TextureCache.h"
+
+/** @brief Resolves to the loaded texture, or nullptr if loading failed */
+using TextureFuture = std::shared_future<std::shared_ptr<const sf::Texture>>;
+
+/**
+ * @class AssetLoader
+ * @brief Decodes images on a worker pool and uploads textures on the main thread
+ * 
+ * PNG decoding is the slow part of startup and needs no graphics context,
+ * so workers turn files into sf::Image in parallel. Creating the GPU texture
+ * must happen on the thread that renders; uploadPending() does that in
+ * small, bounded batches so a loading screen keeps drawing while assets
+ * stream in. Finished textures are adopted into a TextureCache, so regular
+ * Animation::loadFromFile calls for the same paths become cache hits.
+ * 
+ * @note Never wait on a TextureFuture from the main thread without calling
+ *       uploadPending(), the upload that resolves it runs on that thread.
+ * @note The loader keeps every texture it produced alive until it is
+ *       destroyed or releaseLoaded() is called.
+ * 
+ * @example
+ * @code
+ * AssetLoader loader;
+ * for (const std::string& path : Player::getAnimationPaths())
+ *     loader.requestTexture(path);
+ * 
+ * // Loading screen:
+ * while (!loader.isFinished()) {
+ *     loader.uploadPending(2);
+ *     drawProgressBar(loader.getProgress());
+ * }
+ * player.loadAllAnimations();  // served from the cache
+ * @endcode
+ */
+class AssetLoader
+{
+public:
+    /**
+     * @brief Starts the worker threads
+     * 
+     * @param workerCount Number of decode threads (0 = one per core, minus the main thread)
+     * @param cache       Cache that receives uploaded textures
+     */
+    explicit AssetLoader(unsigned int workerCount = 0, TextureCache& cache = TextureCache::global());
+    
+    /**
+     * @brief Stops the workers (queued but unstarted requests are dropped)
+     */
+    ~AssetLoader();
+    
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+    
+    /**
+     * @brief Queues a texture for background decoding
+     * 
+     * Requests for a path that is already cached or already in flight share
+     * the existing result.
+     * 
+     * @param path Path to the image file
+     * @return Future that resolves once the texture has been uploaded
+     */
+    TextureFuture requestTexture(const std::string& path);
+    
+    /**
+     * @brief Uploads decoded images to the GPU (main thread only)
+     * 
+     * @param maxUploads Upper bound on uploads this call, to cap frame time
+     * @return Number of textures uploaded
+     */
+    std::size_t uploadPending(std::size_t maxUploads = SIZE_MAX);
+    
+    /**
+     * @brief Fraction of requested textures that are finished (0..1)
+     */
+    float getProgress() const;
+    
+    /**
+     * @brief Whether every request so far has been uploaded or has failed
+     */
+    bool isFinished() const;
+    
+    /**
+     * @brief Drops the loader's references to finished textures
+     */
+    void releaseLoaded();
+    
+    /// @name Statistics
+    /// @{
+    
+    /** @brief Textures requested (excluding duplicates and cache hits) */
+    std::size_t requested = 0;
+    
+    /** @brief Textures uploaded or failed */
+    std::size_t completed = 0;
+    
+    /** @brief Requests whose file could not be decoded or uploaded */
+    std::size_t failed = 0;
+    
+    /// @}
+    
+private:
+    /** @brief One request moving through decode and upload */
+    struct Job
+    {
+        std::string path;
+        sf::Image image;
+        bool decoded = false;
+        std::promise<std::shared_ptr<const sf::Texture>> promise;
+    };
+    
+    /** @brief Worker loop: pop a job, decode it, hand it to the main thread */
+    void workerLoop();
+    
+    /** @brief Cache that receives uploaded textures */
+    TextureCache& cache;
+    
+    /** @brief Decode threads */
+    std::vector<std::thread> workers;
+    
+    /** @brief Guards decodeQueue, uploadQueue and stopping */
+    std::mutex mutex;
+    
+    /** @brief Signals workers that decode work arrived or the loader is stopping */
+    std::condition_variable wakeWorkers;
+    
+    /** @brief Jobs waiting for a worker */
+    std::deque<std::unique_ptr<Job>> decodeQueue;
+    
+    /** @brief Decoded (or failed) jobs waiting for the main thread */
+    std::deque<std::unique_ptr<Job>> uploadQueue;
+    
+    /** @brief Set by the destructor to end the worker loops */
+    bool stopping = false;
+    
+    /** @brief Unfinished requests by path, to share duplicates (main thread only) */
+    std::unordered_map<std::string, TextureFuture> inFlight;
+    
+    /** @brief Textures produced by this loader, kept alive for the cache */
+    std::vector<std::shared_ptr<const sf::Texture>> loaded;
+};
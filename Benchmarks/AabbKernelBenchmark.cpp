@@ -0,0 +1,161 @@
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../Player/Player.h"
+#include "../Platform/Platform.h"
+#include "../Physics/AabbKernel.h"
+#include "../Physics/Collision.h"
+
+// One entity box against N candidate platforms, for N = 1k, 10k and 100k:
+//   getIntersection  - the original path, bounds recomputed from each RectangleShape
+//   findIntersection - one pair at a time on cached sf::FloatRect bounds
+//   kernel scalar    - AabbKernel::overlapScalar on SoA bounds
+//   kernel SIMD      - AabbKernel::overlap (AVX, SSE or scalar, per build flags)
+// Every case must report the same number of hits. Build with -mavx2 (or
+// -march=native) to get the 8-lane path; plain x86-64 builds use SSE.
+//
+// Usage: AabbKernelBenchmark [queries]   (default: 64)
+
+
+namespace
+{
+    // Keeps results the optimizer would otherwise discard
+    volatile std::size_t resultSink = 0;
+    
+    // Runs pass() until minSeconds have elapsed; returns ns per candidate and the last hit count
+    template <typename Pass>
+    double measure(std::size_t candidatesPerPass, std::size_t& hits, Pass pass, double minSeconds = 0.2)
+    {
+        hits = pass(); // Warm up
+        
+        std::size_t passes = 0;
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0.0;
+        while (elapsed < minSeconds) 
+        {
+            hits = pass();
+            passes++;
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        resultSink = hits;
+        return elapsed * 1e9 / (double(passes) * candidatesPerPass);
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t queryCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    if (queryCount == 0) 
+    {
+        std::fprintf(stderr, "queries must be positive\n");
+        return 1;
+    }
+    
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> xDist(0.0f, 4000.0f);
+    std::uniform_real_distribution<float> yDist(0.0f, 2000.0f);
+    std::uniform_real_distribution<float> sizeDist(40.0f, 400.0f);
+    
+    // Players hold pointers into themselves, so construct them in place
+    std::vector<Player> players;
+    players.reserve(queryCount);
+    std::vector<sf::FloatRect> queries;
+    for (std::size_t i = 0; i < queryCount; i++) 
+    {
+        players.emplace_back(xDist(rng), yDist(rng));
+        queries.push_back(players.back().getGlobalBounds());
+    }
+    
+    Collision collision;
+    std::printf("kernel: %s (%zu lanes), %zu query boxes\n", AabbKernel::instructionSet(), AabbKernel::lanes(), queryCount);
+    std::printf("%-10s %-18s %12s %10s %10s\n", "candidates", "case", "ns/candidate", "speedup", "hits");
+    
+    bool consistent = true;
+    for (std::size_t count : { std::size_t(1000), std::size_t(10000), std::size_t(100000) }) 
+    {
+        std::vector<Platform> platforms;
+        std::vector<sf::FloatRect> rects;
+        platforms.reserve(count);
+        for (std::size_t i = 0; i < count; i++) 
+        {
+            platforms.push_back(Platform(xDist(rng), yDist(rng), sizeDist(rng), 20.0f, sf::Color::Black));
+            rects.push_back(platforms.back().shape.getGlobalBounds());
+        }
+        AabbArrays arrays;
+        arrays.assign(rects.data(), rects.size());
+        
+        std::vector<std::uint32_t> hitMask(AabbKernel::maskWords(count));
+        std::vector<float> overlapX(count);
+        std::vector<float> overlapY(count);
+        std::size_t perPass = count * queryCount;
+        
+        std::size_t baseHits = 0;
+        double baseNs = measure(perPass, baseHits, [&]()
+        {
+            std::size_t hits = 0;
+            for (const Player& player : players) 
+            {
+                for (const Platform& platform : platforms) 
+                {
+                    hits += collision.getIntersection(player, platform).has_value();
+                }
+            }
+            return hits;
+        });
+        
+        std::size_t cachedHits = 0;
+        double cachedNs = measure(perPass, cachedHits, [&]()
+        {
+            std::size_t hits = 0;
+            for (const sf::FloatRect& query : queries) 
+            {
+                for (const sf::FloatRect& rect : rects) 
+                {
+                    hits += query.findIntersection(rect).has_value();
+                }
+            }
+            return hits;
+        });
+        
+        std::size_t scalarHits = 0;
+        double scalarNs = measure(perPass, scalarHits, [&]()
+        {
+            std::size_t hits = 0;
+            for (const sf::FloatRect& query : queries) 
+            {
+                hits += AabbKernel::overlapScalar(query, arrays.minX.data(), arrays.minY.data(), arrays.maxX.data(),
+                                                  arrays.maxY.data(), count, hitMask.data(), overlapX.data(), overlapY.data());
+            }
+            return hits;
+        });
+        
+        std::size_t simdHits = 0;
+        double simdNs = measure(perPass, simdHits, [&]()
+        {
+            std::size_t hits = 0;
+            for (const sf::FloatRect& query : queries) 
+            {
+                hits += AabbKernel::overlap(query, arrays, 0, count, hitMask.data(), overlapX.data(), overlapY.data());
+            }
+            return hits;
+        });
+        
+        std::printf("%-10zu %-18s %12.3f %9.2fx %10zu\n", count, "getIntersection", baseNs, 1.0, baseHits);
+        std::printf("%-10zu %-18s %12.3f %9.2fx %10zu\n", count, "findIntersection", cachedNs, baseNs / cachedNs, cachedHits);
+        std::printf("%-10zu %-18s %12.3f %9.2fx %10zu\n", count, "kernel scalar", scalarNs, baseNs / scalarNs, scalarHits);
+        std::printf("%-10zu %-18s %12.3f %9.2fx %10zu\n", count, "kernel SIMD", simdNs, baseNs / simdNs, simdHits);
+        
+        consistent &= cachedHits == baseHits && scalarHits == baseHits && simdHits == baseHits;
+    }
+    
+    if (!consistent) 
+    {
+        std::printf("hit counts differ between paths\n");
+        return 1;
+    }
+    return 0;
+}
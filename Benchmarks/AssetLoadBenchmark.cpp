@@ -0,0 +1,87 @@
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "../Animation/TextureCache.h"
+#include "../Assets/AssetLoader.h"
+
+// Startup cost of loading every enemy frame and player sheet, serially on the
+// main thread (the old path) versus through AssetLoader's worker pool.
+// Both runs start from an empty TextureCache; the OS file cache is warmed
+// first so the comparison measures decode + upload, not disk latency.
+//
+// Usage: AssetLoadBenchmark [workers]   (default: one per core minus one)
+
+
+// Every PNG under a directory tree
+static std::vector<std::string> collectPngs(const std::string& root)
+{
+    std::vector<std::string> paths;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) 
+    {
+        if (entry.path().extension() == ".png") 
+        {
+            paths.push_back(entry.path().generic_string());
+        }
+    }
+    return paths;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int workers = argc > 1 ? static_cast<unsigned int>(std::atoi(argv[1])) : 0;
+    std::vector<std::string> paths = collectPngs("assets");
+    
+    // Warm the OS file cache
+    {
+        TextureCache warmup;
+        for (const std::string& path : paths) 
+        {
+            warmup.getTexture(path);
+        }
+    }
+    
+    // Serial: decode and upload one after another on this thread
+    TextureCache serialCache;
+    std::vector<std::shared_ptr<const sf::Texture>> serialTextures;
+    auto serialStart = std::chrono::steady_clock::now();
+    for (const std::string& path : paths) 
+    {
+        serialTextures.push_back(serialCache.getTexture(path));
+    }
+    auto serialEnd = std::chrono::steady_clock::now();
+    
+    // Parallel: workers decode, this thread only uploads
+    TextureCache parallelCache;
+    auto parallelStart = std::chrono::steady_clock::now();
+    std::size_t failed = 0;
+    {
+        AssetLoader loader(workers, parallelCache);
+        for (const std::string& path : paths) 
+        {
+            loader.requestTexture(path);
+        }
+        while (!loader.isFinished()) 
+        {
+            if (loader.uploadPending() == 0) 
+            {
+                std::this_thread::yield();
+            }
+        }
+        failed = loader.failed;
+    }
+    auto parallelEnd = std::chrono::steady_clock::now();
+    
+    double serialMs = std::chrono::duration<double, std::milli>(serialEnd - serialStart).count();
+    double parallelMs = std::chrono::duration<double, std::milli>(parallelEnd - parallelStart).count();
+    
+    std::printf("textures:      %zu (%zu failed)\n", paths.size(), failed);
+    std::printf("serial:        %.2f ms\n", serialMs);
+    std::printf("AssetLoader:   %.2f ms\n", parallelMs);
+    std::printf("speedup:       %.2fx\n", serialMs / parallelMs);
+    
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "../Player/Player.h"
+#include "../Platform/Platform.h"
+#include "../Physics/Collision.h"
+#include "../Physics/SpatialGrid.h"
+
+// Per-frame player/platform collision cost as the level grows.
+// Compares the old linear loop over every platform with the grid broadphase.
+//
+// Usage: BroadphaseBenchmark
+
+
+// Lay out `count` 150x20 platforms on a square-ish lattice (constant density)
+static void buildLevel(std::vector<Platform>& platforms, std::size_t count)
+{
+    platforms.clear();
+    platforms.reserve(count);
+    std::size_t columns = static_cast<std::size_t>(std::ceil(std::sqrt(count * 4.0)));
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        float x = static_cast<float>(i % columns) * 250.0f;
+        float y = static_cast<float>(i / columns) * 100.0f;
+        platforms.push_back(Platform(x, y, 150, 20, sf::Color::Black));
+    }
+}
+
+// Average nanoseconds per collision pass for the player at each sample point
+template <typename Pass>
+static double timePasses(Player& player, const std::vector<sf::Vector2f>& samples, int repeats, Pass pass)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) 
+    {
+        for (const auto& sample : samples) 
+        {
+            player.setPosition(sample);
+            pass();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    return ns / (static_cast<double>(repeats) * samples.size());
+}
+
+int main()
+{
+    const std::size_t counts[] = { 4, 100, 1000, 10000, 100000 };
+    
+    std::printf("%10s %14s %14s %10s\n", "platforms", "linear ns", "grid ns", "speedup");
+    
+    for (std::size_t count : counts) 
+    {
+        std::vector<Platform> platforms;
+        buildLevel(platforms, count);
+        
+        SpatialGrid grid;
+        grid.build(platforms);
+        
+        // Sample positions just above random platforms so most passes hit one
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<std::size_t> pick(0, count - 1);
+        std::vector<sf::Vector2f> samples;
+        for (int i = 0; i < 1024; i++) 
+        {
+            sf::FloatRect bounds = platforms[pick(rng)].shape.getGlobalBounds();
+            samples.push_back(sf::Vector2f(bounds.position.x + 40.0f, bounds.position.y - 20.0f));
+        }
+        
+        Player player(0, 0);
+        Collision collision;
+        
+        // Keep total linear work bounded so 100k platforms finishes quickly
+        int linearRepeats = static_cast<int>(std::max<std::size_t>(1, 2000000 / (count * samples.size())));
+        double linearNs = timePasses(player, samples, linearRepeats, [&]() 
+        {
+            for (auto& platform : platforms) 
+            {
+                collision.handleCollision(player, platform);
+            }
+        });
+        
+        double gridNs = timePasses(player, samples, 200, [&]() 
+        {
+            collision.handleCollisions(player, grid);
+        });
+        
+        std::printf("%10zu %14.1f %14.1f %9.1fx\n", count, linearNs, gridNs, linearNs / gridNs);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Animation/ClipResidency.h"
+#include "../Enemy/Enemy.h"
+#include "../Level/LevelFormat.h"
+#include "../Render/SnapshotRenderer.h"
+#include "../Render/SpriteBatch.h"
+
+// Enemy texture memory on a level whose spawn table uses two of the six
+// enemy families:
+//   eager    - every family's idle, attack and death clips loaded up front
+//   lazy     - the spawn table's families prefetched, everything else loaded
+//              the first time it is drawn
+//   lazy+cap - the same under a memory budget, while the other families
+//              wander in now and then and have to be loaded and evicted
+// The lazy runs draw through SnapshotRenderer, so clips are acquired and
+// released exactly as in the game. Reports resident bytes, hits, misses,
+// prefetches and evictions, and the worst frame (the ones that load).
+//
+// Usage: ClipResidencyBenchmark [frames] [budget KB] [assetPath]   (default: 3000 256 assets/Enemies/)
+
+
+namespace
+{
+    const std::size_t TYPE_COUNT = static_cast<std::size_t>(EnemyType::COUNT);
+    
+    // The level's families
+    const EnemyType RESIDENTS[2] = { EnemyType::DEMON, EnemyType::LIZARD };
+    
+    // Frame f: mostly idle residents, some attacking, the odd death, and a
+    // visiting family for 60 frames out of every 500
+    RenderSnapshot makeFrame(std::size_t f, std::mt19937& rng)
+    {
+        std::uniform_int_distribution<int> roll(0, 99);
+        RenderSnapshot snapshot;
+        snapshot.tick = f;
+        for (std::size_t i = 0; i < 48; i++) 
+        {
+            EnemySnapshot enemy = {};
+            enemy.type = RESIDENTS[i % 2];
+            int r = roll(rng);
+            enemy.state = r < 80 ? EnemyState::IDLE : r < 97 ? EnemyState::ATTACKING : EnemyState::DEAD;
+            enemy.x = enemy.previousX = 20.0f * i;
+            enemy.y = enemy.previousY = 300.0f;
+            snapshot.enemies.push_back(enemy);
+        }
+        if (f % 500 < 60) 
+        {
+            EnemySnapshot visitor = {};
+            visitor.type = static_cast<EnemyType>(2 + (f / 500) % (TYPE_COUNT - 2));
+            visitor.state = f % 500 < 40 ? EnemyState::IDLE : EnemyState::ATTACKING;
+            snapshot.enemies.push_back(visitor);
+        }
+        return snapshot;
+    }
+    
+    void report(const char* label, const ResidencyStats& stats, double averageMs, double worstMs)
+    {
+        std::printf("%-9s %9zu KB %4zu/%-4zu %7zu %7zu %8zu %8zu %10.3f %10.3f\n", label, stats.residentBytes / 1024,
+                    stats.residentClips, stats.declaredClips, stats.hits, stats.misses, stats.prefetches,
+                    stats.evictions, averageMs, worstMs);
+    }
+    
+    // Draws the frames through a renderer bound to the residency
+    void run(const char* label, ClipResidency& residency, const std::string& basePath, std::size_t frames)
+    {
+        SnapshotRenderer renderer;
+        renderer.setEnemyClips(residency, basePath);
+        
+        std::vector<EnemySpawn> spawns;
+        for (EnemyType type : RESIDENTS) 
+        {
+            spawns.push_back(EnemySpawn{ 0.0f, 0.0f, static_cast<std::uint32_t>(type), 0 });
+        }
+        renderer.prefetchEnemies(spawns.data(), spawns.size());
+        
+        std::mt19937 rng(22);
+        SpriteBatch batch;
+        double totalMs = 0.0;
+        double worstMs = 0.0;
+        for (std::size_t f = 0; f < frames; f++) 
+        {
+            RenderSnapshot snapshot = makeFrame(f, rng);
+            auto start = std::chrono::steady_clock::now();
+            batch.begin();
+            renderer.draw(batch, snapshot, 1.0f);
+            double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            totalMs += ms;
+            worstMs = std::max(worstMs, ms);
+        }
+        report(label, residency.getStats(), totalMs / frames, worstMs);
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t frames = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 3000;
+    std::size_t budgetKb = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 256;
+    std::string basePath = argc > 3 ? argv[3] : "assets/Enemies/";
+    
+    std::printf("%-9s %12s %9s %7s %7s %8s %8s %10s %10s\n", "mode", "resident", "clips", "hits", "misses",
+                "prefetch", "evicted", "avg ms", "worst ms");
+    
+    // Eager: what loading every family up front costs
+    {
+        ClipResidency residency(SIZE_MAX);
+        Enemy::declareClips(residency, basePath);
+        auto start = std::chrono::steady_clock::now();
+        for (ClipResidency::ClipId id = 0; id < residency.getStats().declaredClips; id++) 
+        {
+            residency.prefetch(id);
+        }
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        report("eager", residency.getStats(), ms, ms);
+        if (residency.getStats().loadFailures > 0) 
+        {
+            std::fprintf(stderr, "Missing enemy frames under %s\n", basePath.c_str());
+            return 1;
+        }
+    }
+    
+    ClipResidency unlimited(SIZE_MAX);
+    run("lazy", unlimited, basePath, frames);
+    
+    ClipResidency capped(budgetKb * 1024);
+    run("lazy+cap", capped, basePath, frames);
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../Enemy/EnemyPool.h"
+#include "../Platform/Platform.h"
+#include "../Physics/SpatialGrid.h"
+
+// Frame cost of EnemyPool::update + collide for a large crowd, with 1% of
+// enemies despawned and respawned every frame to exercise the free list.
+// The target is 10k+ enemies inside the 75 FPS budget (13.3 ms) on one core.
+//
+// Usage: EnemyPoolBenchmark [enemies] [frames]   (default: 10000 600)
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t enemyCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 600;
+    const float deltaTime = 1.0f / 75.0f;
+    
+    // Long level: a ground strip plus staggered ledges
+    std::vector<Platform> platforms;
+    platforms.push_back(Platform(0, 550, 20000, 50, sf::Color::Green));
+    for (int i = 0; i < 200; i++) 
+    {
+        platforms.push_back(Platform(i * 100.0f, 350.0f + (i % 3) * 60.0f, 60, 20, sf::Color::Black));
+    }
+    SpatialGrid grid;
+    grid.build(platforms);
+    
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> xDist(0.0f, 20000.0f);
+    std::uniform_real_distribution<float> yDist(0.0f, 500.0f);
+    std::uniform_real_distribution<float> speedDist(-120.0f, 120.0f);
+    std::uniform_int_distribution<int> typeDist(0, static_cast<int>(EnemyType::COUNT) - 1);
+    
+    EnemyPool pool(enemyCount);
+    std::vector<EnemyHandle> handles;
+    auto spawnRandom = [&]() 
+    {
+        return pool.spawn(static_cast<EnemyType>(typeDist(rng)), 
+                          sf::Vector2f(xDist(rng), yDist(rng)), 
+                          sf::Vector2f(speedDist(rng), 0.0f));
+    };
+    for (std::size_t i = 0; i < enemyCount; i++) 
+    {
+        handles.push_back(spawnRandom());
+    }
+    
+    std::vector<double> frameMs;
+    frameMs.reserve(frames);
+    std::size_t churn = std::max<std::size_t>(1, enemyCount / 100);
+    std::uniform_int_distribution<std::size_t> pick(0, enemyCount - 1);
+    
+    for (int f = 0; f < frames; f++) 
+    {
+        auto start = std::chrono::steady_clock::now();
+        
+        for (std::size_t c = 0; c < churn; c++) 
+        {
+            std::size_t h = pick(rng);
+            pool.despawn(handles[h]);
+            handles[h] = spawnRandom();
+        }
+        pool.update(deltaTime);
+        pool.collide(grid);
+        
+        auto end = std::chrono::steady_clock::now();
+        frameMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+    
+    std::sort(frameMs.begin(), frameMs.end());
+    double total = 0.0;
+    for (double ms : frameMs) 
+    {
+        total += ms;
+    }
+    double average = total / frameMs.size();
+    double p99 = frameMs[static_cast<std::size_t>(frameMs.size() * 0.99)];
+    
+    std::printf("enemies:          %zu\n", pool.size());
+    std::printf("frames:           %d\n", frames);
+    std::printf("avg frame:        %.3f ms\n", average);
+    std::printf("p99 frame:        %.3f ms\n", p99);
+    std::printf("ns per enemy:     %.1f\n", average * 1e6 / pool.size());
+    
+    ContactStats contacts = pool.getContactStats();
+    std::printf("grid queries:     %.1f per frame\n", double(contacts.queries) / frames);
+    std::printf("queries avoided:  %.1f per frame (%.1f%%)\n", double(contacts.queriesAvoided) / frames, 
+                100.0 * contacts.queriesAvoided / std::max<std::size_t>(1, contacts.queries + contacts.queriesAvoided));
+    std::printf("75 FPS budget:    %s (13.33 ms)\n", p99 < 1000.0 / 75.0 ? "PASS" : "FAIL");
+    
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+#include "../Enemy/EnemyPool.h"
+#include "../Jobs/JobSystem.h"
+#include "../Platform/Platform.h"
+#include "../Physics/SpatialGrid.h"
+
+// Scaling of the parallel EnemyPool phases (update + collide) from 1 thread
+// to one per core. Every run starts from the same crowd, and the final
+// state hash must match the serial run, which proves the parallel path is
+// deterministic.
+//
+// Usage: JobScalingBenchmark [enemies] [frames] [maxThreads]
+//        (default: 50000 300, one per core)
+
+
+namespace
+{
+    std::uint64_t hashPool(const EnemyPool& pool)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const std::vector<float>* column : { &pool.positionX, &pool.positionY, &pool.velocityX, &pool.velocityY }) 
+        {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(column->data());
+            for (std::size_t i = 0; i < pool.size() * sizeof(float); i++) 
+            {
+                hash = (hash ^ bytes[i]) * 1099511628211ULL;
+            }
+        }
+        return hash;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t enemyCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 50000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+    std::size_t maxThreads = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : std::thread::hardware_concurrency();
+    maxThreads = std::max<std::size_t>(maxThreads, 1);
+    const float deltaTime = 1.0f / 120.0f;
+    
+    // Long level: a ground strip plus staggered ledges
+    std::vector<Platform> platforms;
+    platforms.push_back(Platform(0, 550, 20000, 50, sf::Color::Green));
+    for (int i = 0; i < 200; i++) 
+    {
+        platforms.push_back(Platform(i * 100.0f, 350.0f + (i % 3) * 60.0f, 60, 20, sf::Color::Black));
+    }
+    SpatialGrid grid;
+    grid.build(platforms);
+    
+    std::printf("%-8s %10s %10s %10s %18s\n", "threads", "ms/frame", "speedup", "steals", "state hash");
+    double serialMs = 0.0;
+    std::uint64_t serialHash = 0;
+    bool deterministic = true;
+    for (std::size_t threads = 1; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1) 
+    {
+        // Same seed every run so all thread counts simulate the same crowd
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> xDist(0.0f, 20000.0f);
+        std::uniform_real_distribution<float> yDist(0.0f, 500.0f);
+        std::uniform_real_distribution<float> speedDist(-120.0f, 120.0f);
+        std::uniform_int_distribution<int> typeDist(0, static_cast<int>(EnemyType::COUNT) - 1);
+        EnemyPool pool(enemyCount);
+        for (std::size_t i = 0; i < enemyCount; i++) 
+        {
+            pool.spawn(static_cast<EnemyType>(typeDist(rng)), 
+                       sf::Vector2f(xDist(rng), yDist(rng)), 
+                       sf::Vector2f(speedDist(rng), 0.0f));
+        }
+        
+        JobSystem jobs(threads - 1);
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; f++) 
+        {
+            pool.update(deltaTime, jobs);
+            pool.collide(grid, jobs);
+        }
+        auto end = std::chrono::steady_clock::now();
+        
+        double ms = std::chrono::duration<double, std::milli>(end - start).count() / frames;
+        std::uint64_t hash = hashPool(pool);
+        if (threads == 1) 
+        {
+            serialMs = ms;
+            serialHash = hash;
+        }
+        deterministic &= hash == serialHash;
+        
+        std::printf("%-8zu %10.3f %9.2fx %10zu %18llx%s\n", threads, ms, serialMs / ms, jobs.steals.load(), 
+                    static_cast<unsigned long long>(hash), hash == serialHash ? "" : "  MISMATCH");
+    }
+    
+    std::printf("%zu enemies, %d frames: %s\n", enemyCount, frames, deterministic ? "deterministic" : "NOT deterministic");
+    return deterministic ? 0 : 1;
+}
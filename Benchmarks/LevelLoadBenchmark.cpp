@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "../Level/LevelFile.h"
+#include "../Level/LevelSource.h"
+#include "../Physics/SpatialGrid.h"
+
+// Time to get a large level ready for collision: parsing the text source
+// versus mapping the binary .lvl. Both paths end with a built SpatialGrid.
+//
+// Usage: LevelLoadBenchmark [platforms] [directory]   (default: 100000 .)
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    std::string directory = argc > 2 ? argv[2] : ".";
+    std::string textPath = directory + "/bench_level.txt";
+    std::string binaryPath = directory + "/bench_level.lvl";
+    
+    LevelSource generated = LevelSource::generate(count);
+    if (!generated.writeText(textPath) || !generated.writeBinary(binaryPath)) 
+    {
+        return 1;
+    }
+    
+    // Text: parse every record, then build the grid from the parsed arrays
+    auto textStart = std::chrono::steady_clock::now();
+    LevelSource parsed;
+    if (!parsed.loadFromText(textPath)) 
+    {
+        return 1;
+    }
+    SpatialGrid textGrid;
+    textGrid.build(parsed.platformX.data(), parsed.platformY.data(), 
+                   parsed.platformWidth.data(), parsed.platformHeight.data(), 
+                   parsed.platformX.size());
+    auto textEnd = std::chrono::steady_clock::now();
+    
+    // Binary: map the file and build the grid straight from the mapping
+    auto binaryStart = std::chrono::steady_clock::now();
+    LevelFile level;
+    if (!level.open(binaryPath)) 
+    {
+        return 1;
+    }
+    auto mappedEnd = std::chrono::steady_clock::now();
+    SpatialGrid binaryGrid;
+    binaryGrid.build(level.platformX(), level.platformY(), 
+                     level.platformWidth(), level.platformHeight(), 
+                     level.platformCount());
+    auto binaryEnd = std::chrono::steady_clock::now();
+    
+    auto ms = [](auto a, auto b) { return std::chrono::duration<double, std::milli>(b - a).count(); };
+    
+    std::printf("platforms:            %zu (%zu spawns)\n", level.platformCount(), level.spawnCount());
+    std::printf("text parse + grid:    %.2f ms\n", ms(textStart, textEnd));
+    std::printf("mmap:                 %.3f ms\n", ms(binaryStart, mappedEnd));
+    std::printf("mmap + grid:          %.2f ms\n", ms(binaryStart, binaryEnd));
+    std::printf("speedup:              %.1fx\n", ms(textStart, textEnd) / ms(binaryStart, binaryEnd));
+    std::printf("grids match:          %s\n", textGrid.size() == binaryGrid.size() ? "yes" : "NO");
+    
+    std::remove(textPath.c_str());
+    level.close();
+    std::remove(binaryPath.c_str());
+    return 0;
+}
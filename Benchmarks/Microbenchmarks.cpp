@@ -0,0 +1,285 @@
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Animation/Animation.h"
+#include "../Animation/AnimationClip.h"
+#include "../Physics/Collision.h"
+#include "../Platform/Platform.h"
+#include "../Player/Player.h"
+
+// ns/op, allocations/op and throughput for the per-tick hot paths over a
+// synthetic scene: entities scattered across a 4000x2000 world with random
+// platforms. Each case repeats until it has run for at least 200 ms.
+// Animations use a blank in-memory sheet, so no assets are needed. Build with
+// GAME_DISABLE_PROFILING to leave the PROFILE_SCOPE cost out of the numbers.
+//
+// Usage: Microbenchmarks [entities] [platforms] [--json out.json]
+//        (default: 1000 100)
+
+
+namespace
+{
+    // Every heap allocation in the process bumps this counter
+    std::atomic<std::size_t> allocationCount{ 0 };
+    
+    // Keeps results the optimizer would otherwise discard
+    volatile std::size_t resultSink = 0;
+    
+    struct Result
+    {
+        const char* name;
+        std::size_t ops;
+        double nsPerOp;
+        double allocsPerOp;
+        double opsPerSecond;
+    };
+    
+    // Runs body(rep) until minSeconds have elapsed; body performs opsPerRep operations
+    template <typename Body>
+    Result measure(const char* name, std::size_t opsPerRep, Body body, double minSeconds = 0.2)
+    {
+        body(0); // Warm caches and lazily created state
+        
+        std::size_t reps = 0;
+        std::size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        auto start = std::chrono::steady_clock::now();
+        double elapsed = 0.0;
+        while (elapsed < minSeconds) 
+        {
+            body(++reps);
+            elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+        std::size_t allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+        
+        std::size_t ops = reps * opsPerRep;
+        return Result{ name, ops, elapsed * 1e9 / ops, double(allocations) / ops, ops / elapsed };
+    }
+    
+    // Blank sheet shaped like the player sheets (96x70 frames)
+    ClipHandle makeClip(unsigned int frameCount, float fps)
+    {
+        auto texture = std::make_shared<sf::Texture>();
+        if (!texture->resize(sf::Vector2u(96 * frameCount, 70))) 
+        {
+            return nullptr;
+        }
+        
+        auto clip = std::make_shared<AnimationClip>();
+        clip->texture = texture;
+        clip->fps = fps;
+        clip->frameSize = sf::Vector2u(96, 70);
+        for (unsigned int i = 0; i < frameCount; i++) 
+        {
+            clip->frames.push_back(sf::IntRect(sf::Vector2i(int(i) * 96, 0), sf::Vector2i(96, 70)));
+        }
+        return clip;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) 
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t entityCount = 1000;
+    std::size_t platformCount = 100;
+    const char* jsonPath = nullptr;
+    int positional = 0;
+    for (int i = 1; i < argc; i++) 
+    {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) 
+        {
+            jsonPath = argv[++i];
+        }
+        else if (positional++ == 0) 
+        {
+            entityCount = std::strtoul(argv[i], nullptr, 10);
+        }
+        else 
+        {
+            platformCount = std::strtoul(argv[i], nullptr, 10);
+        }
+    }
+    if (entityCount == 0 || platformCount == 0) 
+    {
+        std::fprintf(stderr, "entities and platforms must be positive\n");
+        return 1;
+    }
+    
+    const float deltaTime = 1.0f / 120.0f;
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> xDist(0.0f, 4000.0f);
+    std::uniform_real_distribution<float> yDist(0.0f, 2000.0f);
+    std::uniform_real_distribution<float> sizeDist(40.0f, 400.0f);
+    std::uniform_real_distribution<float> speedDist(-400.0f, 400.0f);
+    
+    std::vector<Platform> platforms;
+    platforms.reserve(platformCount);
+    for (std::size_t i = 0; i < platformCount; i++) 
+    {
+        platforms.push_back(Platform(xDist(rng), yDist(rng), sizeDist(rng), 20.0f, sf::Color::Black));
+    }
+    
+    ClipHandle idleClip = makeClip(6, 8.0f);
+    ClipHandle walkClip = makeClip(6, 12.0f);
+    ClipHandle runClip = makeClip(6, 15.0f);
+    ClipHandle jumpClip = makeClip(5, 10.0f);
+    if (!idleClip || !walkClip || !runClip || !jumpClip) 
+    {
+        std::fprintf(stderr, "could not create animation textures\n");
+        return 1;
+    }
+    
+    // Players hold pointers into themselves, so construct them in place
+    std::vector<Player> players;
+    players.reserve(entityCount);
+    std::vector<sf::Vector2f> spawns(entityCount);
+    std::vector<std::size_t> touching(entityCount);
+    for (std::size_t i = 0; i < entityCount; i++) 
+    {
+        // Spawn overlapping the top edge of a platform so every collision resolves
+        touching[i] = rng() % platformCount;
+        sf::FloatRect bounds = platforms[touching[i]].shape.getGlobalBounds();
+        spawns[i] = sf::Vector2f(bounds.position.x + bounds.size.x / 2.0f, bounds.position.y - 18.0f);
+        
+        players.emplace_back(spawns[i].x, spawns[i].y);
+        Player& player = players.back();
+        player.idleAnimation.setClip(idleClip);
+        player.walkAnimation.setClip(walkClip);
+        player.runAnimation.setClip(runClip);
+        player.jumpAnimation.setClip(jumpClip);
+        player.currentAnimation = &player.idleAnimation;
+        player.velocity = sf::Vector2f(speedDist(rng), 0.0f);
+    }
+    
+    std::vector<Animation> animations(entityCount);
+    for (std::size_t i = 0; i < entityCount; i++) 
+    {
+        animations[i].setClip(runClip);
+    }
+    
+    Collision collision;
+    std::vector<Result> results;
+    
+    // Every entity against every platform
+    results.push_back(measure("Collision::getIntersection", entityCount * platformCount, [&](std::size_t) 
+    {
+        std::size_t hits = 0;
+        for (const Player& player : players) 
+        {
+            for (const Platform& platform : platforms) 
+            {
+                hits += collision.getIntersection(player, platform).has_value();
+            }
+        }
+        resultSink = hits;
+    }));
+    
+    // One overlapping platform per entity; the spawn reset is included in the cost
+    results.push_back(measure("Collision::handleCollision", entityCount, [&](std::size_t) 
+    {
+        for (std::size_t i = 0; i < entityCount; i++) 
+        {
+            players[i].setPosition(spawns[i]);
+            players[i].velocity.y = 50.0f;
+            collision.handleCollision(players[i], platforms[touching[i]]);
+        }
+    }));
+    
+    results.push_back(measure("Animation::update", entityCount, [&](std::size_t) 
+    {
+        for (Animation& animation : animations) 
+        {
+            animation.update(deltaTime);
+        }
+    }));
+    
+    // setFrame is the public entry to updateTextureRect
+    results.push_back(measure("Animation::updateTextureRect", entityCount, [&](std::size_t rep) 
+    {
+        for (std::size_t i = 0; i < entityCount; i++) 
+        {
+            animations[i].setFrame(static_cast<unsigned int>((i + rep) % 6));
+        }
+    }));
+    
+    results.push_back(measure("Player::update", entityCount, [&](std::size_t rep) 
+    {
+        for (std::size_t i = 0; i < entityCount; i++) 
+        {
+            // Reverse a few entities each pass so the facing flip is exercised
+            if ((i + rep) % 16 == 0) 
+            {
+                players[i].velocity.x = -players[i].velocity.x;
+            }
+            players[i].onGround = true;
+            players[i].update(deltaTime);
+        }
+    }));
+    
+    // Each entity leaves and re-enters the ground once every 8 passes
+    results.push_back(measure("Player::updateAnimationState", entityCount, [&](std::size_t rep) 
+    {
+        for (std::size_t i = 0; i < entityCount; i++) 
+        {
+            players[i].onGround = (i + rep) % 8 != 0;
+            players[i].updateAnimationState();
+        }
+    }));
+    
+    std::printf("entities %zu, platforms %zu\n", entityCount, platformCount);
+    std::printf("%-30s %12s %12s %14s %14s\n", "case", "ops", "ns/op", "allocs/op", "ops/s");
+    for (const Result& result : results) 
+    {
+        std::printf("%-30s %12zu %12.2f %14.4f %14.0f\n",
+            result.name, result.ops, result.nsPerOp, result.allocsPerOp, result.opsPerSecond);
+    }
+    
+    if (jsonPath) 
+    {
+        std::FILE* out = std::fopen(jsonPath, "w");
+        if (!out) 
+        {
+            std::fprintf(stderr, "could not write %s\n", jsonPath);
+            return 1;
+        }
+        std::fprintf(out, "{\n  \"entities\": %zu,\n  \"platforms\": %zu,\n  \"results\": [\n", entityCount, platformCount);
+        for (std::size_t i = 0; i < results.size(); i++) 
+        {
+            const Result& result = results[i];
+            std::fprintf(out, "    {\"name\": \"%s\", \"ops\": %zu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.6f, \"ops_per_sec\": %.1f}%s\n",
+                result.name, result.ops, result.nsPerOp, result.allocsPerOp, result.opsPerSecond,
+                i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+        std::fclose(out);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,198 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "../World/World.h"
+#include "../Level/LevelFile.h"
+#include "../Net/GameClient.h"
+#include "../Net/GameServer.h"
+#include "../Net/LoopbackNetwork.h"
+
+// Runs a GameServer and N bot GameClients in one process over a simulated
+// network with latency, jitter and packet loss, in simulated time (as fast
+// as the CPU allows). Bots run, turn and jump on their own schedules.
+// Reports bytes per client per second both ways, how much delta coding
+// saves over full snapshots, the server's tick cost, and prediction
+// corrections. After the run the network turns perfect and the bots stop;
+// once the server has run every input, each client's predicted player must
+// match the server's bit for bit.
+//
+// Usage: NetworkLoopback [clients] [seconds] [loss %] [latency ms] [jitter ms] [level.lvl]
+//        (default: 64 60 5 50 10, built-in level)
+
+
+namespace
+{
+    // UDP (8) + IPv4 (20) header bytes per datagram
+    const std::uint64_t HEADER_BYTES = 28;
+    const std::uint16_t SERVER_PORT = 40000;
+    const std::uint16_t FIRST_CLIENT_PORT = 50000;
+    
+    // Deterministic per-bot input: run one way, then the other, jumping now and then
+    InputFrame botInput(std::size_t bot, unsigned long long tick)
+    {
+        unsigned long long period = 240 + bot * 37 % 300;
+        unsigned long long phase = (tick + bot * 53) % period;
+        InputFrame input;
+        input.right = phase < period / 2;
+        input.left = !input.right && phase % 7 != 0;
+        input.jump = (tick + bot * 11) % (60 + bot % 50) == 0;
+        return input;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t clientCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    double seconds = argc > 2 ? std::atof(argv[2]) : 60.0;
+    float lossPercent = argc > 3 ? static_cast<float>(std::atof(argv[3])) : 5.0f;
+    float latencyMs = argc > 4 ? static_cast<float>(std::atof(argv[4])) : 50.0f;
+    float jitterMs = argc > 5 ? static_cast<float>(std::atof(argv[5])) : 10.0f;
+    std::string levelPath = argc > 6 ? argv[6] : "";
+    if (clientCount == 0 || clientCount > NET_MAX_CLIENTS || seconds <= 0.0) 
+    {
+        std::fprintf(stderr, "clients must be 1..%zu and seconds positive\n", NET_MAX_CLIENTS);
+        return 1;
+    }
+    
+    // Server and clients each have their own copy of the level; players
+    // spawn where the server world's player starts
+    World serverWorld(100, 400);
+    World clientWorld(100, 400);
+    LevelFile level;
+    if (!levelPath.empty()) 
+    {
+        if (!level.open(levelPath)) 
+        {
+            return 1;
+        }
+        serverWorld.loadLevel(level);
+        clientWorld.loadLevel(level);
+    }
+    
+    LoopbackNetwork network(7);
+    network.lossRate = lossPercent / 100.0f;
+    network.latencySeconds = latencyMs / 1000.0f;
+    network.jitterSeconds = jitterMs / 1000.0f;
+    
+    GameServer server(serverWorld, network.endpoint(SERVER_PORT));
+    std::vector<std::unique_ptr<GameClient>> clients;
+    for (std::size_t i = 0; i < clientCount; i++) 
+    {
+        std::uint16_t port = static_cast<std::uint16_t>(FIRST_CLIENT_PORT + i);
+        clients.push_back(std::make_unique<GameClient>(clientWorld, network.endpoint(port), LoopbackNetwork::address(SERVER_PORT)));
+    }
+    
+    std::printf("%zu clients, %.0f s, %.1f%% loss, %.0f ms latency, %.0f ms jitter, snapshots every %u ticks\n",
+                clientCount, seconds, lossPercent, latencyMs, jitterMs, server.snapshotInterval);
+    
+    // Play
+    unsigned long long ticks = static_cast<unsigned long long>(seconds / World::TIMESTEP);
+    for (unsigned long long tick = 0; tick < ticks; tick++) 
+    {
+        for (std::size_t i = 0; i < clientCount; i++) 
+        {
+            clients[i]->tick(botInput(i, tick));
+        }
+        server.tick();
+        network.advance(World::TIMESTEP);
+    }
+    
+    // What a full snapshot of everyone would cost, for comparison with the deltas
+    NetSnapshot everyone;
+    for (std::size_t slot = 0; slot < NET_MAX_CLIENTS; slot++) 
+    {
+        if (const Player* player = server.getPlayer(slot)) 
+        {
+            everyone.present |= std::uint64_t(1) << slot;
+            everyone.players[slot] = NetPlayerState::capture(*player);
+        }
+    }
+    BitWriter fullWriter;
+    writeSnapshotPlayers(fullWriter, everyone, nullptr);
+    std::size_t fullBytes = fullWriter.finish().size();
+    
+    NetServerStats serverStats = server.getStats();
+    std::uint64_t corrections = 0;
+    std::uint64_t replayed = 0;
+    std::uint64_t undecodable = 0;
+    std::uint64_t clientBytesSent = 0;
+    std::uint64_t clientPacketsSent = 0;
+    double latencySum = 0.0;
+    std::size_t connected = 0;
+    for (const auto& client : clients) 
+    {
+        const NetClientStats& stats = client->getStats();
+        corrections += stats.corrections;
+        replayed += stats.replayedInputs;
+        undecodable += stats.snapshotsUndecodable;
+        clientBytesSent += stats.bytesSent;
+        clientPacketsSent += stats.packetsSent;
+        latencySum += stats.inputLatencyMs;
+        connected += client->isConnected();
+    }
+    
+    double perClient = double(clientCount) * seconds;
+    double downBytes = serverStats.bytesSent / perClient;
+    double downWire = (serverStats.bytesSent + serverStats.packetsSent * HEADER_BYTES) / perClient;
+    double upBytes = clientBytesSent / perClient;
+    double upWire = (clientBytesSent + clientPacketsSent * HEADER_BYTES) / perClient;
+    double averageSnapshot = serverStats.snapshotsSent ? double(serverStats.bytesSent) / serverStats.packetsSent : 0.0;
+    
+    std::printf("connected:          %zu / %zu\n", connected, clientCount);
+    std::printf("server -> client:   %.0f B/s payload, %.0f B/s with UDP/IP headers\n", downBytes, downWire);
+    std::printf("client -> server:   %.0f B/s payload, %.0f B/s with UDP/IP headers\n", upBytes, upWire);
+    std::printf("snapshots:          %llu sent, %.1f%% delta-coded, %.0f B average, %zu B full\n",
+                static_cast<unsigned long long>(serverStats.snapshotsSent),
+                serverStats.snapshotsSent ? 100.0 * serverStats.deltaSnapshots / serverStats.snapshotsSent : 0.0,
+                averageSnapshot, fullBytes);
+    std::printf("server tick:        %.3f ms average, %.3f ms worst (budget %.3f ms, %llu ticks over)\n",
+                serverStats.averageTickMs, serverStats.maxTickMs, World::TIMESTEP * 1000.0, 
+                static_cast<unsigned long long>(serverStats.overBudgetTicks));
+    std::printf("inputs:             %llu run, %llu client-ticks starved (%.2f%%, jitter buffer %u inputs)\n",
+                static_cast<unsigned long long>(serverStats.inputsRun), static_cast<unsigned long long>(serverStats.starvedTicks), 
+                100.0 * serverStats.starvedTicks / std::max<std::uint64_t>(1, serverStats.ticks * clientCount), 
+                server.inputDelay);
+    std::printf("prediction:         %llu corrections, %llu inputs replayed, %llu undecodable snapshots\n",
+                static_cast<unsigned long long>(corrections), static_cast<unsigned long long>(replayed),
+                static_cast<unsigned long long>(undecodable));
+    std::printf("input round trip:   %.1f ms average\n", latencySum / clientCount);
+    std::printf("network:            %zu datagrams, %zu dropped\n", network.datagramsSent, network.datagramsDropped);
+    
+    // Settle: a perfect network fills every gap in the inputs the server
+    // has, then the bots stop and the server runs what is still in flight
+    network.lossRate = 0.0f;
+    network.jitterSeconds = 0.0f;
+    for (int tick = 0; tick < 120; tick++) 
+    {
+        for (const auto& client : clients) 
+        {
+            client->tick(InputFrame());
+        }
+        server.tick();
+        network.advance(World::TIMESTEP);
+    }
+    for (int tick = 0; tick < 120; tick++) 
+    {
+        server.tick();
+        network.advance(World::TIMESTEP);
+    }
+    
+    std::size_t mismatches = 0;
+    for (const auto& client : clients) 
+    {
+        const Player* authoritative = server.getPlayer(client->getSlot());
+        if (!client->isConnected() || !authoritative ||
+            NetPlayerState::capture(client->getPlayer()) != NetPlayerState::capture(*authoritative))
+        {
+            mismatches++;
+        }
+    }
+    std::printf("converged:          %zu / %zu clients match the server\n", clientCount - mismatches, clientCount);
+    return mismatches == 0 ? 0 : 1;
+}
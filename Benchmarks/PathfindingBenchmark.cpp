@@ -0,0 +1,168 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../Nav/NavGraph.h"
+#include "../Nav/PathCache.h"
+#include "../Nav/PathFinder.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Platform/Platform.h"
+
+// Path queries per second on one core over a generated level: a chain of
+// ledges 80-140 px apart that wanders up and down in steps of up to two
+// 70 px rises (one jump climbs at most one), over a floor running the
+// whole width. Every ledge can be dropped from; climbing needs the right
+// sequence of jumps, so routes go up and down and back.
+//   build  - NavGraph::build() from the platform grid
+//   raw    - PathFinder::findPath() between random standing points
+//   cached - a crowd of agents on random spans asking PathCache for a route
+//            to a target that moves to a new span every 60 frames, as
+//            EnemyNavigator does every tick
+// The target is 5000 queries per second on one core.
+//
+// Usage: PathfindingBenchmark [columns] [queries] [agents]   (default: 1000 20000 1000)
+
+
+namespace
+{
+    const double TARGET_QUERIES_PER_SECOND = 5000.0;
+    
+    std::vector<Platform> makeLevel(int columns, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> widthDist(150.0f, 300.0f);
+        std::uniform_real_distribution<float> gapDist(80.0f, 140.0f);
+        std::uniform_int_distribution<int> stepDist(-2, 2);
+        
+        std::vector<Platform> platforms;
+        float levelWidth = columns * 300.0f;
+        platforms.emplace_back(0.0f, 1000.0f, levelWidth, 50.0f, sf::Color::White);   // Ground
+        int level = 1;
+        for (float x = 100.0f; x < levelWidth; ) 
+        {
+            float width = widthDist(rng);
+            platforms.emplace_back(x, 1000.0f - 70.0f * level, width, 20.0f, sf::Color::White);
+            x += width + gapDist(rng);
+            level = std::clamp(level + stepDist(rng), 1, 10);
+        }
+        return platforms;
+    }
+    
+    struct StandingPoint
+    {
+        std::uint32_t span;
+        float x;
+    };
+    
+    StandingPoint randomPoint(const NavGraph& graph, std::mt19937& rng)
+    {
+        std::uniform_int_distribution<std::uint32_t> spanDist(0, static_cast<std::uint32_t>(graph.spanCount() - 1));
+        std::uint32_t span = spanDist(rng);
+        const NavSpan& s = graph.getSpan(span);
+        std::uniform_real_distribution<float> xDist(s.left, s.right);
+        return StandingPoint{ span, xDist(rng) };
+    }
+    
+    double seconds(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    int columns = argc > 1 ? std::atoi(argv[1]) : 1000;
+    std::size_t queries = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20000;
+    std::size_t agents = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1000;
+    if (columns <= 0 || queries == 0 || agents == 0) 
+    {
+        std::fprintf(stderr, "columns, queries and agents must be positive\n");
+        return 1;
+    }
+    
+    std::mt19937 rng(23);
+    std::vector<Platform> platforms = makeLevel(columns, rng);
+    SpatialGrid grid;
+    grid.build(platforms);
+    
+    NavGraph graph;
+    auto buildStart = std::chrono::steady_clock::now();
+    graph.build(grid);
+    double buildSeconds = seconds(buildStart);
+    if (graph.spanCount() == 0) 
+    {
+        std::fprintf(stderr, "generated level has no walkable spans\n");
+        return 1;
+    }
+    
+    // Raw searches between random standing points
+    std::vector<StandingPoint> starts(queries);
+    std::vector<StandingPoint> goals(queries);
+    for (std::size_t q = 0; q < queries; q++) 
+    {
+        starts[q] = randomPoint(graph, rng);
+        goals[q] = randomPoint(graph, rng);
+    }
+    PathFinder pathFinder;
+    std::vector<std::uint32_t> path;
+    std::size_t found = 0;
+    std::size_t expanded = 0;
+    std::size_t links = 0;
+    auto rawStart = std::chrono::steady_clock::now();
+    for (std::size_t q = 0; q < queries; q++) 
+    {
+        if (pathFinder.findPath(graph, starts[q].span, starts[q].x, goals[q].span, goals[q].x, path)) 
+        {
+            found++;
+            links += path.size();
+        }
+        expanded += pathFinder.getExpanded();
+    }
+    double rawSeconds = seconds(rawStart);
+    
+    // A crowd asking for routes every frame through the shared cache
+    std::vector<StandingPoint> crowd(agents);
+    for (StandingPoint& agent : crowd) 
+    {
+        agent = randomPoint(graph, rng);
+    }
+    PathCache cache;
+    std::size_t cachedQueries = 0;
+    std::size_t routed = 0;
+    StandingPoint target = randomPoint(graph, rng);
+    auto cachedStart = std::chrono::steady_clock::now();
+    for (std::size_t frame = 0; cachedQueries < queries * 10; frame++) 
+    {
+        if (frame % 60 == 0) 
+        {
+            target = randomPoint(graph, rng);
+        }
+        for (const StandingPoint& agent : crowd) 
+        {
+            routed += cache.find(graph, pathFinder, agent.span, agent.x, target.span, target.x).found;
+        }
+        cachedQueries += agents;
+    }
+    double cachedSeconds = seconds(cachedStart);
+    PathCacheStats stats = cache.getStats();
+    
+    double rawRate = queries / rawSeconds;
+    double cachedRate = cachedQueries / cachedSeconds;
+    std::printf("platforms:         %zu\n", platforms.size());
+    std::printf("graph:             %zu spans, %zu links\n", graph.spanCount(), graph.linkCount());
+    std::printf("build:             %.2f ms\n", buildSeconds * 1000.0);
+    std::printf("raw queries:       %zu (%.1f%% found, %.1f links, %.1f nodes expanded on average)\n",
+                queries, 100.0 * found / queries, found ? double(links) / found : 0.0, double(expanded) / queries);
+    std::printf("raw A*:            %.0f queries/s (%.2f us each)\n", rawRate, rawSeconds * 1e6 / queries);
+    std::printf("cached queries:    %zu (%.1f%% routed, %zu searches)\n",
+                cachedQueries, 100.0 * routed / cachedQueries, stats.misses);
+    std::printf("cached:            %.0f queries/s (%.3f us each)\n", cachedRate, cachedSeconds * 1e6 / cachedQueries);
+    std::printf("target:            %.0f queries/s on one core (%s)\n",
+                TARGET_QUERIES_PER_SECOND, rawRate >= TARGET_QUERIES_PER_SECOND ? "met" : "MISSED");
+    
+    return rawRate >= TARGET_QUERIES_PER_SECOND ? 0 : 1;
+}
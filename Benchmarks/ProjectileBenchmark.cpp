@@ -0,0 +1,305 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "../Jobs/JobSystem.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Platform/Platform.h"
+#include "../Projectile/ProjectilePool.h"
+
+// Projectile stress test: a long level of ledges with a crowd of enemies
+// and a player standing on them, and emitters (most of them enemies, a few
+// player slashes) that keep the pool at a fixed number of live projectiles
+// by refiring as fast as projectiles hit or fizzle out. Each tick rebuilds
+// the entity grid and runs ProjectilePool::update(), timed serially and
+// then on a job system from the same starting state.
+//   check - the first ticks are repeated with single-cell grids (every
+//           cast tests every box) and must give the same hits and state
+//   serial / parallel - ms per tick; both runs must end in the same state
+//           (on a single core the job system run is only reported as a
+//           second serial run, with no speedup)
+// The target is 20000 live projectiles in under 2 ms per tick on one core.
+// It is reported but does not affect the exit code, which is non-zero only
+// if the check or the state hashes disagree.
+//
+// Usage: ProjectileBenchmark [projectiles] [ticks] [enemies]   (default: 20000 600 2000)
+
+
+namespace
+{
+    const double TARGET_MS_PER_TICK = 2.0;
+    const float DELTA_TIME = 1.0f / 120.0f;
+    const std::size_t CHECK_TICKS = 30;
+    
+    struct Emitter
+    {
+        sf::Vector2f position;
+        ProjectileKind kind;
+        ProjectileOwner owner;
+        float aim;  // Direction of fire in radians
+    };
+    
+    struct Scene
+    {
+        std::vector<Platform> platforms;
+        AabbArrays entities;  // Player first, then the enemies
+        std::vector<Emitter> emitters;
+    };
+    
+    Scene makeScene(std::size_t enemyCount, std::mt19937& rng)
+    {
+        Scene scene;
+        const float levelWidth = 16000.0f;
+        std::vector<sf::FloatRect> ledges;
+        scene.platforms.emplace_back(0.0f, 1000.0f, levelWidth, 50.0f, sf::Color::White);   // Ground
+        ledges.push_back(sf::FloatRect(sf::Vector2f(0.0f, 1000.0f), sf::Vector2f(levelWidth, 50.0f)));
+        std::uniform_real_distribution<float> widthDist(100.0f, 300.0f);
+        std::uniform_real_distribution<float> gapDist(60.0f, 200.0f);
+        std::uniform_int_distribution<int> levelDist(1, 8);
+        for (float x = 50.0f; x < levelWidth; ) 
+        {
+            float width = widthDist(rng);
+            float top = 1000.0f - 90.0f * levelDist(rng);
+            scene.platforms.emplace_back(x, top, width, 20.0f, sf::Color::White);
+            ledges.push_back(sf::FloatRect(sf::Vector2f(x, top), sf::Vector2f(width, 20.0f)));
+            x += width + gapDist(rng);
+        }
+        
+        // Everyone stands on the ground or on a random ledge
+        std::uniform_int_distribution<std::size_t> ledgeDist(0, ledges.size() - 1);
+        std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+        for (std::size_t i = 0; i <= enemyCount; i++) 
+        {
+            const sf::FloatRect& ledge = ledges[ledgeDist(rng)];
+            float x = i == 0 ? levelWidth * 0.5f : ledge.position.x + unitDist(rng) * ledge.size.x;
+            float feet = i == 0 ? 1000.0f : ledge.position.y;
+            scene.entities.push(sf::FloatRect(sf::Vector2f(x - 20.0f, feet - 60.0f), sf::Vector2f(40.0f, 60.0f)));
+        }
+        
+        // One emitter per 10 enemies, all aiming at the player, plus the player's slashes
+        sf::Vector2f player(scene.entities.minX[0] + 20.0f, scene.entities.minY[0] + 30.0f);
+        for (std::size_t i = 1; i <= enemyCount; i += 10) 
+        {
+            bool bolt = unitDist(rng) < 0.3f;
+            sf::Vector2f mouth(scene.entities.minX[i] + 20.0f, scene.entities.minY[i] + 20.0f);
+            mouth.x += mouth.x < player.x ? 30.0f : -30.0f;
+            scene.emitters.push_back(Emitter{
+                mouth, bolt ? ProjectileKind::MAGIC_BOLT : ProjectileKind::FIREBALL, ProjectileOwner::ENEMY,
+                std::atan2(player.y - mouth.y, player.x - mouth.x)
+            });
+        }
+        scene.emitters.push_back(Emitter{
+            sf::Vector2f(scene.entities.maxX[0] + 20.0f, scene.entities.minY[0] + 30.0f),
+            ProjectileKind::SLASH, ProjectileOwner::PLAYER, 0.0f
+        });
+        return scene;
+    }
+    
+    // Tops the pool back up to its target, a burst from one emitter at a
+    // time, the way attacks come out of an enemy
+    void refill(ProjectilePool& pool, std::size_t target, const Scene& scene, std::mt19937& rng, std::size_t& nextEmitter)
+    {
+        std::uniform_real_distribution<float> speedDist(300.0f, 900.0f);
+        std::uniform_real_distribution<float> spreadDist(-0.1f, 0.1f);
+        while (pool.size() < target) 
+        {
+            const Emitter& emitter = scene.emitters[nextEmitter];
+            nextEmitter = (nextEmitter + 1) % scene.emitters.size();
+            for (int shot = 0; shot < 8 && pool.size() < target; shot++) 
+            {
+                float angle = emitter.aim + spreadDist(rng);
+                float speed = speedDist(rng);
+                pool.spawn(emitter.kind, emitter.owner, emitter.position,
+                           sf::Vector2f(std::cos(angle) * speed, std::sin(angle) * speed));
+            }
+        }
+    }
+    
+    std::uint64_t hashPool(const ProjectilePool& pool)
+    {
+        std::uint64_t hash = 14695981039346656037ULL;
+        for (const std::vector<float>* column : { &pool.positionX, &pool.positionY, &pool.velocityX, &pool.velocityY }) 
+        {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(column->data());
+            for (std::size_t i = 0; i < pool.size() * sizeof(float); i++) 
+            {
+                hash = (hash ^ bytes[i]) * 1099511628211ULL;
+            }
+        }
+        return hash;
+    }
+    
+    // update() orders the pool by the platform grid's cells, so pools run
+    // against different grids are compared as sets
+    std::vector<std::array<float, 4>> liveSet(const ProjectilePool& pool)
+    {
+        std::vector<std::array<float, 4>> live(pool.size());
+        for (std::size_t i = 0; i < pool.size(); i++) 
+        {
+            live[i] = { pool.positionX[i], pool.positionY[i], pool.velocityX[i], pool.velocityY[i] };
+        }
+        std::sort(live.begin(), live.end());
+        return live;
+    }
+    
+    std::vector<std::tuple<std::uint32_t, float, float, int, int>> hitSet(const std::vector<ProjectileHit>& hits)
+    {
+        std::vector<std::tuple<std::uint32_t, float, float, int, int>> set;
+        for (const ProjectileHit& hit : hits) 
+        {
+            set.emplace_back(hit.target, hit.position.x, hit.position.y, int(hit.kind), int(hit.owner));
+        }
+        std::sort(set.begin(), set.end());
+        return set;
+    }
+    
+    struct RunResult
+    {
+        double seconds = 0.0;
+        std::uint64_t hash = 0;
+        std::size_t levelHits = 0;
+        std::size_t entityHits = 0;
+        ProjectileStats stats;
+    };
+    
+    // Runs ticks from the saved pool state with the same refill sequence every time
+    RunResult run(ProjectilePool& pool, const std::vector<std::uint8_t>& start, std::size_t target, const Scene& scene,
+                  const SpatialGrid& platformGrid, SpatialGrid& entityGrid, int ticks, JobSystem* jobs)
+    {
+        pool.readState(start.data(), start.size());
+        pool.resetStats();
+        std::mt19937 rng(25);
+        std::size_t nextEmitter = 0;
+        std::vector<ProjectileHit> hits;
+        RunResult result;
+        for (int tick = 0; tick < ticks; tick++) 
+        {
+            refill(pool, target, scene, rng, nextEmitter);
+            auto tickStart = std::chrono::steady_clock::now();
+            entityGrid.build(scene.entities);
+            if (jobs) 
+            {
+                pool.update(DELTA_TIME, platformGrid, entityGrid, 1, hits, *jobs);
+            }
+            else 
+            {
+                pool.update(DELTA_TIME, platformGrid, entityGrid, 1, hits);
+            }
+            result.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - tickStart).count();
+            for (const ProjectileHit& hit : hits) 
+            {
+                (hit.target == ProjectileHit::LEVEL ? result.levelHits : result.entityHits)++;
+            }
+        }
+        result.hash = hashPool(pool);
+        result.stats = pool.getStats();
+        return result;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t target = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    int ticks = argc > 2 ? std::atoi(argv[2]) : 600;
+    std::size_t enemyCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 2000;
+    if (target == 0 || ticks <= 0 || enemyCount == 0) 
+    {
+        std::fprintf(stderr, "projectiles, ticks and enemies must be positive\n");
+        return 1;
+    }
+    
+    std::mt19937 rng(25);
+    Scene scene = makeScene(enemyCount, rng);
+    SpatialGrid platformGrid;
+    platformGrid.build(scene.platforms);
+    SpatialGrid entityGrid;
+    
+    // Fill the pool and let it settle into a steady mix of ages
+    ProjectilePool pool(target);
+    {
+        std::size_t nextEmitter = 0;
+        std::vector<ProjectileHit> hits;
+        for (int tick = 0; tick < 240; tick++) 
+        {
+            refill(pool, target, scene, rng, nextEmitter);
+            entityGrid.build(scene.entities);
+            pool.update(DELTA_TIME, platformGrid, entityGrid, 1, hits);
+        }
+    }
+    std::vector<std::uint8_t> start(pool.stateSize());
+    pool.writeState(start.data());
+    
+    // Same ticks with single-cell grids: every cast sees every box
+    bool checked = true;
+    {
+        ProjectilePool bruteForce(target);
+        SpatialGrid allPlatforms(1.0e9f);
+        allPlatforms.build(scene.platforms);
+        SpatialGrid allEntities(1.0e9f);
+        allEntities.build(scene.entities);
+        bruteForce.readState(start.data(), start.size());
+        pool.readState(start.data(), start.size());
+        std::mt19937 gridRng(7);
+        std::mt19937 bruteRng(7);
+        std::size_t gridEmitter = 0;
+        std::size_t bruteEmitter = 0;
+        std::vector<ProjectileHit> gridHits;
+        std::vector<ProjectileHit> bruteHits;
+        for (std::size_t tick = 0; tick < CHECK_TICKS && checked; tick++) 
+        {
+            refill(pool, target, scene, gridRng, gridEmitter);
+            refill(bruteForce, target, scene, bruteRng, bruteEmitter);
+            entityGrid.build(scene.entities);
+            pool.update(DELTA_TIME, platformGrid, entityGrid, 1, gridHits);
+            bruteForce.update(DELTA_TIME, allPlatforms, allEntities, 1, bruteHits);
+            checked = hitSet(gridHits) == hitSet(bruteHits) && liveSet(pool) == liveSet(bruteForce);
+        }
+    }
+    
+    RunResult serial = run(pool, start, target, scene, platformGrid, entityGrid, ticks, nullptr);
+    JobSystem jobs;
+    RunResult parallel = run(pool, start, target, scene, platformGrid, entityGrid, ticks, &jobs);
+    
+    double serialMs = serial.seconds * 1000.0 / ticks;
+    double parallelMs = parallel.seconds * 1000.0 / ticks;
+    const ProjectileStats& stats = serial.stats;
+    std::size_t lookups = stats.queries + stats.queriesReused;
+    std::printf("scene:             %zu platforms, %zu entities, %zu emitters\n",
+                scene.platforms.size(), scene.entities.size(), scene.emitters.size());
+    std::printf("live projectiles:  %zu\n", target);
+    std::printf("casts:             %zu (%.1f%% of grid lookups served by an earlier query)\n",
+                stats.casts, lookups ? 100.0 * stats.queriesReused / lookups : 0.0);
+    std::printf("hits per tick:     %.1f level, %.1f entity, %.1f expired\n",
+                double(serial.levelHits) / ticks, double(serial.entityHits) / ticks, double(stats.expired) / ticks);
+    std::printf("brute-force check: %s (%zu ticks)\n", checked ? "match" : "MISMATCH", CHECK_TICKS);
+    std::printf("serial:            %.3f ms/tick (%.1f ns per cast)\n", serialMs, serial.seconds * 1e9 / stats.casts);
+    if (jobs.threadCount() > 1) 
+    {
+        std::printf("parallel:          %.3f ms/tick on %zu threads (%.2fx)\n",
+                    parallelMs, jobs.threadCount(), serialMs / parallelMs);
+    }
+    else 
+    {
+        // The job system runs every chunk inline on one thread, so this was
+        // just a second serial run and there is no speedup to report
+        std::printf("serial via jobs:   %.3f ms/tick (1 thread, nothing ran in parallel)\n", parallelMs);
+    }
+    std::printf("state hash:        %016llx serial, %016llx job system (%s)\n",
+                static_cast<unsigned long long>(serial.hash), static_cast<unsigned long long>(parallel.hash),
+                serial.hash == parallel.hash ? "match" : "MISMATCH");
+    std::printf("target:            %.1f ms/tick for %zu projectiles on one core (%s)\n",
+                TARGET_MS_PER_TICK, target, serialMs <= TARGET_MS_PER_TICK ? "met" : "MISSED");
+    
+    // Timing depends on the machine; only correctness decides the exit code
+    bool passed = checked && serial.hash == parallel.hash;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "../World/World.h"
+#include "../World/WorldState.h"
+#include "../Level/LevelFile.h"
+
+// Rollback netcode worst case: every frame simulates one new tick, then acts
+// as if the input for the tick 8 ticks back arrived late, restores the state
+// saved before it and re-simulates the 8 ticks, saving each again as a
+// rollback implementation would. Enemies are despawned and respawned as it
+// runs so handle slots are recycled across rollbacks. The re-simulated world
+// must match the original checksum every frame.
+//
+// Reports the state size, save cost (which includes World::checksum()),
+// restore cost, and the time of a whole rollback frame (restore, 8 ticks and
+// 7 saves) against a 13 ms budget. Finally a save-state is written to
+// disk, read back and restored into a fresh world built the same way.
+//
+// Usage: RollbackBenchmark [enemies] [frames] [level.lvl]   (default: 2000 600, built-in level)
+
+
+namespace
+{
+    const int ROLLBACK_TICKS = 8;
+    const int HISTORY = ROLLBACK_TICKS + 1;
+    const double FRAME_BUDGET_MS = 13.0;
+    const float ENEMY_SPACING = 40.0f;
+    
+    // Same input for the same tick, however many times it is re-simulated
+    InputFrame inputFor(unsigned long long tick)
+    {
+        unsigned long long phase = tick % 300;
+        InputFrame input;
+        input.right = phase < 140;
+        input.left = phase >= 150 && phase < 290;
+        input.jump = tick % 97 < 3;
+        return input;
+    }
+    
+    // One tick, including a deterministic despawn/respawn so the slot tables change
+    void simulateTick(World& world)
+    {
+        unsigned long long tick = world.tickCount;
+        if (tick % 4 == 0 && world.enemies.size() > 0) 
+        {
+            std::size_t victim = static_cast<std::size_t>(tick * 2654435761ULL % world.enemies.size());
+            world.enemies.despawn(world.enemies.handleAt(victim));
+            float x = world.enemies.positionX[tick * 40503ULL % world.enemies.size()];
+            world.enemies.spawn(static_cast<EnemyType>(tick % static_cast<unsigned long long>(EnemyType::COUNT)),
+                                sf::Vector2f(x, 0.0f));
+        }
+        world.step(inputFor(tick));
+    }
+    
+    void populate(World& world, std::size_t enemyCount)
+    {
+        std::mt19937 rng(21);
+        // Spread out as a level would have them, not piled onto one screen
+        std::uniform_real_distribution<float> xDist(0.0f, std::max(world.worldWidth, enemyCount * ENEMY_SPACING));
+        std::uniform_real_distribution<float> yDist(0.0f, 500.0f);
+        std::uniform_real_distribution<float> speedDist(-60.0f, 60.0f);
+        std::uniform_int_distribution<int> typeDist(0, static_cast<int>(EnemyType::COUNT) - 1);
+        for (std::size_t i = 0; i < enemyCount; i++) 
+        {
+            world.enemies.spawn(static_cast<EnemyType>(typeDist(rng)), sf::Vector2f(xDist(rng), yDist(rng)),
+                                sf::Vector2f(speedDist(rng), 0.0f));
+        }
+    }
+    
+    double millisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t enemyCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+    int frames = std::max(argc > 2 ? std::atoi(argv[2]) : 600, ROLLBACK_TICKS + 1);
+    std::string levelPath = argc > 3 ? argv[3] : "";
+    
+    LevelFile level;
+    if (!levelPath.empty() && !level.open(levelPath)) 
+    {
+        return 1;
+    }
+    auto build = [&](World& world)
+    {
+        if (!levelPath.empty()) 
+        {
+            world.loadLevel(level);
+        }
+        populate(world, enemyCount);
+    };
+    
+    World world(100, 400);
+    build(world);
+    
+    std::vector<WorldState> history(HISTORY);
+    double saveMs = 0.0;
+    double restoreMs = 0.0;
+    std::size_t saves = 0;
+    std::size_t restores = 0;
+    std::vector<double> frameMs;
+    std::size_t mismatches = 0;
+    
+    for (int frame = 0; frame < frames; frame++) 
+    {
+        // The new tick, saved first like every tick of a rollback session
+        auto start = std::chrono::steady_clock::now();
+        world.saveState(history[world.tickCount % HISTORY]);
+        saveMs += millisecondsSince(start);
+        saves++;
+        simulateTick(world);
+        
+        if (world.tickCount < ROLLBACK_TICKS) 
+        {
+            continue;
+        }
+        std::uint64_t expected = world.checksum();
+        unsigned long long now = world.tickCount;
+        
+        // Late input for tick now - 8: back up and run the 8 ticks again
+        auto frameStart = std::chrono::steady_clock::now();
+        start = frameStart;
+        const WorldState& rewind = history[(now - ROLLBACK_TICKS) % HISTORY];
+        if (!world.restoreState(rewind)) 
+        {
+            std::printf("restore failed at tick %llu\n", now);
+            return 1;
+        }
+        restoreMs += millisecondsSince(start);
+        restores++;
+        mismatches += world.checksum() != rewind.getChecksum();
+        while (world.tickCount < now) 
+        {
+            if (world.tickCount != now - ROLLBACK_TICKS) 
+            {
+                world.saveState(history[world.tickCount % HISTORY]);
+            }
+            simulateTick(world);
+        }
+        frameMs.push_back(millisecondsSince(frameStart));
+        mismatches += world.checksum() != expected;
+    }
+    
+    // Save-state round trip through a file into a second, identically built world
+    WorldState saved;
+    world.saveState(saved);
+    const std::string statePath = "rollback_benchmark.sav";
+    WorldState loaded;
+    World other(100, 400);
+    build(other);
+    bool roundTrip = saved.saveToFile(statePath) && loaded.loadFromFile(statePath) &&
+                     other.restoreState(loaded) && other.checksum() == world.checksum();
+    std::remove(statePath.c_str());
+    if (roundTrip) 
+    {
+        for (int t = 0; t < 120; t++) 
+        {
+            simulateTick(world);
+            simulateTick(other);
+        }
+        roundTrip = other.checksum() == world.checksum();
+    }
+    
+    std::sort(frameMs.begin(), frameMs.end());
+    double total = 0.0;
+    for (double ms : frameMs) 
+    {
+        total += ms;
+    }
+    std::size_t overBudget = frameMs.end() - std::upper_bound(frameMs.begin(), frameMs.end(), FRAME_BUDGET_MS);
+    
+    std::printf("enemies: %zu   state: %zu bytes\n", world.enemies.size(), saved.bytes.size());
+    std::printf("save:    %.2f us avg\n", saveMs * 1000.0 / saves);
+    std::printf("restore: %.2f us avg\n", restoreMs * 1000.0 / restores);
+    std::printf("rollback of %d ticks: %.3f ms avg, %.3f ms p99, %.3f ms max (%zu of %zu over %.0f ms)\n",
+                ROLLBACK_TICKS, total / frameMs.size(), frameMs[frameMs.size() * 99 / 100], frameMs.back(),
+                overBudget, frameMs.size(), FRAME_BUDGET_MS);
+    std::printf("checksum mismatches after restore or re-simulation: %zu\n", mismatches);
+    std::printf("save-state file round trip: %s\n", roundTrip ? "ok" : "FAILED");
+    return mismatches == 0 && roundTrip ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include "../Animation/Animation.h"
+#include "../Animation/TextureCache.h"
+#include "../Render/SpriteBatch.h"
+
+// Draw calls and frame time for N animated sprites, drawn one sf::Sprite at
+// a time versus through SpriteBatch. Needs a display (opens a window).
+//
+// Usage: SpriteBatchBenchmark [sprites] [frames] [sheet]
+//        (default: 5000 300 assets/Player/WALK.png)
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t spriteCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 5000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 300;
+    std::string sheet = argc > 3 ? argv[3] : "assets/Player/WALK.png";
+    
+    sf::RenderWindow window(sf::VideoMode(sf::Vector2u(800, 600)), "SpriteBatch benchmark");
+    window.setVerticalSyncEnabled(false);
+    
+    ClipHandle clip = TextureCache::global().getClip(sheet, sf::Vector2u(96, 84), 7, 12.0f);
+    if (!clip) 
+    {
+        return 1;
+    }
+    
+    // Scatter animations with random phase and facing
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> xDist(0.0f, 800.0f);
+    std::uniform_real_distribution<float> yDist(0.0f, 600.0f);
+    std::uniform_real_distribution<float> phase(0.0f, 1.0f);
+    std::vector<Animation> animations(spriteCount);
+    for (std::size_t i = 0; i < spriteCount; i++) 
+    {
+        animations[i].setClip(clip);
+        animations[i].setOrigin(sf::Vector2f(48.0f, 42.0f));
+        animations[i].setPosition(sf::Vector2f(xDist(rng), yDist(rng)));
+        animations[i].setScale(sf::Vector2f(i % 2 ? -1.0f : 1.0f, 1.0f));
+        animations[i].update(phase(rng));
+    }
+    
+    SpriteBatch batch;
+    const char* modes[] = { "sf::Sprite", "SpriteBatch" };
+    
+    std::printf("%-12s %10s %14s %12s\n", "mode", "sprites", "draws/frame", "ms/frame");
+    for (int mode = 0; mode < 2 && window.isOpen(); mode++) 
+    {
+        unsigned int drawCalls = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames && window.isOpen(); f++) 
+        {
+            while (const std::optional event = window.pollEvent()) 
+            {
+                if (event->is<sf::Event::Closed>()) 
+                    window.close();
+            }
+            
+            for (auto& animation : animations) 
+            {
+                animation.update(1.0f / 75.0f);
+            }
+            
+            window.clear(sf::Color(135, 206, 235));
+            if (mode == 0) 
+            {
+                for (const auto& animation : animations) 
+                {
+                    window.draw(animation.getSprite());
+                }
+                drawCalls = static_cast<unsigned int>(animations.size());
+            }
+            else 
+            {
+                batch.begin();
+                for (const auto& animation : animations) 
+                {
+                    animation.emit(batch);
+                }
+                batch.flush(window);
+                drawCalls = batch.drawCalls;
+            }
+            window.display();
+        }
+        auto end = std::chrono::steady_clock::now();
+        
+        double ms = std::chrono::duration<double, std::milli>(end - start).count() / frames;
+        std::printf("%-12s %10zu %14u %12.3f\n", modes[mode], spriteCount, drawCalls, ms);
+    }
+    
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../Physics/AabbKernel.h"
+#include "../Physics/SweepAndPrune.h"
+
+// Per-frame cost of finding every overlapping pair among moving entities.
+// Entities wander a 20000x1000 strip (level-like: wide, not tall) at up to
+// 200 px/s, bouncing off its edges, for the given number of 120 Hz frames:
+//   incremental - SweepAndPrune repairing last frame's order (insertion sort)
+//   full sort   - SweepAndPrune cleared every frame (std::sort from scratch)
+//   brute force - every pair tested, timed on a few frames only
+// The pair sets of all three must agree.
+//
+// Usage: SweepAndPruneBenchmark [entities] [frames]   (default: 10000 600)
+
+
+namespace
+{
+    // Pairs in a canonical order for comparison
+    std::vector<std::uint64_t> sortedKeys(const std::vector<EntityPair>& pairs)
+    {
+        std::vector<std::uint64_t> keys;
+        keys.reserve(pairs.size());
+        for (const EntityPair& pair : pairs) 
+        {
+            keys.push_back((std::uint64_t(pair.first) << 32) | pair.second);
+        }
+        std::sort(keys.begin(), keys.end());
+        return keys;
+    }
+    
+    void bruteForce(const AabbArrays& boxes, std::vector<EntityPair>& pairs)
+    {
+        pairs.clear();
+        std::uint32_t count = static_cast<std::uint32_t>(boxes.size());
+        for (std::uint32_t a = 0; a < count; a++) 
+        {
+            for (std::uint32_t b = a + 1; b < count; b++) 
+            {
+                if (boxes.minX[a] < boxes.maxX[b] && boxes.minX[b] < boxes.maxX[a] && 
+                    boxes.minY[a] < boxes.maxY[b] && boxes.minY[b] < boxes.maxY[a]) 
+                {
+                    pairs.push_back(EntityPair{ a, b });
+                }
+            }
+        }
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t entityCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 600;
+    if (entityCount == 0 || frames <= 0) 
+    {
+        std::fprintf(stderr, "entities and frames must be positive\n");
+        return 1;
+    }
+    
+    const float deltaTime = 1.0f / 120.0f;
+    const sf::Vector2f area(20000.0f, 1000.0f);
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> xDist(0.0f, area.x);
+    std::uniform_real_distribution<float> yDist(0.0f, area.y);
+    std::uniform_real_distribution<float> speedDist(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> sizeDist(30.0f, 60.0f);
+    
+    std::vector<sf::FloatRect> bodies(entityCount);
+    std::vector<sf::Vector2f> velocities(entityCount);
+    for (std::size_t i = 0; i < entityCount; i++) 
+    {
+        bodies[i] = sf::FloatRect(sf::Vector2f(xDist(rng), yDist(rng)), sf::Vector2f(sizeDist(rng), sizeDist(rng)));
+        velocities[i] = sf::Vector2f(speedDist(rng), speedDist(rng));
+    }
+    
+    SweepAndPrune incremental;
+    SweepAndPrune fullSort;
+    AabbArrays boxes;
+    std::vector<EntityPair> brutePairs;
+    
+    double incrementalMs = 0.0;
+    double fullSortMs = 0.0;
+    double bruteMs = 0.0;
+    int bruteFrames = 0;
+    std::size_t totalSwaps = 0;
+    std::size_t totalTests = 0;
+    std::size_t totalPairs = 0;
+    bool consistent = true;
+    
+    for (int f = 0; f < frames; f++) 
+    {
+        for (std::size_t i = 0; i < entityCount; i++) 
+        {
+            bodies[i].position += velocities[i] * deltaTime;
+            if (bodies[i].position.x < 0.0f || bodies[i].position.x > area.x) 
+            {
+                velocities[i].x = -velocities[i].x;
+            }
+            if (bodies[i].position.y < 0.0f || bodies[i].position.y > area.y) 
+            {
+                velocities[i].y = -velocities[i].y;
+            }
+        }
+        boxes.assign(bodies.data(), bodies.size());
+        
+        auto start = std::chrono::steady_clock::now();
+        incremental.update(boxes);
+        auto middle = std::chrono::steady_clock::now();
+        fullSort.clear();
+        fullSort.update(boxes);
+        auto end = std::chrono::steady_clock::now();
+        
+        incrementalMs += std::chrono::duration<double, std::milli>(middle - start).count();
+        fullSortMs += std::chrono::duration<double, std::milli>(end - middle).count();
+        if (f > 0) 
+        {
+            totalSwaps += incremental.swaps; // The first frame sorts from scratch
+        }
+        totalTests += incremental.tests;
+        totalPairs += incremental.getPairs().size();
+        
+        // Brute force is O(n^2); check the first, middle and last frames
+        if (f == 0 || f == frames / 2 || f == frames - 1) 
+        {
+            auto bruteStart = std::chrono::steady_clock::now();
+            bruteForce(boxes, brutePairs);
+            bruteMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - bruteStart).count();
+            bruteFrames++;
+            
+            std::vector<std::uint64_t> expected = sortedKeys(brutePairs);
+            consistent &= sortedKeys(incremental.getPairs()) == expected;
+            consistent &= sortedKeys(fullSort.getPairs()) == expected;
+        }
+    }
+    
+    std::printf("entities:          %zu\n", entityCount);
+    std::printf("frames:            %d\n", frames);
+    std::printf("pairs per frame:   %.1f\n", double(totalPairs) / frames);
+    std::printf("tests per frame:   %.1f (brute force: %zu)\n", double(totalTests) / frames, entityCount * (entityCount - 1) / 2);
+    std::printf("swaps per frame:   %.1f\n", frames > 1 ? double(totalSwaps) / (frames - 1) : 0.0);
+    std::printf("incremental:       %.3f ms/frame\n", incrementalMs / frames);
+    std::printf("full sort:         %.3f ms/frame\n", fullSortMs / frames);
+    std::printf("brute force:       %.3f ms/frame\n", bruteMs / bruteFrames);
+    std::printf("pair sets:         %s\n", consistent ? "match" : "DIFFER");
+    
+    return consistent ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../Animation/TextureCache.h"
+#include "../Player/Player.h"
+
+// Load time and texture memory for N identical animated characters, comparing
+// one texture per Animation (the old behaviour) with the shared TextureCache.
+//
+// Usage: TextureCacheBenchmark [characters] [assetPath]   (default: 500 assets/Player/)
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t characters = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500;
+    std::string basePath = argc > 2 ? argv[2] : "assets/Player/";
+    const char* sheets[] = { "IDLE.png", "WALK.png", "RUN.png", "JUMP.png" };
+    
+    // Old path: every animation decodes and uploads its own copy
+    std::size_t legacyBytes = 0;
+    auto legacyStart = std::chrono::steady_clock::now();
+    {
+        std::vector<sf::Texture> textures(characters * 4);
+        for (std::size_t i = 0; i < textures.size(); i++) 
+        {
+            if (!textures[i].loadFromFile(basePath + sheets[i % 4])) 
+            {
+                std::fprintf(stderr, "Failed to load %s%s\n", basePath.c_str(), sheets[i % 4]);
+                return 1;
+            }
+            legacyBytes += static_cast<std::size_t>(textures[i].getSize().x) * textures[i].getSize().y * 4;
+        }
+    }
+    auto legacyEnd = std::chrono::steady_clock::now();
+    
+    // Cached path: clips are shared, each Player only holds playback state
+    TextureCache& cache = TextureCache::global();
+    std::size_t cachedBytes = 0;
+    std::size_t cachedTextures = 0;
+    auto cachedStart = std::chrono::steady_clock::now();
+    {
+        std::vector<std::unique_ptr<Player>> players;
+        players.reserve(characters);
+        for (std::size_t i = 0; i < characters; i++) 
+        {
+            players.push_back(std::make_unique<Player>(0.0f, 0.0f));
+            if (!players.back()->loadAllAnimations(basePath)) 
+            {
+                return 1;
+            }
+        }
+        cachedBytes = cache.residentBytes();
+        cachedTextures = cache.residentTextures();
+    }
+    auto cachedEnd = std::chrono::steady_clock::now();
+    
+    double legacyMs = std::chrono::duration<double, std::milli>(legacyEnd - legacyStart).count();
+    double cachedMs = std::chrono::duration<double, std::milli>(cachedEnd - cachedStart).count();
+    
+    std::printf("characters:          %zu\n", characters);
+    std::printf("%-10s %10s %14s %12s\n", "", "textures", "texture KiB", "load ms");
+    std::printf("%-10s %10zu %14zu %12.2f\n", "per-anim", characters * 4, legacyBytes / 1024, legacyMs);
+    std::printf("%-10s %10zu %14zu %12.2f\n", "cached", cachedTextures, cachedBytes / 1024, cachedMs);
+    std::printf("cache loads/hits:    %u / %u\n", cache.textureLoads, cache.cacheHits);
+    std::printf("sizeof(Animation):   %zu bytes\n", sizeof(Animation));
+    
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "../Enemy/EnemyPool.h"
+#include "../Physics/Collision.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Platform/Platform.h"
+#include "../Player/Player.h"
+
+// Drops fast bodies onto a row of 20px ledges with very large timesteps and
+// counts how many end up below a ledge they started above (tunneled), with
+// overlap resolution only versus swept collision. Covers both the pooled
+// enemy path and the Player path. Swept must report 0 at every timestep.
+//
+// Usage: TunnelingStress [bodies] [seconds]   (default: 20000 3)
+
+
+namespace
+{
+    const float LEDGE_Y = 500.0f;
+    const float LEDGE_HEIGHT = 20.0f;
+    const float LEDGE_WIDTH = 400.0f;
+    const float LEDGE_SPACING = 500.0f;
+    const int LEDGE_COUNT = 40;
+    
+    // True if x is over a ledge (with margin so sliding off an edge is not counted)
+    bool overLedge(float x)
+    {
+        float local = std::fmod(x, LEDGE_SPACING);
+        return x >= 0.0f && x < LEDGE_SPACING * LEDGE_COUNT && local > 40.0f && local < LEDGE_WIDTH - 40.0f;
+    }
+}
+
+
+int main(int argc, char* argv[])
+{
+    std::size_t bodyCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    float seconds = argc > 2 ? static_cast<float>(std::atof(argv[2])) : 3.0f;
+    
+    std::vector<Platform> platforms;
+    for (int i = 0; i < LEDGE_COUNT; i++) 
+    {
+        platforms.push_back(Platform(i * LEDGE_SPACING, LEDGE_Y, LEDGE_WIDTH, LEDGE_HEIGHT, sf::Color::Black));
+    }
+    SpatialGrid grid;
+    grid.build(platforms);
+    
+    const float timesteps[] = { 1.0f / 120.0f, 1.0f / 30.0f, 1.0f / 10.0f, 0.25f, 1.0f };
+    
+    std::printf("%-10s %-9s %10s %12s %12s\n", "path", "dt (s)", "mode", "tunneled", "ns/body-tick");
+    bool clean = true;
+    for (float dt : timesteps) 
+    {
+        int ticks = std::max(1, static_cast<int>(seconds / dt));
+        for (int swept = 0; swept < 2; swept++) 
+        {
+            // Same crowd for every run: above the ledges, falling up to 6000 px/s
+            std::mt19937 rng(5);
+            std::uniform_real_distribution<float> xDist(60.0f, LEDGE_WIDTH - 60.0f);
+            std::uniform_int_distribution<int> ledgeDist(0, LEDGE_COUNT - 1);
+            std::uniform_real_distribution<float> yDist(0.0f, LEDGE_Y - 100.0f);
+            std::uniform_real_distribution<float> fallDist(0.0f, 6000.0f);
+            
+            EnemyPool pool(bodyCount);
+            for (std::size_t i = 0; i < bodyCount; i++) 
+            {
+                float x = ledgeDist(rng) * LEDGE_SPACING + xDist(rng);
+                pool.spawn(EnemyType::LIZARD, sf::Vector2f(x, yDist(rng)), sf::Vector2f(0.0f, fallDist(rng)));
+            }
+            
+            auto start = std::chrono::steady_clock::now();
+            for (int t = 0; t < ticks; t++) 
+            {
+                pool.update(dt);
+                if (swept) 
+                {
+                    pool.sweep(grid, dt);
+                }
+                pool.collide(grid);
+            }
+            auto end = std::chrono::steady_clock::now();
+            
+            std::size_t tunneled = 0;
+            for (std::size_t i = 0; i < pool.size(); i++) 
+            {
+                tunneled += pool.positionY[i] > LEDGE_Y + LEDGE_HEIGHT && overLedge(pool.positionX[i]);
+            }
+            clean &= !swept || tunneled == 0;
+            double ns = std::chrono::duration<double, std::nano>(end - start).count() / (double(ticks) * bodyCount);
+            std::printf("%-10s %-9.4f %10s %12zu %12.1f\n", "enemies", dt, swept ? "swept" : "overlap", tunneled, ns);
+        }
+        
+        // Player path: one player dropped from the top at the worst speed
+        for (int swept = 0; swept < 2; swept++) 
+        {
+            Player player(LEDGE_WIDTH / 2.0f, 0.0f);
+            player.velocity.y = 6000.0f;
+            Collision collision;
+            for (int t = 0; t < ticks; t++) 
+            {
+                sf::Vector2f before = player.getPosition();
+                player.update(dt);
+                if (swept) 
+                {
+                    collision.sweepPlayer(player, before, grid);
+                }
+                collision.handleCollisions(player, grid);
+            }
+            bool fellThrough = player.getPosition().y > LEDGE_Y + LEDGE_HEIGHT;
+            clean &= !swept || !fellThrough;
+            std::printf("%-10s %-9.4f %10s %12d %12s %s\n", "player", dt, swept ? "swept" : "overlap", fellThrough ? 1 : 0, "-", 
+                        player.onGround ? "(grounded)" : "");
+        }
+    }
+    
+    std::printf("swept collision: %s\n", clean ? "no tunneling" : "TUNNELING DETECTED");
+    return clean ? 0 : 1;
+}
@@ -1,7 +1,93 @@
 #include "Enemy.h"
+#include "EnemyPool.h"
 
 Enemy::Enemy(float x, float y)
-: velocity(0.f, 0.f)
+: type(EnemyType::DEMON),
+  state(EnemyState::IDLE),
+  position(x, y),
+  velocity(0.f, 0.f)
     
 {
-};
\ No newline at end of file
+}
+
+const char* Enemy::familyName(EnemyType type)
+{
+    switch (type) 
+    {
+        case EnemyType::DEMON:        return "demon";
+        case EnemyType::DRAGON:       return "dragon";
+        case EnemyType::JINN:         return "jinn_animation";
+        case EnemyType::LIZARD:       return "lizard";
+        case EnemyType::MEDUSA:       return "medusa";
+        case EnemyType::SMALL_DRAGON: return "small_dragon";
+        default:                      return "";
+    }
+}
+
+namespace
+{
+    // Clip name suffix and frame file prefix per EnemyState
+    const char* const STATE_CLIPS[3] = { "Idle", "Attack", "Death" };
+}
+
+bool Enemy::loadAnimations(const TextureAtlas& atlas)
+{
+    std::string family = familyName(type);
+    ClipHandle idle = atlas.getClip(family + "/Idle");
+    ClipHandle attacking = atlas.getClip(family + "/Attack");
+    ClipHandle dead = atlas.getClip(family + "/Death");
+    if (!idle || !attacking || !dead) 
+    {
+        return false;
+    }
+    
+    idleAnimation.setClip(idle);
+    attackingAnimation.setClip(attacking);
+    deadAnimation.setClip(dead);
+    deadAnimation.loop = false;
+    
+    idleAnimation.setPosition(position);
+    attackingAnimation.setPosition(position);
+    deadAnimation.setPosition(position);
+    return true;
+}
+
+void Enemy::declareClips(ClipResidency& residency, const std::string& basePath)
+{
+    for (std::size_t t = 0; t < static_cast<std::size_t>(EnemyType::COUNT); t++) 
+    {
+        std::string family = familyName(static_cast<EnemyType>(t));
+        for (std::size_t s = 0; s < 3; s++) 
+        {
+            unsigned int frameCount = EnemyPool::frameCountFor(static_cast<EnemyType>(t), static_cast<EnemyState>(s));
+            std::vector<std::string> frames;
+            for (unsigned int f = 1; f <= frameCount; f++) 
+            {
+                frames.push_back(basePath + family + "/" + STATE_CLIPS[s] + std::to_string(f) + ".png");
+            }
+            residency.declareFrames(family + "/" + STATE_CLIPS[s], frames, 10.0f);
+        }
+    }
+}
+
+bool Enemy::bindAnimations(ClipResidency& residency)
+{
+    std::string family = familyName(type);
+    ClipResidency::ClipId idle = residency.find(family + "/Idle");
+    ClipResidency::ClipId attacking = residency.find(family + "/Attack");
+    ClipResidency::ClipId dead = residency.find(family + "/Death");
+    if (idle == ClipResidency::NO_CLIP || attacking == ClipResidency::NO_CLIP || dead == ClipResidency::NO_CLIP) 
+    {
+        return false;
+    }
+    
+    idleAnimation.bindLazy(residency, idle);
+    attackingAnimation.bindLazy(residency, attacking);
+    deadAnimation.bindLazy(residency, dead);
+    deadAnimation.loop = false;
+    
+    idleAnimation.setPosition(position);
+    attackingAnimation.setPosition(position);
+    deadAnimation.setPosition(position);
+    return true;
+}
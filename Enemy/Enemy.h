@@ -1,11 +1,21 @@
+#pragma once
 #include  "../Animation/Animation.h"
+#include "../Animation/TextureAtlas.h"
 #include <SFML/Graphics.hpp>
 
+/**
+ * @enum EnemyType
+ * @brief Enemy family, one per folder under assets/Enemies
+ */
 enum class EnemyType
 {
-    ZOMBIE,
-    ALIEN,
-    ROBOT
+    DEMON,
+    DRAGON,
+    JINN,
+    LIZARD,
+    MEDUSA,
+    SMALL_DRAGON,
+    COUNT  ///< Number of enemy families (not a valid type)
 };
 
 enum class EnemyState
@@ -20,6 +30,49 @@ class Enemy
 {
     public:
         Enemy(float x, float y);
+        
+        /**
+         * @brief Gets the asset folder name of an enemy family
+         * 
+         * @return Folder under assets/Enemies, e.g. "jinn_animation"
+         */
+        static const char* familyName(EnemyType type);
+        
+        /**
+         * @brief Points the idle/attacking/dead animations at atlas clips
+         * 
+         * Uses the "<family>/Idle", "<family>/Attack" and "<family>/Death"
+         * clips, so every enemy of a family shares the same atlas page.
+         * 
+         * @param atlas Atlas loaded from Tools/AtlasPacker output
+         * @return true if all three clips exist in the atlas
+         */
+        bool loadAnimations(const TextureAtlas& atlas);
+        
+        /**
+         * @brief Declares every family's idle/attack/death clips in a residency
+         * 
+         * Registers "<family>/Idle", "<family>/Attack" and "<family>/Death",
+         * the atlas names, as one image per frame (e.g.
+         * assets/Enemies/demon/Attack1.png to Attack4.png). Nothing is loaded
+         * until a clip is acquired.
+         * 
+         * @param residency Residency to declare the clips in
+         * @param basePath  Directory holding one folder per family
+         */
+        static void declareClips(ClipResidency& residency, const std::string& basePath = "assets/Enemies/");
+        
+        /**
+         * @brief Binds the idle/attacking/dead animations to residency clips
+         * 
+         * Same clips as loadAnimations(), but each texture loads on its
+         * animation's first play().
+         * 
+         * @param residency Residency declareClips() filled
+         * @return true if all three clips are declared
+         */
+        bool bindAnimations(ClipResidency& residency);
+        
         EnemyType type;
         EnemyState state;
         sf::Vector2f position;
@@ -32,4 +85,4 @@ class Enemy
         int frameSizeX = 96;
         int frameSizeY = 70;
         
-};
\ No newline at end of file
+};
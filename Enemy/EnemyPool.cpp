@@ -0,0 +1,686 @@
+#include "EnemyPool.h"
+#include "../Physics/Collision.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    constexpr std::size_t TYPE_COUNT = static_cast<std::size_t>(EnemyType::COUNT);
+    
+    // Frames per state (IDLE, ATTACKING, DEAD), counted from assets/Enemies/<family>/
+    constexpr unsigned int FRAME_COUNTS[TYPE_COUNT][3] = 
+    {
+        { 3, 4, 6 },  // demon
+        { 3, 4, 5 },  // dragon
+        { 3, 4, 6 },  // jinn_animation
+        { 3, 5, 6 },  // lizard
+        { 3, 6, 6 },  // medusa
+        { 3, 3, 4 },  // small_dragon
+    };
+    
+    // Smallest chunk worth handing to another thread
+    constexpr std::size_t PARALLEL_GRAIN = 1024;
+    
+    // Animation speed per state in frames per second
+    constexpr float STATE_FPS[3] = { 6.0f, 10.0f, 8.0f };
+    
+    // Half width/height of each family's collision box in pixels
+    constexpr float HALF_EXTENTS[TYPE_COUNT][2] = 
+    {
+        { 20.0f, 30.0f },  // demon
+        { 30.0f, 25.0f },  // dragon
+        { 15.0f, 25.0f },  // jinn_animation
+        { 20.0f, 20.0f },  // lizard
+        { 15.0f, 28.0f },  // medusa
+        { 15.0f, 15.0f },  // small_dragon
+    };
+    
+    constexpr std::uint32_t NO_DENSE_INDEX = 0xFFFFFFFFu;
+}
+
+EnemyPool::EnemyPool(std::size_t capacity)
+    : count(0)
+{
+    positionX.resize(capacity);
+    positionY.resize(capacity);
+    velocityX.resize(capacity);
+    velocityY.resize(capacity);
+    state.resize(capacity);
+    type.resize(capacity);
+    onGround.resize(capacity);
+    frame.resize(capacity);
+    frameTime.resize(capacity);
+    contacts.resize(capacity);
+    plan.resize(capacity);
+    thinkWait.resize(capacity);
+    denseToSlot.resize(capacity);
+    slotToDense.assign(capacity, NO_DENSE_INDEX);
+    slotGeneration.assign(capacity, 0);
+    slotSeen.resize(capacity);
+    
+    // Hand out low slots first
+    freeSlots.reserve(capacity);
+    for (std::size_t i = capacity; i > 0; i--) 
+    {
+        freeSlots.push_back(static_cast<std::uint32_t>(i - 1));
+    }
+}
+
+EnemyHandle EnemyPool::spawn(EnemyType enemyType, const sf::Vector2f& position, const sf::Vector2f& velocity)
+{
+    if (freeSlots.empty()) 
+    {
+        return EnemyHandle(); // Pool is full
+    }
+    
+    std::uint32_t slot = freeSlots.back();
+    freeSlots.pop_back();
+    slotsUsed = std::max(slotsUsed, slot + 1);
+    
+    std::size_t index = count++;
+    positionX[index] = position.x;
+    positionY[index] = position.y;
+    velocityX[index] = velocity.x;
+    velocityY[index] = velocity.y;
+    state[index] = EnemyState::IDLE;
+    type[index] = enemyType;
+    onGround[index] = 0;
+    frame[index] = 0;
+    frameTime[index] = 0.0f;
+    contacts[index].clear();
+    plan[index] = NO_PLAN;
+    thinkWait[index] = 0;
+    
+    denseToSlot[index] = slot;
+    slotToDense[slot] = static_cast<std::uint32_t>(index);
+    
+    EnemyHandle handle;
+    handle.slot = slot;
+    handle.generation = slotGeneration[slot];
+    return handle;
+}
+
+bool EnemyPool::despawn(EnemyHandle handle)
+{
+    if (!isAlive(handle)) 
+    {
+        return false;
+    }
+    
+    removeDense(slotToDense[handle.slot]);
+    slotToDense[handle.slot] = NO_DENSE_INDEX;
+    slotGeneration[handle.slot]++; // Invalidate outstanding handles
+    freeSlots.push_back(handle.slot);
+    return true;
+}
+
+bool EnemyPool::isAlive(EnemyHandle handle) const
+{
+    return handle.slot < slotGeneration.size() && 
+           slotGeneration[handle.slot] == handle.generation && 
+           slotToDense[handle.slot] != NO_DENSE_INDEX;
+}
+
+void EnemyPool::clear()
+{
+    while (count > 0) 
+    {
+        std::uint32_t slot = denseToSlot[count - 1];
+        slotToDense[slot] = NO_DENSE_INDEX;
+        slotGeneration[slot]++;
+        freeSlots.push_back(slot);
+        count--;
+    }
+}
+
+std::size_t EnemyPool::indexOf(EnemyHandle handle) const
+{
+    return isAlive(handle) ? slotToDense[handle.slot] : count;
+}
+
+EnemyHandle EnemyPool::handleAt(std::size_t index) const
+{
+    EnemyHandle handle;
+    handle.slot = denseToSlot[index];
+    handle.generation = slotGeneration[handle.slot];
+    return handle;
+}
+
+namespace
+{
+    // Leads the block written by EnemyPool::writeState(). Free slots are not
+    // counted: every used slot that holds no enemy is on the free list.
+    struct PoolStateHeader
+    {
+        std::uint32_t count;
+        std::uint32_t slotsUsed;
+    };
+    
+    // Bytes per enemy across the dense columns and denseToSlot
+    constexpr std::size_t DENSE_BYTES = 4 * sizeof(float) + sizeof(EnemyState) + sizeof(EnemyType) + 
+                                        sizeof(std::uint8_t) + sizeof(std::uint16_t) + sizeof(float) + 
+                                        sizeof(ContactCache) + 3 * sizeof(std::uint32_t);
+    
+    // Bytes per used slot across slotToDense and slotGeneration
+    constexpr std::size_t SLOT_BYTES = 2 * sizeof(std::uint32_t);
+    
+    static_assert(std::is_trivially_copyable<ContactCache>::value, "contacts are copied as raw bytes");
+    
+    template <typename T>
+    void putArray(std::uint8_t*& out, const T* values, std::size_t n)
+    {
+        std::memcpy(out, values, n * sizeof(T));
+        out += n * sizeof(T);
+    }
+    
+    template <typename T>
+    void takeArray(const std::uint8_t*& in, T* values, std::size_t n)
+    {
+        std::memcpy(values, in, n * sizeof(T));
+        in += n * sizeof(T);
+    }
+    
+    // Start of an n-element column, moving in past it
+    template <typename T>
+    const std::uint8_t* skipArray(const std::uint8_t*& in, std::size_t n)
+    {
+        const std::uint8_t* column = in;
+        in += n * sizeof(T);
+        return column;
+    }
+    
+    // Element i of a column found by skipArray() (the buffer need not be aligned)
+    template <typename T>
+    T elementAt(const std::uint8_t* column, std::size_t i)
+    {
+        T value;
+        std::memcpy(&value, column + i * sizeof(T), sizeof(T));
+        return value;
+    }
+}
+
+std::size_t EnemyPool::stateSize() const
+{
+    std::size_t emptySlots = slotsUsed - count;
+    return sizeof(PoolStateHeader) + count * DENSE_BYTES + slotsUsed * SLOT_BYTES + emptySlots * sizeof(std::uint32_t);
+}
+
+void EnemyPool::writeState(std::uint8_t* out) const
+{
+    PoolStateHeader header;
+    header.count = static_cast<std::uint32_t>(count);
+    header.slotsUsed = slotsUsed;
+    putArray(out, &header, 1);
+    
+    putArray(out, positionX.data(), count);
+    putArray(out, positionY.data(), count);
+    putArray(out, velocityX.data(), count);
+    putArray(out, velocityY.data(), count);
+    putArray(out, state.data(), count);
+    putArray(out, type.data(), count);
+    putArray(out, onGround.data(), count);
+    putArray(out, frame.data(), count);
+    putArray(out, frameTime.data(), count);
+    putArray(out, contacts.data(), count);
+    putArray(out, plan.data(), count);
+    putArray(out, thinkWait.data(), count);
+    putArray(out, denseToSlot.data(), count);
+    
+    putArray(out, slotToDense.data(), slotsUsed);
+    putArray(out, slotGeneration.data(), slotsUsed);
+    
+    // Only the recycled tail of the free list; the front is never touched
+    std::size_t untouched = capacity() - slotsUsed;
+    putArray(out, freeSlots.data() + untouched, freeSlots.size() - untouched);
+}
+
+bool EnemyPool::validateState(const std::uint8_t* data, std::size_t size, const SpatialGrid& grid) const
+{
+    PoolStateHeader header;
+    if (size < sizeof(header)) 
+    {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.slotsUsed > capacity() || header.count > header.slotsUsed) 
+    {
+        return false;
+    }
+    const std::size_t enemyCount = header.count;
+    const std::size_t emptySlots = header.slotsUsed - header.count;
+    if (size < sizeof(header) + enemyCount * DENSE_BYTES + header.slotsUsed * SLOT_BYTES + emptySlots * sizeof(std::uint32_t)) 
+    {
+        return false;
+    }
+    
+    // Same walk as readState(), keeping the columns that need checking
+    const std::uint8_t* in = data + sizeof(header);
+    const std::uint8_t* motion = skipArray<float>(in, 4 * enemyCount);
+    const std::uint8_t* states = skipArray<EnemyState>(in, enemyCount);
+    const std::uint8_t* types = skipArray<EnemyType>(in, enemyCount);
+    skipArray<std::uint8_t>(in, enemyCount);
+    const std::uint8_t* frames = skipArray<std::uint16_t>(in, enemyCount);
+    skipArray<float>(in, enemyCount);
+    const std::uint8_t* caches = skipArray<ContactCache>(in, enemyCount);
+    skipArray<std::uint32_t>(in, 2 * enemyCount);
+    const std::uint8_t* owners = skipArray<std::uint32_t>(in, enemyCount);
+    const std::uint8_t* slots = skipArray<std::uint32_t>(in, header.slotsUsed);
+    skipArray<std::uint32_t>(in, header.slotsUsed);
+    const std::uint8_t* recycled = skipArray<std::uint32_t>(in, emptySlots);
+    
+    // Positions end up as grid cell indices; a NaN would turn into garbage
+    for (std::size_t i = 0; i < 4 * enemyCount; i++) 
+    {
+        if (!std::isfinite(elementAt<float>(motion, i))) 
+        {
+            return false;
+        }
+    }
+    
+    for (std::size_t i = 0; i < enemyCount; i++) 
+    {
+        auto enemyState = elementAt<std::underlying_type_t<EnemyState>>(states, i);
+        auto enemyType = elementAt<std::underlying_type_t<EnemyType>>(types, i);
+        if (enemyState < 0 || enemyState > static_cast<int>(EnemyState::DEAD) || 
+            enemyType < 0 || enemyType >= static_cast<int>(EnemyType::COUNT) || 
+            elementAt<std::uint16_t>(frames, i) >= frameCountFor(static_cast<EnemyType>(enemyType), static_cast<EnemyState>(enemyState)) || 
+            !elementAt<ContactCache>(caches, i).fits(grid.version, grid.size())) 
+        {
+            return false;
+        }
+        
+        // Each enemy owns a used slot that points back at it
+        std::uint32_t slot = elementAt<std::uint32_t>(owners, i);
+        if (slot >= header.slotsUsed || elementAt<std::uint32_t>(slots, slot) != i) 
+        {
+            return false;
+        }
+    }
+    
+    // With every enemy's slot pointing back at it, the used slots holding
+    // no enemy are exactly those marked NO_DENSE_INDEX. Anything else is
+    // an index that no enemy confirmed.
+    std::fill(slotSeen.begin(), slotSeen.begin() + header.slotsUsed, 0);
+    for (std::size_t slot = 0; slot < header.slotsUsed; slot++) 
+    {
+        std::uint32_t dense = elementAt<std::uint32_t>(slots, slot);
+        if (dense == NO_DENSE_INDEX) 
+        {
+            slotSeen[slot] = 1;
+        }
+        else if (dense >= enemyCount || elementAt<std::uint32_t>(owners, dense) != slot) 
+        {
+            return false;
+        }
+    }
+    
+    // Which leaves emptySlots of them, each due on the free list once
+    for (std::size_t i = 0; i < emptySlots; i++) 
+    {
+        std::uint32_t slot = elementAt<std::uint32_t>(recycled, i);
+        if (slot >= header.slotsUsed || slotSeen[slot] != 1) 
+        {
+            return false;
+        }
+        slotSeen[slot] = 2;
+    }
+    return true;
+}
+
+bool EnemyPool::readState(const std::uint8_t* data, std::size_t size, const SpatialGrid& grid)
+{
+    if (!validateState(data, size, grid)) 
+    {
+        return false;
+    }
+    PoolStateHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    std::size_t emptySlots = header.slotsUsed - header.count;
+    
+    const std::uint8_t* in = data + sizeof(header);
+    count = header.count;
+    takeArray(in, positionX.data(), count);
+    takeArray(in, positionY.data(), count);
+    takeArray(in, velocityX.data(), count);
+    takeArray(in, velocityY.data(), count);
+    takeArray(in, state.data(), count);
+    takeArray(in, type.data(), count);
+    takeArray(in, onGround.data(), count);
+    takeArray(in, frame.data(), count);
+    takeArray(in, frameTime.data(), count);
+    takeArray(in, contacts.data(), count);
+    takeArray(in, plan.data(), count);
+    takeArray(in, thinkWait.data(), count);
+    takeArray(in, denseToSlot.data(), count);
+    
+    // Slots first handed out after the snapshot go back to their initial state
+    for (std::uint32_t slot = header.slotsUsed; slot < slotsUsed; slot++) 
+    {
+        slotToDense[slot] = NO_DENSE_INDEX;
+        slotGeneration[slot] = 0;
+    }
+    takeArray(in, slotToDense.data(), header.slotsUsed);
+    takeArray(in, slotGeneration.data(), header.slotsUsed);
+    
+    // Rebuild the untouched front of the free list (descending, as the
+    // constructor made it), then append the recycled tail
+    std::size_t untouched = capacity() - header.slotsUsed;
+    std::size_t intact = capacity() - slotsUsed;
+    freeSlots.resize(untouched + emptySlots);
+    for (std::size_t i = intact; i < untouched; i++) 
+    {
+        freeSlots[i] = static_cast<std::uint32_t>(capacity() - 1 - i);
+    }
+    takeArray(in, freeSlots.data() + untouched, emptySlots);
+    slotsUsed = header.slotsUsed;
+    return true;
+}
+
+void EnemyPool::setState(std::size_t index, EnemyState newState)
+{
+    if (state[index] == newState) 
+    {
+        return;
+    }
+    state[index] = newState;
+    frame[index] = 0;
+    frameTime[index] = 0.0f;
+}
+
+void EnemyPool::removeDense(std::size_t index)
+{
+    // Move the last enemy into the hole so the arrays stay packed
+    std::size_t last = count - 1;
+    if (index != last) 
+    {
+        positionX[index] = positionX[last];
+        positionY[index] = positionY[last];
+        velocityX[index] = velocityX[last];
+        velocityY[index] = velocityY[last];
+        state[index] = state[last];
+        type[index] = type[last];
+        onGround[index] = onGround[last];
+        frame[index] = frame[last];
+        frameTime[index] = frameTime[last];
+        contacts[index] = contacts[last];
+        plan[index] = plan[last];
+        thinkWait[index] = thinkWait[last];
+        
+        denseToSlot[index] = denseToSlot[last];
+        slotToDense[denseToSlot[index]] = static_cast<std::uint32_t>(index);
+    }
+    count--;
+}
+
+void EnemyPool::update(float deltaTime)
+{
+    updateRange(deltaTime, 0, count);
+}
+
+void EnemyPool::update(float deltaTime, JobSystem& jobs)
+{
+    jobs.parallelFor(0, count, PARALLEL_GRAIN, [this, deltaTime](std::size_t first, std::size_t last) 
+    {
+        updateRange(deltaTime, first, last);
+    });
+}
+
+void EnemyPool::updateRange(float deltaTime, std::size_t first, std::size_t last)
+{
+    const float fallStep = gravity * deltaTime;
+    
+    const std::size_t n = last - first;
+    float* px = positionX.data() + first;
+    float* py = positionY.data() + first;
+    float* vx = velocityX.data() + first;
+    float* vy = velocityY.data() + first;
+    std::uint8_t* grounded = onGround.data() + first;
+    
+    // Apply gravity to airborne enemies (select, no branch)
+    for (std::size_t i = 0; i < n; i++) 
+    {
+        vy[i] += grounded[i] ? 0.0f : fallStep;
+    }
+    
+    // Integrate positions
+    for (std::size_t i = 0; i < n; i++) 
+    {
+        px[i] += vx[i] * deltaTime;
+        py[i] += vy[i] * deltaTime;
+    }
+    
+    // Reset onGround - collide() will set it again for supported enemies
+    std::fill(grounded, grounded + n, std::uint8_t(0));
+    
+    // Advance animation timers
+    float* timers = frameTime.data() + first;
+    for (std::size_t i = 0; i < n; i++) 
+    {
+        timers[i] += deltaTime;
+    }
+    
+    // Step frames whose timer ran out (rare compared to the timer pass)
+    for (std::size_t i = first; i < last; i++) 
+    {
+        std::size_t stateIndex = static_cast<std::size_t>(state[i]);
+        float timePerFrame = 1.0f / STATE_FPS[stateIndex];
+        if (frameTime[i] < timePerFrame) 
+        {
+            continue;
+        }
+        
+        frameTime[i] -= timePerFrame;
+        unsigned int frames = FRAME_COUNTS[static_cast<std::size_t>(type[i])][stateIndex];
+        unsigned int next = frame[i] + 1u;
+        if (next >= frames) 
+        {
+            // Dead enemies hold their last frame, everything else loops
+            next = (state[i] == EnemyState::DEAD) ? frames - 1 : 0;
+        }
+        frame[i] = static_cast<std::uint16_t>(next);
+    }
+}
+
+void EnemyPool::collide(const SpatialGrid& grid)
+{
+    // After a sweep a cache hit is the sweep's lookup again; real queries
+    // (the sweep's result was too crowded to cache) still count
+    bool countAvoided = !swept;
+    swept = false;
+    
+    ContactStats stats;
+    collideRange(grid, 0, count, candidates, stats);
+    if (!countAvoided) 
+    {
+        stats.queriesAvoided = 0;
+    }
+    addContactStats(stats);
+}
+
+void EnemyPool::collide(const SpatialGrid& grid, JobSystem& jobs)
+{
+    bool countAvoided = !swept;
+    swept = false;
+    
+    jobs.parallelFor(0, count, PARALLEL_GRAIN, [this, &grid, countAvoided](std::size_t first, std::size_t last) 
+    {
+        thread_local std::vector<std::size_t> scratch;
+        ContactStats stats;
+        collideRange(grid, first, last, scratch, stats);
+        if (!countAvoided) 
+        {
+            stats.queriesAvoided = 0;
+        }
+        addContactStats(stats);
+    });
+}
+
+void EnemyPool::collideRange(const SpatialGrid& grid, std::size_t first, std::size_t last, 
+                             std::vector<std::size_t>& scratch, ContactStats& stats)
+{
+    for (std::size_t i = first; i < last; i++) 
+    {
+        Collision::gatherCandidates(getBounds(i), grid, contacts[i], scratch, stats);
+        
+        for (std::size_t platform : scratch) 
+        {
+            std::optional<CollisionResponse> response = 
+                Collision::resolveOverlap(getBounds(i), grid.getBounds(platform));
+            if (!response.has_value()) 
+            {
+                continue;
+            }
+            
+            positionX[i] += response->push.x;
+            positionY[i] += response->push.y;
+            if (response->stopX) 
+            {
+                velocityX[i] = 0.0f;
+            }
+            if (response->stopY) 
+            {
+                velocityY[i] = 0.0f;
+            }
+            if (response->landed) 
+            {
+                onGround[i] = 1;
+            }
+        }
+    }
+}
+
+void EnemyPool::sweep(const SpatialGrid& grid, float deltaTime)
+{
+    ContactStats stats;
+    sweepRange(grid, deltaTime, 0, count, candidates, stats);
+    addContactStats(stats);
+    swept = true;
+}
+
+void EnemyPool::sweep(const SpatialGrid& grid, float deltaTime, JobSystem& jobs)
+{
+    jobs.parallelFor(0, count, PARALLEL_GRAIN, [this, &grid, deltaTime](std::size_t first, std::size_t last) 
+    {
+        thread_local std::vector<std::size_t> scratch;
+        ContactStats stats;
+        sweepRange(grid, deltaTime, first, last, scratch, stats);
+        addContactStats(stats);
+    });
+    swept = true;
+}
+
+void EnemyPool::sweepRange(const SpatialGrid& grid, float deltaTime, std::size_t first, std::size_t last, 
+                           std::vector<std::size_t>& scratch, ContactStats& stats)
+{
+    for (std::size_t i = first; i < last; i++) 
+    {
+        // update() moved every enemy by exactly velocity * deltaTime
+        sf::Vector2f displacement(velocityX[i] * deltaTime, velocityY[i] * deltaTime);
+        sf::FloatRect bounds = getBounds(i);
+        bounds.position -= displacement;
+        
+        CollisionResponse response = 
+            Collision::moveAndSlide(bounds, displacement, grid, contacts[i], scratch, stats);
+        positionX[i] += response.push.x - displacement.x;
+        positionY[i] += response.push.y - displacement.y;
+        if (response.stopX) 
+        {
+            velocityX[i] = 0.0f;
+        }
+        if (response.stopY) 
+        {
+            velocityY[i] = 0.0f;
+        }
+        if (response.landed) 
+        {
+            onGround[i] = 1;
+        }
+    }
+}
+
+bool EnemyPool::setClips(const TextureAtlas& atlas)
+{
+    const char* stateClips[3] = { "/Idle", "/Attack", "/Death" };
+    bool complete = true;
+    for (std::size_t t = 0; t < TYPE_COUNT; t++) 
+    {
+        std::string family = Enemy::familyName(static_cast<EnemyType>(t));
+        for (std::size_t s = 0; s < 3; s++) 
+        {
+            clips[t][s] = atlas.getClip(family + stateClips[s]);
+            complete &= clips[t][s] != nullptr;
+        }
+    }
+    return complete;
+}
+
+const ClipHandle& EnemyPool::getClip(EnemyType enemyType, EnemyState enemyState) const
+{
+    return clips[static_cast<std::size_t>(enemyType)][static_cast<std::size_t>(enemyState)];
+}
+
+void EnemyPool::draw(SpriteBatch& batch, int layer) const
+{
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        const ClipHandle& clip = clips[static_cast<std::size_t>(type[i])][static_cast<std::size_t>(state[i])];
+        if (!clip || clip->frames.empty()) 
+        {
+            continue;
+        }
+        
+        // Table frame counts may differ from a custom atlas; stay in range
+        std::size_t f = std::min<std::size_t>(frame[i], clip->frames.size() - 1);
+        sf::Vector2f origin = f < clip->pivots.size() ? clip->pivots[f] : sf::Vector2f(0.f, 0.f);
+        batch.draw(*clip->texture, clip->frames[f], sf::Vector2f(positionX[i], positionY[i]), 
+                   origin, velocityX[i] < 0.0f, sf::Color::White, layer);
+    }
+}
+
+sf::FloatRect EnemyPool::getBounds(std::size_t index) const
+{
+    const float* half = HALF_EXTENTS[static_cast<std::size_t>(type[index])];
+    return sf::FloatRect(
+        sf::Vector2f(positionX[index] - half[0], positionY[index] - half[1]),
+        sf::Vector2f(half[0] * 2.0f, half[1] * 2.0f)
+    );
+}
+
+void EnemyPool::addContactStats(const ContactStats& stats)
+{
+    queryCount.fetch_add(stats.queries, std::memory_order_relaxed);
+    avoidedCount.fetch_add(stats.queriesAvoided, std::memory_order_relaxed);
+}
+
+ContactStats EnemyPool::getContactStats() const
+{
+    ContactStats stats;
+    stats.queries = queryCount.load(std::memory_order_relaxed);
+    stats.queriesAvoided = avoidedCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void EnemyPool::resetContactStats()
+{
+    queryCount.store(0, std::memory_order_relaxed);
+    avoidedCount.store(0, std::memory_order_relaxed);
+}
+
+std::size_t EnemyPool::size() const
+{
+    return count;
+}
+
+std::size_t EnemyPool::capacity() const
+{
+    return slotGeneration.size();
+}
+
+unsigned int EnemyPool::frameCountFor(EnemyType enemyType, EnemyState enemyState)
+{
+    return FRAME_COUNTS[static_cast<std::size_t>(enemyType)][static_cast<std::size_t>(enemyState)];
+}
@@ -0,0 +1,369 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Enemy.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Physics/ContactCache.h"
+#include "../Animation/TextureAtlas.h"
+#include "../Render/SpriteBatch.h"
+#include "../Jobs/JobSystem.h"
+
+/**
+ * @struct EnemyHandle
+ * @brief Stable reference to a pooled enemy
+ * 
+ * The generation counter changes every time a slot is reused, so a handle
+ * to a despawned enemy never aliases the enemy that later takes its slot.
+ */
+struct EnemyHandle
+{
+    std::uint32_t slot = INVALID_SLOT;  ///< Index into the pool's slot table
+    std::uint32_t generation = 0;       ///< Slot generation at spawn time
+    
+    /** @brief Slot value used by handles that refer to nothing */
+    static constexpr std::uint32_t INVALID_SLOT = 0xFFFFFFFFu;
+    
+    /** @brief Whether the handle was returned by a successful spawn */
+    bool isValid() const { return slot != INVALID_SLOT; }
+};
+
+/**
+ * @class EnemyPool
+ * @brief Fixed-capacity structure-of-arrays storage for large enemy crowds
+ * 
+ * Instead of one fat Enemy object per enemy, every field lives in its own
+ * contiguous array and active enemies are packed into [0, size()). The
+ * per-frame passes are straight loops over those arrays with no pointer
+ * chasing and no "is alive" branches, which lets the compiler vectorize
+ * integration and animation timing.
+ * 
+ * Spawning pops a slot from a free list and appends to the dense arrays;
+ * despawning moves the last enemy into the hole. Both are O(1). Handles go
+ * through a slot table so they stay valid while enemies are moved around.
+ * 
+ * @note Dense indices (0..size()-1) are only stable until the next despawn.
+ *       Hold on to EnemyHandle across frames instead.
+ * 
+ * @example
+ * @code
+ * EnemyPool enemies(10000);
+ * EnemyHandle dragon = enemies.spawn(EnemyType::DRAGON, sf::Vector2f(300, 100));
+ * 
+ * // In game loop:
+ * enemies.update(deltaTime);
+ * enemies.collide(platformGrid);
+ * enemies.draw(batch);
+ * @endcode
+ */
+class EnemyPool
+{
+public:
+    /**
+     * @brief Constructs an empty pool and allocates all storage up front
+     * 
+     * @param capacity Maximum number of simultaneously active enemies
+     */
+    explicit EnemyPool(std::size_t capacity);
+    
+    /**
+     * @brief Activates a new enemy
+     * 
+     * @param type     Enemy family
+     * @param position Initial position (center point)
+     * @param velocity Initial velocity in pixels per second
+     * @return Handle to the enemy, or an invalid handle if the pool is full
+     */
+    EnemyHandle spawn(EnemyType type, const sf::Vector2f& position, 
+                      const sf::Vector2f& velocity = sf::Vector2f(0.f, 0.f));
+    
+    /**
+     * @brief Deactivates an enemy and returns its slot to the free list
+     * 
+     * @param handle Handle returned by spawn()
+     * @return true if the enemy was alive and has been removed
+     */
+    bool despawn(EnemyHandle handle);
+    
+    /**
+     * @brief Checks whether a handle still refers to an active enemy
+     */
+    bool isAlive(EnemyHandle handle) const;
+    
+    /**
+     * @brief Despawns every enemy, invalidating all handles
+     */
+    void clear();
+    
+    /**
+     * @brief Gets the current dense index of an enemy
+     * 
+     * @param handle Handle returned by spawn()
+     * @return Dense index, or size() if the handle is stale
+     */
+    std::size_t indexOf(EnemyHandle handle) const;
+    
+    /**
+     * @brief Gets a handle to the enemy at a dense index
+     * 
+     * @param index Dense index of the enemy
+     */
+    EnemyHandle handleAt(std::size_t index) const;
+    
+    /**
+     * @brief Bytes writeState() will produce for the current contents
+     * 
+     * Grows with the number of enemies and the slots ever handed out, not
+     * with the pool's capacity.
+     */
+    std::size_t stateSize() const;
+    
+    /**
+     * @brief Copies every enemy and the slot tables in use into a flat buffer
+     * 
+     * Handles stay meaningful across a readState() of the result: enemies
+     * alive at the time keep their handles, and handles despawned since
+     * are stale again.
+     * 
+     * @param out At least stateSize() bytes
+     */
+    void writeState(std::uint8_t* out) const;
+    
+    /**
+     * @brief Checks a buffer before readState() trusts it
+     * 
+     * Every field that ends up as an index is range-checked: positions and
+     * velocities (which must be finite), states, types and animation
+     * frames, the contact caches, and the slot tables, which must pair each
+     * enemy with its own slot and list every other used slot exactly once
+     * on the free list. plan is left alone: its meaning is up to the AI,
+     * which already treats a plan that does not fit its graph as stale.
+     * 
+     * @param data Buffer written by writeState()
+     * @param size Its size in bytes
+     * @param grid Platform grid the enemies will be collided against
+     * @return true if readState() would accept the buffer
+     */
+    bool validateState(const std::uint8_t* data, std::size_t size, const SpatialGrid& grid) const;
+    
+    /**
+     * @brief Restores the pool from a buffer filled by writeState()
+     * 
+     * @param data Buffer written by writeState()
+     * @param size Its size in bytes
+     * @param grid Platform grid the enemies will be collided against
+     * @return false if validateState() rejects the buffer (the pool is then unchanged)
+     */
+    bool readState(const std::uint8_t* data, std::size_t size, const SpatialGrid& grid);
+    
+    /**
+     * @brief Changes an enemy's state and restarts its animation
+     * 
+     * @param index Dense index of the enemy
+     * @param state New state
+     */
+    void setState(std::size_t index, EnemyState state);
+    
+    /**
+     * @brief Integrates motion and advances animation for every enemy
+     * 
+     * Applies gravity to airborne enemies, moves everyone by velocity * dt,
+     * clears the grounded flags (collide() sets them again) and advances
+     * animation timers. Dead enemies hold their last death frame.
+     * 
+     * @param deltaTime Time elapsed since last update in seconds
+     */
+    void update(float deltaTime);
+    
+    /**
+     * @brief update() split across a job system
+     * 
+     * Every enemy is independent, so the result is identical to the serial
+     * version regardless of thread count.
+     * 
+     * @param deltaTime Time elapsed since last update in seconds
+     * @param jobs      Job system to run the chunks on
+     */
+    void update(float deltaTime, JobSystem& jobs);
+    
+    /**
+     * @brief Resolves every enemy against the static platforms
+     * 
+     * Uses the same overlap rule as the player (Collision::resolveOverlap)
+     * and only tests candidates the grid reports near each enemy. Enemies
+     * that stay inside their contact cache's region skip the grid query.
+     * 
+     * @param grid Broadphase built from the level's platforms
+     */
+    void collide(const SpatialGrid& grid);
+    
+    /**
+     * @brief collide() split across a job system
+     * 
+     * Each chunk uses its own candidate list; the grid is only read.
+     * 
+     * @param grid Broadphase built from the level's platforms
+     * @param jobs Job system to run the chunks on
+     */
+    void collide(const SpatialGrid& grid, JobSystem& jobs);
+    
+    /**
+     * @brief Redoes the last update()'s movement as a swept move
+     * 
+     * Call between update() and collide(). Each enemy is moved back by
+     * velocity * deltaTime and swept forward with Collision::moveAndSlide(),
+     * so fast or long steps cannot pass through platforms. collide() then
+     * only has to deal with enemies that started inside a platform.
+     * 
+     * @param grid      Broadphase built from the level's platforms
+     * @param deltaTime The deltaTime passed to the preceding update()
+     */
+    void sweep(const SpatialGrid& grid, float deltaTime);
+    
+    /**
+     * @brief sweep() split across a job system
+     */
+    void sweep(const SpatialGrid& grid, float deltaTime, JobSystem& jobs);
+    
+    /**
+     * @brief Looks up the idle/attack/death clips of every family in an atlas
+     * 
+     * @param atlas Atlas loaded from Tools/AtlasPacker output
+     * @return true if every family has all three clips
+     */
+    bool setClips(const TextureAtlas& atlas);
+    
+    /**
+     * @brief Clip assigned to a family/state by setClips()
+     * 
+     * @return The clip, or nullptr if none was found
+     */
+    const ClipHandle& getClip(EnemyType enemyType, EnemyState enemyState) const;
+    
+    /**
+     * @brief Queues every enemy's current frame into a sprite batch
+     * 
+     * Enemies face their direction of travel. Families without clips
+     * (see setClips) are skipped.
+     * 
+     * @param batch Batch to append to
+     * @param layer Draw layer passed to SpriteBatch::draw
+     */
+    void draw(SpriteBatch& batch, int layer = 0) const;
+    
+    /**
+     * @brief Gets the collision box of an enemy
+     * 
+     * @param index Dense index of the enemy
+     */
+    sf::FloatRect getBounds(std::size_t index) const;
+    
+    /**
+     * @brief Broadphase queries run and avoided by sweep()/collide()
+     * 
+     * Every grid query counts. When collide() follows a sweep(), a cache
+     * hit is the sweep's own lookup again and is not counted as avoided a
+     * second time. Counts accumulate until resetContactStats(). Reset once
+     * per frame to read them as per-frame work.
+     */
+    ContactStats getContactStats() const;
+    
+    /** @brief Zeroes the counters returned by getContactStats() */
+    void resetContactStats();
+    
+    /** @brief Number of active enemies */
+    std::size_t size() const;
+    
+    /** @brief Maximum number of active enemies */
+    std::size_t capacity() const;
+    
+    /**
+     * @brief Number of animation frames for a type/state pair
+     * 
+     * Frame counts match the per-frame PNGs under assets/Enemies.
+     */
+    static unsigned int frameCountFor(EnemyType type, EnemyState state);
+    
+    /** @brief Gravity acceleration in pixels per second squared */
+    float gravity = 980.0f;
+    
+    /** @brief plan value of an enemy that has not decided anything yet */
+    static constexpr std::uint32_t NO_PLAN = 0xFFFFFFFFu;
+    
+    /// @name Dense Per-Enemy Arrays (valid in [0, size()))
+    /// @{
+    
+    std::vector<float> positionX;          ///< Center X
+    std::vector<float> positionY;          ///< Center Y
+    std::vector<float> velocityX;          ///< Pixels per second
+    std::vector<float> velocityY;          ///< Pixels per second
+    std::vector<EnemyState> state;         ///< Behaviour state
+    std::vector<EnemyType> type;           ///< Enemy family
+    std::vector<std::uint8_t> onGround;    ///< 1 if resting on a platform
+    std::vector<std::uint16_t> frame;      ///< Current animation frame
+    std::vector<float> frameTime;          ///< Animation time accumulator
+    std::vector<ContactCache> contacts;    ///< Nearby platforms and support
+    std::vector<std::uint32_t> plan;       ///< Latest AI decision (meaning up to the AI), NO_PLAN at spawn
+    std::vector<std::uint32_t> thinkWait;  ///< Grounded ticks since that decision (counted by the AI)
+    
+    /// @}
+    
+private:
+    /** @brief Removes a dense entry by moving the last entry into its place */
+    void removeDense(std::size_t index);
+    
+    /** @brief update() over dense indices [first, last) */
+    void updateRange(float deltaTime, std::size_t first, std::size_t last);
+    
+    /** @brief sweep() over dense indices [first, last) */
+    void sweepRange(const SpatialGrid& grid, float deltaTime, std::size_t first, std::size_t last, 
+                    std::vector<std::size_t>& scratch, ContactStats& stats);
+    
+    /** @brief collide() over dense indices [first, last) */
+    void collideRange(const SpatialGrid& grid, std::size_t first, std::size_t last, 
+                      std::vector<std::size_t>& scratch, ContactStats& stats);
+    
+    /** @brief Adds a range's counters to the shared totals */
+    void addContactStats(const ContactStats& stats);
+    
+    /** @brief Number of active enemies */
+    std::size_t count;
+    
+    /** @brief Dense index -> owning slot */
+    std::vector<std::uint32_t> denseToSlot;
+    
+    /** @brief Slot -> dense index (valid only while the slot is alive) */
+    std::vector<std::uint32_t> slotToDense;
+    
+    /** @brief Slot -> generation, bumped on every despawn */
+    std::vector<std::uint32_t> slotGeneration;
+    
+    /** @brief Unused slots, popped on spawn and pushed on despawn */
+    std::vector<std::uint32_t> freeSlots;
+    
+    /** 
+     * @brief Slots below this have been handed out at least once
+     * 
+     * Slots from here up still have their initial table entries and sit,
+     * untouched, at the front of freeSlots, so writeState() can skip them.
+     */
+    std::uint32_t slotsUsed = 0;
+    
+    /** @brief Per-slot marks for validateState()'s free list check, allocated up front */
+    mutable std::vector<std::uint8_t> slotSeen;
+    
+    /** @brief Clip per family and state, filled by setClips() */
+    ClipHandle clips[static_cast<std::size_t>(EnemyType::COUNT)][3];
+    
+    /** @brief Scratch buffer for grid query results */
+    std::vector<std::size_t> candidates;
+    
+    /** @brief Set by sweep(), cleared by collide(); see getContactStats() */
+    bool swept = false;
+    
+    /** @brief Totals behind getContactStats(), added to once per chunk */
+    std::atomic<std::size_t> queryCount{ 0 };
+    std::atomic<std::size_t> avoidedCount{ 0 };
+};
@@ -0,0 +1,133 @@
+#include "InputRecording.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+    const char MAGIC[4] = { 'I', 'N', 'P', 'R' };
+    
+    // A run on disk: bitmask (1 byte) then length (2 bytes)
+    const std::size_t RUN_BYTES = sizeof(std::uint8_t) + sizeof(std::uint16_t);
+    
+    template <typename T>
+    void writeValue(std::ofstream& out, const T& value)
+    {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    template <typename T>
+    bool readValue(std::ifstream& in, T& value)
+    {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+bool InputRecording::saveToFile(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) 
+    {
+        std::cerr << "Failed to write input recording: " << path << std::endl;
+        return false;
+    }
+    
+    // Collapse repeated bitmasks into runs
+    std::vector<std::pair<std::uint8_t, std::uint16_t>> runs;
+    for (std::uint8_t bits : ticks) 
+    {
+        if (!runs.empty() && runs.back().first == bits && runs.back().second < UINT16_MAX) 
+        {
+            runs.back().second++;
+        }
+        else 
+        {
+            runs.emplace_back(bits, 1);
+        }
+    }
+    
+    out.write(MAGIC, sizeof(MAGIC));
+    writeValue(out, VERSION);
+    writeValue(out, timestep);
+    writeValue(out, startX);
+    writeValue(out, startY);
+    writeValue(out, static_cast<std::uint64_t>(ticks.size()));
+    writeValue(out, initialChecksum);
+    writeValue(out, finalChecksum);
+    writeValue(out, static_cast<std::uint32_t>(runs.size()));
+    for (const auto& run : runs) 
+    {
+        writeValue(out, run.first);
+        writeValue(out, run.second);
+    }
+    return static_cast<bool>(out);
+}
+
+bool InputRecording::loadFromFile(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in) 
+    {
+        std::cerr << "Failed to open input recording: " << path << std::endl;
+        return false;
+    }
+    
+    char magic[4];
+    std::uint32_t version = 0;
+    std::uint64_t tickCount = 0;
+    std::uint32_t runCount = 0;
+    if (!in.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        !readValue(in, version) || version != VERSION) 
+    {
+        std::cerr << "Not an input recording (or wrong version): " << path << std::endl;
+        return false;
+    }
+    if (!readValue(in, timestep) || !readValue(in, startX) || !readValue(in, startY) || !readValue(in, tickCount) || 
+        !readValue(in, initialChecksum) || !readValue(in, finalChecksum) || !readValue(in, runCount)) 
+    {
+        std::cerr << "Truncated input recording: " << path << std::endl;
+        return false;
+    }
+    
+    // The runs must fill the rest of the file exactly
+    std::streampos runStart = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streamoff remaining = in.tellg() - runStart;
+    in.seekg(runStart);
+    if (remaining < 0 || static_cast<std::uint64_t>(remaining) != static_cast<std::uint64_t>(runCount) * RUN_BYTES) 
+    {
+        std::cerr << "Input recording size does not match its run count: " << path << std::endl;
+        return false;
+    }
+    
+    std::vector<std::uint8_t> runs(static_cast<std::size_t>(remaining));
+    if (!in.read(reinterpret_cast<char*>(runs.data()), remaining)) 
+    {
+        std::cerr << "Truncated input recording: " << path << std::endl;
+        return false;
+    }
+    
+    // Check the header's tick count against the runs before allocating for it
+    std::uint64_t runTicks = 0;
+    for (std::size_t offset = 0; offset < runs.size(); offset += RUN_BYTES) 
+    {
+        std::uint16_t length = 0;
+        std::memcpy(&length, &runs[offset + 1], sizeof(length));
+        runTicks += length;
+    }
+    if (runTicks != tickCount) 
+    {
+        std::cerr << "Input recording tick count mismatch: " << path << std::endl;
+        return false;
+    }
+    
+    ticks.clear();
+    ticks.reserve(tickCount);
+    for (std::size_t offset = 0; offset < runs.size(); offset += RUN_BYTES) 
+    {
+        std::uint16_t length = 0;
+        std::memcpy(&length, &runs[offset + 1], sizeof(length));
+        ticks.insert(ticks.end(), length, runs[offset]);
+    }
+    return true;
+}
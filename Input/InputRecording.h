@@ -0,0 +1,124 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "InputSource.h"
+
+/**
+ * @class InputRecording
+ * @brief Per-tick input bitmasks plus the timestep they were captured at
+ * 
+ * On disk the ticks are run-length encoded (bitmask byte + 16-bit run),
+ * since held buttons repeat for many ticks; an hour at 120 Hz is usually a
+ * few kilobytes. The header stores the player's start position and the
+ * world checksum before the first and after the last tick, so a replay can
+ * start from the same state and tell whether it diverged.
+ * 
+ * File layout (little-endian):
+ * @code
+ * char     magic[4]        "INPR"
+ * uint32   version
+ * float    timestep
+ * float    startX, startY
+ * uint64   tickCount
+ * uint64   initialChecksum
+ * uint64   finalChecksum
+ * uint32   runCount
+ * { uint8 bits; uint16 length; } runs[runCount]
+ * @endcode
+ */
+class InputRecording
+{
+public:
+    /** @brief Current file format version */
+    static constexpr std::uint32_t VERSION = 1;
+    
+    /**
+     * @brief Appends one tick of input
+     */
+    void push(const InputFrame& input) { ticks.push_back(input.toBits()); }
+    
+    /**
+     * @brief Writes the recording to disk
+     * 
+     * @param path Output path (e.g. "session.inp")
+     * @return true if the file was written
+     */
+    bool saveToFile(const std::string& path) const;
+    
+    /**
+     * @brief Replaces this recording with one read from disk
+     * 
+     * The header's tick count is checked against the runs that follow it,
+     * and the runs against the file size, before any tick is allocated.
+     * 
+     * @param path Path to a file written by saveToFile()
+     * @return true if the file was valid
+     */
+    bool loadFromFile(const std::string& path);
+    
+    /** @brief Simulation timestep the input was recorded at */
+    float timestep = 0.0f;
+    
+    /** @brief Player position before the first tick */
+    float startX = 0.0f;
+    float startY = 0.0f;
+    
+    /** @brief World::checksum() before the first tick */
+    std::uint64_t initialChecksum = 0;
+    
+    /** @brief World::checksum() after the last tick */
+    std::uint64_t finalChecksum = 0;
+    
+    /** @brief One bitmask per tick (InputFrame::toBits) */
+    std::vector<std::uint8_t> ticks;
+};
+
+/**
+ * @class InputRecorder
+ * @brief Passes another source through while appending every tick to a recording
+ */
+class InputRecorder : public InputSource
+{
+public:
+    InputRecorder(InputSource& source, InputRecording& recording) 
+        : source(source), recording(recording) {}
+    
+    InputFrame next() override
+    {
+        InputFrame input = source.next();
+        recording.push(input);
+        return input;
+    }
+    
+    bool exhausted() const override { return source.exhausted(); }
+    
+private:
+    InputSource& source;
+    InputRecording& recording;
+};
+
+/**
+ * @class InputReplay
+ * @brief Plays a recording back one tick at a time
+ */
+class InputReplay : public InputSource
+{
+public:
+    explicit InputReplay(const InputRecording& recording) : recording(recording) {}
+    
+    InputFrame next() override
+    {
+        if (exhausted()) return InputFrame();
+        return InputFrame::fromBits(recording.ticks[position++]);
+    }
+    
+    bool exhausted() const override { return position >= recording.ticks.size(); }
+    
+    /** @brief Ticks replayed so far */
+    std::size_t getPosition() const { return position; }
+    
+private:
+    const InputRecording& recording;
+    std::size_t position = 0;
+};
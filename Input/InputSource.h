@@ -0,0 +1,102 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @struct InputFrame
+ * @brief Player input sampled for a single simulation tick
+ * 
+ * Decouples the simulation from sf::Keyboard so the world can be driven
+ * by the window, a script, a recording, or nothing at all (headless runs).
+ */
+struct InputFrame
+{
+    bool left = false;   ///< Move left is held
+    bool right = false;  ///< Move right is held
+    bool jump = false;   ///< Jump is held
+    
+    /** @brief Bit assigned to each button in the packed form */
+    static constexpr std::uint8_t LEFT_BIT = 1 << 0;
+    static constexpr std::uint8_t RIGHT_BIT = 1 << 1;
+    static constexpr std::uint8_t JUMP_BIT = 1 << 2;
+    
+    /**
+     * @brief Packs the buttons into a bitmask for recording
+     */
+    std::uint8_t toBits() const
+    {
+        return (left ? LEFT_BIT : 0) | (right ? RIGHT_BIT : 0) | (jump ? JUMP_BIT : 0);
+    }
+    
+    /**
+     * @brief Unpacks a bitmask produced by toBits()
+     */
+    static InputFrame fromBits(std::uint8_t bits)
+    {
+        InputFrame input;
+        input.left = (bits & LEFT_BIT) != 0;
+        input.right = (bits & RIGHT_BIT) != 0;
+        input.jump = (bits & JUMP_BIT) != 0;
+        return input;
+    }
+};
+
+/**
+ * @class InputSource
+ * @brief Supplies one InputFrame per simulation tick
+ * 
+ * World::advance() pulls from a source once per tick it runs, so a
+ * recording captures exactly what each tick saw and a replay feeds it back
+ * regardless of how ticks fall into rendered frames.
+ */
+class InputSource
+{
+public:
+    virtual ~InputSource() = default;
+    
+    /**
+     * @brief Input for the next tick
+     */
+    virtual InputFrame next() = 0;
+    
+    /**
+     * @brief True once the source has nothing more to give
+     * 
+     * World::advance() stops stepping when this turns true, so a replay
+     * never runs past its last recorded tick.
+     */
+    virtual bool exhausted() const { return false; }
+};
+
+/**
+ * @class HeldInput
+ * @brief Returns the same frame for every tick (live keyboard sampling)
+ */
+class HeldInput : public InputSource
+{
+public:
+    explicit HeldInput(const InputFrame& frame = InputFrame()) : frame(frame) {}
+    
+    InputFrame next() override { return frame; }
+    
+    /** @brief Input returned until the next assignment */
+    InputFrame frame;
+};
+
+/**
+ * @class SharedInput
+ * @brief Held input written by one thread and read by another
+ * 
+ * The window thread calls set() every rendered frame and the simulation
+ * thread reads the latest value once per tick.
+ */
+class SharedInput : public InputSource
+{
+public:
+    void set(const InputFrame& frame) { bits.store(frame.toBits(), std::memory_order_relaxed); }
+    
+    InputFrame next() override { return InputFrame::fromBits(bits.load(std::memory_order_relaxed)); }
+    
+private:
+    std::atomic<std::uint8_t> bits{ 0 };
+};
@@ -0,0 +1,160 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace
+{
+    // Queue index of the current thread (workers own 0..N-1, others have none)
+    thread_local std::size_t currentQueue = SIZE_MAX;
+    
+    // Chunks per thread; a few extra lets fast threads steal from slow ones
+    constexpr std::size_t CHUNKS_PER_THREAD = 4;
+}
+
+JobSystem::JobSystem(std::size_t workerCount)
+{
+    if (workerCount == SIZE_MAX) 
+    {
+        unsigned int cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 0;
+    }
+    
+    for (std::size_t i = 0; i < workerCount; i++) 
+    {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    workers.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; i++) 
+    {
+        workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) 
+    {
+        worker.join();
+    }
+}
+
+void JobSystem::dispatch(void (*fn)(const void*, std::size_t, std::size_t), const void* body, 
+                         std::size_t begin, std::size_t end, std::size_t grain)
+{
+    std::size_t count = end - begin;
+    grain = std::max<std::size_t>(grain, 1);
+    std::size_t chunks = std::min((count + grain - 1) / grain, threadCount() * CHUNKS_PER_THREAD);
+    
+    // Not worth waking anyone
+    if (chunks <= 1 || workers.empty()) 
+    {
+        fn(body, begin, end);
+        return;
+    }
+    
+    Group group;
+    group.remaining.store(chunks, std::memory_order_relaxed);
+    
+    // Deal chunks round-robin so every worker starts with local work
+    std::size_t chunkSize = count / chunks;
+    std::size_t extra = count % chunks;
+    std::size_t first = begin;
+    for (std::size_t c = 0; c < chunks; c++) 
+    {
+        std::size_t last = first + chunkSize + (c < extra ? 1 : 0);
+        Queue& queue = *queues[c % queues.size()];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back(Job{ fn, body, first, last, &group });
+        }
+        first = last;
+    }
+    queued.fetch_add(chunks, std::memory_order_release);
+    {
+        // Taking the lock orders the notify after any worker's idle check
+        std::lock_guard<std::mutex> lock(sleepMutex);
+    }
+    wake.notify_all();
+    
+    // Help until our chunks are done; may run other groups' jobs too
+    while (group.remaining.load(std::memory_order_acquire) != 0) 
+    {
+        if (!runOne(currentQueue)) 
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::runOne(std::size_t self)
+{
+    Job job{};
+    bool found = false;
+    
+    // Own deque first, newest job (LIFO keeps its data in cache)
+    if (self < queues.size()) 
+    {
+        Queue& own = *queues[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty()) 
+        {
+            job = own.jobs.back();
+            own.jobs.pop_back();
+            found = true;
+        }
+    }
+    
+    // Otherwise steal the oldest job from the next non-empty deque
+    if (!found) 
+    {
+        std::size_t start = self < queues.size() ? self + 1 : 0;
+        for (std::size_t k = 0; k < queues.size() && !found; k++) 
+        {
+            Queue& victim = *queues[(start + k) % queues.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.jobs.empty()) 
+            {
+                job = victim.jobs.front();
+                victim.jobs.pop_front();
+                found = true;
+                if (self < queues.size()) 
+                {
+                    steals.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+    
+    if (!found) 
+    {
+        return false;
+    }
+    
+    queued.fetch_sub(1, std::memory_order_relaxed);
+    job.fn(job.body, job.first, job.last);
+    job.group->remaining.fetch_sub(1, std::memory_order_acq_rel);
+    return true;
+}
+
+void JobSystem::workerLoop(std::size_t index)
+{
+    currentQueue = index;
+    while (true) 
+    {
+        if (runOne(index)) 
+        {
+            continue;
+        }
+        
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this] { return stopping || queued.load(std::memory_order_acquire) != 0; });
+        if (stopping && queued.load(std::memory_order_acquire) == 0) 
+        {
+            return;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @class JobSystem
+ * @brief Fixed pool of worker threads with per-worker work-stealing deques
+ * 
+ * Each worker owns a deque: it pops its newest job from the back (cache
+ * warm) and, when empty, steals the oldest job from the front of another
+ * worker's deque. parallelFor() cuts a range into chunks, spreads them over
+ * the deques and then helps run jobs on the calling thread until every
+ * chunk is done, so the call itself is the join point. Nothing touched by
+ * the body is shared between chunks unless the body shares it.
+ * 
+ * The main thread counts as one of the threads, so a JobSystem created
+ * with 0 workers runs everything inline and threadCount() is 1.
+ * 
+ * @note Bodies must not throw.
+ * 
+ * @example
+ * @code
+ * JobSystem jobs;  // one thread per core
+ * 
+ * jobs.parallelFor(0, count, 1024, [&](std::size_t first, std::size_t last) {
+ *     for (std::size_t i = first; i < last; i++) 
+ *         positions[i] += velocities[i] * dt;
+ * });
+ * // All chunks have finished here
+ * @endcode
+ */
+class JobSystem
+{
+public:
+    /**
+     * @brief Starts the worker threads
+     * 
+     * @param workerCount Workers besides the calling thread
+     *                    (SIZE_MAX = one per core minus the caller)
+     */
+    explicit JobSystem(std::size_t workerCount = SIZE_MAX);
+    
+    /**
+     * @brief Finishes queued jobs and joins the workers
+     */
+    ~JobSystem();
+    
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    
+    /**
+     * @brief Runs body(first, last) over [begin, end) in chunks of at least grain
+     * 
+     * Blocks until every chunk has run. Safe to call from inside a job.
+     * 
+     * @param begin First index
+     * @param end   One past the last index
+     * @param grain Minimum chunk size (keeps tiny ranges on one thread)
+     * @param body  Callable taking (std::size_t first, std::size_t last)
+     */
+    template <typename Body>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body&& body);
+    
+    /**
+     * @brief Number of threads that run jobs (workers plus the caller)
+     */
+    std::size_t threadCount() const { return workers.size() + 1; }
+    
+    /// @name Statistics
+    /// @{
+    
+    /** @brief Jobs a worker took from another worker's deque */
+    std::atomic<std::size_t> steals{ 0 };
+    
+    /// @}
+    
+private:
+    /** @brief Outstanding chunk count of one parallelFor call */
+    struct Group
+    {
+        std::atomic<std::size_t> remaining{ 0 };
+    };
+    
+    /** @brief One chunk; fn is a trampoline back into the templated body */
+    struct Job
+    {
+        void (*fn)(const void* body, std::size_t first, std::size_t last);
+        const void* body;
+        std::size_t first;
+        std::size_t last;
+        Group* group;
+    };
+    
+    /** @brief A worker's deque; the mutex is only contended by thieves */
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+    
+    /** @brief Splits a range into jobs and runs them to completion */
+    void dispatch(void (*fn)(const void*, std::size_t, std::size_t), const void* body, 
+                  std::size_t begin, std::size_t end, std::size_t grain);
+    
+    /** @brief Pops from own deque, else steals; false if nothing was run */
+    bool runOne(std::size_t self);
+    
+    /** @brief Worker main loop */
+    void workerLoop(std::size_t index);
+    
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    
+    /** @brief Jobs queued but not yet taken, for the idle check */
+    std::atomic<std::size_t> queued{ 0 };
+    
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    bool stopping = false;
+};
+
+template <typename Body>
+void JobSystem::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body&& body)
+{
+    if (begin >= end) return;
+    
+    using Callable = std::remove_reference_t<Body>;
+    auto trampoline = [](const void* callable, std::size_t first, std::size_t last) 
+    {
+        (*static_cast<const Callable*>(callable))(first, last);
+    };
+    dispatch(trampoline, &body, begin, end, grain);
+}
@@ -0,0 +1,350 @@
+#include "ChunkStreamer.h"
+#include "LevelFile.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+std::size_t LevelChunk::bytes() const
+{
+    return sizeof(LevelChunk) +
+           (platformX.capacity() + platformY.capacity() + platformWidth.capacity() + platformHeight.capacity()) * sizeof(float) +
+           platformColor.capacity() * sizeof(std::uint32_t) +
+           spawns.capacity() * sizeof(EnemySpawn);
+}
+
+ChunkStreamer::ChunkStreamer()
+    : resident(std::make_shared<const ChunkSet>())
+{
+}
+
+ChunkStreamer::~ChunkStreamer()
+{
+    close();
+}
+
+bool ChunkStreamer::open(const std::string& path)
+{
+    close();
+    
+    std::ifstream file(std::filesystem::path(path) / CHUNK_INDEX_FILE, std::ios::binary);
+    ChunkIndexHeader header = {};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, CHUNK_INDEX_MAGIC, sizeof(CHUNK_INDEX_MAGIC)) != 0 ||
+        header.version != LEVEL_FORMAT_VERSION || header.chunkCount == 0 || !(header.chunkWidth > 0.0f))
+    {
+        std::cout << "Invalid or outdated chunked level: " << path << std::endl;
+        return false;
+    }
+    
+    directory = path;
+    index = header;
+    chunks.assign(index.chunkCount, nullptr);
+    lastWanted.assign(index.chunkCount, 0);
+    pending.assign(index.chunkCount, 0);
+    failed.assign(index.chunkCount, 0);
+    requestedAt.assign(index.chunkCount, Clock::time_point());
+    counters = StreamingStats();
+    updates = 0;
+    totalLoadMs = 0.0;
+    publish();
+    
+    stopping = false;
+    loader = std::thread(&ChunkStreamer::workerLoop, this);
+    return true;
+}
+
+void ChunkStreamer::close()
+{
+    if (loader.joinable()) 
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wakeLoader.notify_all();
+        loader.join();
+    }
+    
+    requests.clear();
+    results.clear();
+    chunks.clear();
+    lastWanted.clear();
+    pending.clear();
+    failed.clear();
+    requestedAt.clear();
+    counters = StreamingStats();
+    publish();
+}
+
+bool ChunkStreamer::update(float focusX)
+{
+    if (chunks.empty()) 
+    {
+        return false;
+    }
+    
+    updates++;
+    std::uint32_t first = 0;
+    std::uint32_t last = 0;
+    window(focusX, first, last);
+    std::uint32_t center = chunkOf(focusX);
+    auto inWindow = [first, last](std::uint32_t chunk) { return chunk >= first && chunk <= last; };
+    
+    for (std::uint32_t c = first; c <= last; c++) 
+    {
+        lastWanted[c] = updates;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        arrived.swap(results);
+        
+        // Requests that left the window before the loader got to them
+        for (auto it = requests.begin(); it != requests.end();) 
+        {
+            if (inWindow(*it)) 
+            {
+                ++it;
+                continue;
+            }
+            pending[*it] = 0;
+            it = requests.erase(it);
+        }
+        
+        // Nearest chunks first, so the one under the focus arrives soonest
+        for (std::uint32_t distance = 0; distance <= loadRadius; distance++) 
+        {
+            for (int side = 0; side < (distance == 0 ? 1 : 2); side++) 
+            {
+                std::int64_t c = side == 0 ? std::int64_t(center) + distance : std::int64_t(center) - distance;
+                if (c < first || c > last || chunks[c] || pending[c] || failed[c]) 
+                {
+                    continue;
+                }
+                pending[c] = 1;
+                requestedAt[c] = Clock::now();
+                requests.push_back(static_cast<std::uint32_t>(c));
+            }
+        }
+    }
+    wakeLoader.notify_one();
+    
+    bool changed = false;
+    Clock::time_point now = Clock::now();
+    for (LoadResult& result : arrived) 
+    {
+        std::uint32_t c = result.index;
+        pending[c] = 0;
+        if (!result.chunk) 
+        {
+            failed[c] = 1;
+            counters.loadsFailed++;
+            continue;
+        }
+        if (!inWindow(c)) 
+        {
+            counters.loadsDiscarded++;
+            continue;
+        }
+        
+        chunks[c] = std::move(result.chunk);
+        counters.residentChunks++;
+        counters.residentBytes += chunks[c]->bytes();
+        counters.loadsCompleted++;
+        
+        double latency = std::chrono::duration<double, std::milli>(now - requestedAt[c]).count();
+        totalLoadMs += latency;
+        counters.lastLoadMs = latency;
+        counters.maxLoadMs = std::max(counters.maxLoadMs, latency);
+        counters.averageLoadMs = totalLoadMs / counters.loadsCompleted;
+        changed = true;
+    }
+    arrived.clear();
+    
+    // Over budget: drop the chunks that have been out of the window longest
+    while (counters.residentBytes > memoryBudget) 
+    {
+        std::uint32_t victim = index.chunkCount;
+        for (std::uint32_t c = 0; c < index.chunkCount; c++) 
+        {
+            if (chunks[c] && !inWindow(c) && (victim == index.chunkCount || lastWanted[c] < lastWanted[victim])) 
+            {
+                victim = c;
+            }
+        }
+        if (victim == index.chunkCount) 
+        {
+            break; // Only the window is left; it stays even over budget
+        }
+        counters.residentBytes -= chunks[victim]->bytes();
+        counters.residentChunks--;
+        counters.evictions++;
+        chunks[victim] = nullptr;
+        changed = true;
+    }
+    
+    if (!chunks[center]) 
+    {
+        counters.starvedUpdates++;
+    }
+    counters.pendingLoads = static_cast<std::size_t>(std::count(pending.begin(), pending.end(), std::uint8_t(1)));
+    
+    if (changed) 
+    {
+        publish();
+    }
+    else 
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        stats = counters;
+    }
+    return changed;
+}
+
+bool ChunkStreamer::isReady(float focusX) const
+{
+    if (chunks.empty()) 
+    {
+        return true;
+    }
+    
+    std::uint32_t first = 0;
+    std::uint32_t last = 0;
+    window(focusX, first, last);
+    for (std::uint32_t c = first; c <= last; c++) 
+    {
+        if (!chunks[c] && !failed[c]) 
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ChunkStreamer::waitUntilReady(float focusX)
+{
+    update(focusX);
+    while (!isReady(focusX)) 
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            loadFinished.wait(lock, [this]() { return !results.empty() || stopping; });
+        }
+        update(focusX);
+    }
+}
+
+std::shared_ptr<const ChunkSet> ChunkStreamer::getResident() const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    return resident;
+}
+
+std::uint64_t ChunkStreamer::getGeneration() const
+{
+    return generation.load(std::memory_order_acquire);
+}
+
+StreamingStats ChunkStreamer::getStats() const
+{
+    std::lock_guard<std::mutex> lock(snapshotMutex);
+    return stats;
+}
+
+const ChunkIndexHeader& ChunkStreamer::header() const
+{
+    return index;
+}
+
+std::uint32_t ChunkStreamer::chunkOf(float x) const
+{
+    if (index.chunkCount == 0) 
+    {
+        return 0;
+    }
+    float chunk = std::floor(x / index.chunkWidth);
+    return static_cast<std::uint32_t>(std::min(std::max(chunk, 0.0f), static_cast<float>(index.chunkCount - 1)));
+}
+
+void ChunkStreamer::window(float focusX, std::uint32_t& first, std::uint32_t& last) const
+{
+    std::uint32_t center = chunkOf(focusX);
+    first = center > loadRadius ? center - loadRadius : 0;
+    last = std::min<std::uint32_t>(index.chunkCount - 1, center + loadRadius);
+}
+
+void ChunkStreamer::publish()
+{
+    auto set = std::make_shared<ChunkSet>();
+    for (const auto& chunk : chunks) 
+    {
+        if (chunk) 
+        {
+            set->push_back(chunk);
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(snapshotMutex);
+        resident = std::move(set);
+        stats = counters;
+    }
+    generation.fetch_add(1, std::memory_order_release);
+}
+
+void ChunkStreamer::workerLoop()
+{
+    for (;;) 
+    {
+        std::uint32_t chunk = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeLoader.wait(lock, [this]() { return stopping || !requests.empty(); });
+            if (stopping) 
+            {
+                loadFinished.notify_all();
+                return;
+            }
+            chunk = requests.front();
+            requests.pop_front();
+        }
+        
+        // All file access happens here, outside the lock
+        std::shared_ptr<const LevelChunk> loaded = loadChunk(chunk);
+        
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            results.push_back(LoadResult{ chunk, std::move(loaded) });
+        }
+        loadFinished.notify_all();
+    }
+}
+
+std::shared_ptr<const LevelChunk> ChunkStreamer::loadChunk(std::uint32_t chunkIndex) const
+{
+    char name[64];
+    std::snprintf(name, sizeof(name), CHUNK_FILE_PATTERN, static_cast<unsigned int>(chunkIndex));
+    LevelFile file;
+    if (!file.open((std::filesystem::path(directory) / name).string())) 
+    {
+        return nullptr;
+    }
+    
+    // Copy out of the mapping so readers never fault pages in from disk
+    auto chunk = std::make_shared<LevelChunk>();
+    chunk->index = chunkIndex;
+    chunk->left = chunkIndex * index.chunkWidth;
+    chunk->right = (chunkIndex + 1) * index.chunkWidth;
+    std::size_t count = file.platformCount();
+    chunk->platformX.assign(file.platformX(), file.platformX() + count);
+    chunk->platformY.assign(file.platformY(), file.platformY() + count);
+    chunk->platformWidth.assign(file.platformWidth(), file.platformWidth() + count);
+    chunk->platformHeight.assign(file.platformHeight(), file.platformHeight() + count);
+    chunk->platformColor.assign(file.platformColor(), file.platformColor() + count);
+    chunk->spawns.assign(file.spawns(), file.spawns() + file.spawnCount());
+    return chunk;
+}
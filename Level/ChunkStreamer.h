@@ -0,0 +1,243 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "LevelFormat.h"
+
+/**
+ * @struct LevelChunk
+ * @brief One chunk of a chunked level, copied out of its file into memory
+ * 
+ * Immutable once loaded; shared between the simulation and the renderer.
+ */
+struct LevelChunk
+{
+    std::uint32_t index = 0;  ///< Chunk number
+    float left = 0.0f;        ///< X where the chunk starts
+    float right = 0.0f;       ///< X where the next chunk starts
+    
+    /// @name Platform Arrays (same layout as LevelSource)
+    /// @{
+    std::vector<float> platformX;
+    std::vector<float> platformY;
+    std::vector<float> platformWidth;
+    std::vector<float> platformHeight;
+    std::vector<std::uint32_t> platformColor;
+    /// @}
+    
+    /** @brief Enemies to spawn while the chunk is resident */
+    std::vector<EnemySpawn> spawns;
+    
+    /** @brief Heap memory held by the chunk, counted against the budget */
+    std::size_t bytes() const;
+};
+
+/** @brief Resident chunks, sorted by index */
+using ChunkSet = std::vector<std::shared_ptr<const LevelChunk>>;
+
+/**
+ * @struct StreamingStats
+ * @brief Residency and load latency of a ChunkStreamer
+ */
+struct StreamingStats
+{
+    std::size_t residentChunks = 0;  ///< Chunks in memory
+    std::size_t residentBytes = 0;   ///< Memory they hold
+    std::size_t pendingLoads = 0;    ///< Requested, not yet resident
+    std::size_t loadsCompleted = 0;  ///< Chunks that became resident
+    std::size_t loadsDiscarded = 0;  ///< Loads that arrived after leaving the load window
+    std::size_t loadsFailed = 0;     ///< Chunk files that could not be read
+    std::size_t evictions = 0;       ///< Chunks dropped to meet the budget
+    std::size_t starvedUpdates = 0;  ///< update() calls whose focus chunk was not resident
+    double lastLoadMs = 0.0;         ///< Request-to-resident time of the latest load
+    double averageLoadMs = 0.0;      ///< Mean request-to-resident time
+    double maxLoadMs = 0.0;          ///< Worst request-to-resident time
+};
+
+/**
+ * @class ChunkStreamer
+ * @brief Keeps the chunks around a focus point resident, loading on a worker
+ * 
+ * Call update() with the camera (or player) X once per tick. It requests
+ * every chunk within loadRadius of the focus that is not resident yet, picks
+ * up chunks the loader thread has finished, and evicts chunks outside the
+ * load window, least recently wanted first, while the resident set is over
+ * memoryBudget. Chunks inside the window are never evicted.
+ * 
+ * The loader thread does all file access and copies each chunk into plain
+ * vectors, so nothing update() touches can page-fault on the file. update()
+ * only ever takes a mutex for queue bookkeeping and never waits for I/O.
+ * 
+ * Loads that finish after their chunk left the window are dropped instead
+ * of becoming resident. The resident set still depends on how fast the
+ * disk is, because a chunk that is still loading is simply missing. It
+ * depends on nothing but the sequence of focus positions only if the
+ * caller waits for the window before every tick (waitUntilReady(), which
+ * World::waitForChunks does).
+ * 
+ * @note update() must be called from one thread. getResident(),
+ *       getGeneration() and getStats() may be called from any thread.
+ * 
+ * @example
+ * @code
+ * ChunkStreamer streamer;
+ * streamer.open("assets/Levels/long");
+ * streamer.waitUntilReady(spawnX); // Startup only
+ * 
+ * // Every tick:
+ * if (streamer.update(player.getPosition().x)) {
+ *     rebuildFrom(*streamer.getResident());
+ * }
+ * @endcode
+ */
+class ChunkStreamer
+{
+public:
+    ChunkStreamer();
+    
+    /**
+     * @brief Stops the loader thread
+     */
+    ~ChunkStreamer();
+    
+    ChunkStreamer(const ChunkStreamer&) = delete;
+    ChunkStreamer& operator=(const ChunkStreamer&) = delete;
+    
+    /**
+     * @brief Reads a chunked level's index and starts the loader thread
+     * 
+     * @param directory Directory written by LevelSource::writeChunks
+     * @return true if the index is valid
+     */
+    bool open(const std::string& directory);
+    
+    /**
+     * @brief Stops loading and drops every chunk
+     */
+    void close();
+    
+    /**
+     * @brief Moves the load window to a new focus point (never blocks on I/O)
+     * 
+     * @param focusX World X the window is centered on
+     * @return true if the resident set changed
+     */
+    bool update(float focusX);
+    
+    /**
+     * @brief Whether every chunk in the window around focusX is resident
+     * 
+     * Chunks whose file failed to load count as ready.
+     */
+    bool isReady(float focusX) const;
+    
+    /**
+     * @brief Calls update() until isReady(), sleeping while the loader works
+     * 
+     * For startup, offline tools and runs that have to be reproducible
+     * (World::waitForChunks); live play would stall on a slow disk.
+     * 
+     * @param focusX World X the window is centered on
+     */
+    void waitUntilReady(float focusX);
+    
+    /**
+     * @brief The resident chunks as of the last change
+     * 
+     * The returned set is immutable and stays valid for as long as the
+     * caller holds it, even after later updates evict its chunks.
+     */
+    std::shared_ptr<const ChunkSet> getResident() const;
+    
+    /** @brief Increases every time the resident set changes */
+    std::uint64_t getGeneration() const;
+    
+    /** @brief Counters and latencies (copy) */
+    StreamingStats getStats() const;
+    
+    /** @brief The level's index (valid after open()) */
+    const ChunkIndexHeader& header() const;
+    
+    /** @brief Chunk containing a world X, clamped to the level */
+    std::uint32_t chunkOf(float x) const;
+    
+    /** @brief Chunks kept on each side of the focus chunk */
+    std::uint32_t loadRadius = 1;
+    
+    /** @brief Resident memory allowed before chunks outside the window are evicted */
+    std::size_t memoryBudget = 8u << 20;
+    
+private:
+    using Clock = std::chrono::steady_clock;
+    
+    /** @brief A finished load handed from the loader thread to update() */
+    struct LoadResult
+    {
+        std::uint32_t index;
+        std::shared_ptr<const LevelChunk> chunk;  ///< nullptr if the file could not be read
+    };
+    
+    /** @brief Loader thread body */
+    void workerLoop();
+    
+    /** @brief Reads and copies one chunk file (loader thread) */
+    std::shared_ptr<const LevelChunk> loadChunk(std::uint32_t index) const;
+    
+    /** @brief First and last chunk of the window around focusX */
+    void window(float focusX, std::uint32_t& first, std::uint32_t& last) const;
+    
+    /** @brief Publishes the current resident chunks for getResident() */
+    void publish();
+    
+    /** @brief Directory passed to open() */
+    std::string directory;
+    
+    /** @brief Index read by open() */
+    ChunkIndexHeader index = {};
+    
+    /// @name Residency (update() thread only)
+    /// @{
+    
+    std::vector<std::shared_ptr<const LevelChunk>> chunks;  ///< Per chunk, nullptr unless resident
+    std::vector<std::uint64_t> lastWanted;                  ///< update() count when last in the window
+    std::vector<std::uint8_t> pending;                      ///< 1 while requested and not back
+    std::vector<std::uint8_t> failed;                       ///< 1 if the file could not be read
+    std::vector<Clock::time_point> requestedAt;             ///< When each pending load was queued
+    std::vector<LoadResult> arrived;                        ///< Scratch for results taken from the loader
+    StreamingStats counters;                                ///< Copied to stats after every update()
+    std::uint64_t updates = 0;
+    double totalLoadMs = 0.0;
+    
+    /// @}
+    
+    /// @name Loader Thread Handoff (guarded by mutex)
+    /// @{
+    
+    std::mutex mutex;
+    std::condition_variable wakeLoader;
+    std::condition_variable loadFinished;
+    std::deque<std::uint32_t> requests;
+    std::vector<LoadResult> results;
+    bool stopping = false;
+    std::thread loader;
+    
+    /// @}
+    
+    /// @name Published State (guarded by snapshotMutex)
+    /// @{
+    
+    mutable std::mutex snapshotMutex;
+    std::shared_ptr<const ChunkSet> resident;
+    StreamingStats stats;
+    std::atomic<std::uint64_t> generation{ 0 };
+    
+    /// @}
+};
@@ -0,0 +1,194 @@
+#include "LevelFile.h"
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+LevelFile::LevelFile()
+    : data(nullptr),
+    size(0)
+#ifdef _WIN32
+    , fileHandle(nullptr),
+    mappingHandle(nullptr)
+#endif
+{
+}
+
+LevelFile::~LevelFile()
+{
+    close();
+}
+
+bool LevelFile::open(const std::string& path)
+{
+    close();
+    
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, 
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) 
+    {
+        std::cout << "Failed to open level file: " << path << std::endl;
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    GetFileSizeEx(file, &fileSize);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) 
+    {
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        std::cout << "Failed to map level file: " << path << std::endl;
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const unsigned char*>(view);
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) 
+    {
+        std::cout << "Failed to open level file: " << path << std::endl;
+        return false;
+    }
+    struct stat info;
+    void* view = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0) 
+    {
+        view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    ::close(fd); // The mapping keeps the file alive
+    if (view == MAP_FAILED) 
+    {
+        std::cout << "Failed to map level file: " << path << std::endl;
+        return false;
+    }
+    data = static_cast<const unsigned char*>(view);
+    size = static_cast<std::size_t>(info.st_size);
+#endif
+    
+    // Validate header and that every array lies inside the file
+    const LevelHeader& h = header();
+    bool valid = size >= sizeof(LevelHeader) && 
+                 std::memcmp(h.magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC)) == 0 && 
+                 h.version == LEVEL_FORMAT_VERSION;
+    if (valid) 
+    {
+        std::uint64_t floats = static_cast<std::uint64_t>(h.platformCount) * sizeof(float);
+        std::uint64_t colors = static_cast<std::uint64_t>(h.platformCount) * sizeof(std::uint32_t);
+        std::uint64_t spawnBytes = static_cast<std::uint64_t>(h.spawnCount) * sizeof(EnemySpawn);
+        auto fits = [this](std::uint64_t offset, std::uint64_t bytes) 
+        {
+            return offset % 4 == 0 && offset <= size && bytes <= size - offset;
+        };
+        valid = fits(h.platformXOffset, floats) && fits(h.platformYOffset, floats) && 
+                fits(h.platformWidthOffset, floats) && fits(h.platformHeightOffset, floats) && 
+                fits(h.platformColorOffset, colors) && fits(h.spawnOffset, spawnBytes);
+    }
+    if (!valid) 
+    {
+        std::cout << "Invalid or outdated level file: " << path << std::endl;
+        close();
+        return false;
+    }
+    
+    return true;
+}
+
+void LevelFile::close()
+{
+    if (!data) 
+    {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<unsigned char*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+}
+
+bool LevelFile::isOpen() const
+{
+    return data != nullptr;
+}
+
+const LevelHeader& LevelFile::header() const
+{
+    return *static_cast<const LevelHeader*>(at(0));
+}
+
+std::size_t LevelFile::platformCount() const
+{
+    return header().platformCount;
+}
+
+const float* LevelFile::platformX() const
+{
+    return static_cast<const float*>(at(header().platformXOffset));
+}
+
+const float* LevelFile::platformY() const
+{
+    return static_cast<const float*>(at(header().platformYOffset));
+}
+
+const float* LevelFile::platformWidth() const
+{
+    return static_cast<const float*>(at(header().platformWidthOffset));
+}
+
+const float* LevelFile::platformHeight() const
+{
+    return static_cast<const float*>(at(header().platformHeightOffset));
+}
+
+const std::uint32_t* LevelFile::platformColor() const
+{
+    return static_cast<const std::uint32_t*>(at(header().platformColorOffset));
+}
+
+std::size_t LevelFile::spawnCount() const
+{
+    return header().spawnCount;
+}
+
+const EnemySpawn* LevelFile::spawns() const
+{
+    return static_cast<const EnemySpawn*>(at(header().spawnOffset));
+}
+
+void LevelFile::createPlatforms(std::vector<Platform>& platforms) const
+{
+    platforms.clear();
+    platforms.reserve(platformCount());
+    for (std::size_t i = 0; i < platformCount(); i++) 
+    {
+        platforms.push_back(Platform(platformX()[i], platformY()[i], 
+                                     platformWidth()[i], platformHeight()[i], 
+                                     sf::Color(platformColor()[i])));
+    }
+}
+
+const void* LevelFile::at(std::uint64_t offset) const
+{
+    return data + offset;
+}
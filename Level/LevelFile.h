@@ -0,0 +1,98 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "LevelFormat.h"
+#include "../Platform/Platform.h"
+
+/**
+ * @class LevelFile
+ * @brief Read-only, memory-mapped view of a binary level file
+ * 
+ * open() maps the file and validates the header; after that every array is
+ * read straight out of the mapping. Building the collision grid or render
+ * geometry from these views touches each platform once and allocates
+ * nothing per platform.
+ * 
+ * @example
+ * @code
+ * LevelFile level;
+ * if (level.open("assets/Levels/level1.lvl")) {
+ *     grid.build(level.platformX(), level.platformY(),
+ *                level.platformWidth(), level.platformHeight(),
+ *                level.platformCount());
+ * }
+ * @endcode
+ */
+class LevelFile
+{
+public:
+    LevelFile();
+    
+    /**
+     * @brief Unmaps the file
+     */
+    ~LevelFile();
+    
+    LevelFile(const LevelFile&) = delete;
+    LevelFile& operator=(const LevelFile&) = delete;
+    
+    /**
+     * @brief Maps a level file and validates its header and array bounds
+     * 
+     * @param path Path to a .lvl file written by LevelSource::writeBinary
+     * @return true if the file is a valid level of the current version
+     */
+    bool open(const std::string& path);
+    
+    /**
+     * @brief Unmaps the file (views become invalid)
+     */
+    void close();
+    
+    /** @brief Whether a level is currently mapped */
+    bool isOpen() const;
+    
+    /** @brief The mapped header (only valid while open) */
+    const LevelHeader& header() const;
+    
+    /// @name Zero-Copy Views (valid while open)
+    /// @{
+    
+    std::size_t platformCount() const;
+    const float* platformX() const;
+    const float* platformY() const;
+    const float* platformWidth() const;
+    const float* platformHeight() const;
+    const std::uint32_t* platformColor() const;
+    
+    std::size_t spawnCount() const;
+    const EnemySpawn* spawns() const;
+    
+    /// @}
+    
+    /**
+     * @brief Creates Platform objects for code that still needs shapes
+     * 
+     * @param platforms Vector to fill (cleared first)
+     */
+    void createPlatforms(std::vector<Platform>& platforms) const;
+    
+private:
+    /** @brief Returns a pointer `offset` bytes into the mapping */
+    const void* at(std::uint64_t offset) const;
+    
+    /** @brief Start of the mapping */
+    const unsigned char* data;
+    
+    /** @brief Size of the mapping in bytes */
+    std::size_t size;
+    
+#ifdef _WIN32
+    /** @brief File and mapping handles (Win32 HANDLEs) */
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+};
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @file LevelFormat.h
+ * @brief On-disk layout of binary level files (.lvl)
+ * 
+ * A level file is a fixed header followed by flat arrays, each starting at a
+ * 16-byte aligned offset recorded in the header:
+ * 
+ * @code
+ * LevelHeader
+ * float       platformX[platformCount]      // top-left X
+ * float       platformY[platformCount]      // top-left Y
+ * float       platformWidth[platformCount]
+ * float       platformHeight[platformCount]
+ * uint32_t    platformColor[platformCount]  // RGBA, sf::Color::toInteger()
+ * EnemySpawn  spawns[spawnCount]
+ * @endcode
+ * 
+ * Everything is little-endian and used in place after mapping the file, so
+ * loading does no per-element parsing or allocation.
+ */
+
+/** @brief Magic bytes at the start of every level file */
+constexpr char LEVEL_MAGIC[4] = { 'L', 'V', 'L', 'B' };
+
+/** @brief Current format version; bump on any layout change */
+constexpr std::uint32_t LEVEL_FORMAT_VERSION = 1;
+
+/**
+ * @struct LevelHeader
+ * @brief Fixed-size header at offset 0 of a level file
+ */
+struct LevelHeader
+{
+    char magic[4];                   ///< LEVEL_MAGIC
+    std::uint32_t version;           ///< LEVEL_FORMAT_VERSION
+    std::uint32_t platformCount;     ///< Entries in each platform array
+    std::uint32_t spawnCount;        ///< Entries in the spawn table
+    float playerX;                   ///< Player spawn (center point)
+    float playerY;
+    float worldWidth;                ///< Horizontal extent the player is clamped to
+    float worldHeight;
+    std::uint64_t platformXOffset;   ///< Byte offsets of each array
+    std::uint64_t platformYOffset;
+    std::uint64_t platformWidthOffset;
+    std::uint64_t platformHeightOffset;
+    std::uint64_t platformColorOffset;
+    std::uint64_t spawnOffset;
+};
+
+/**
+ * @struct EnemySpawn
+ * @brief One entry of the enemy spawn table
+ */
+struct EnemySpawn
+{
+    float x;              ///< Spawn position (center point)
+    float y;
+    std::uint32_t type;   ///< EnemyType value
+    std::uint32_t flags;  ///< Reserved, written as 0
+};
+
+/** @brief Magic bytes at the start of a chunked level's index file */
+constexpr char CHUNK_INDEX_MAGIC[4] = { 'L', 'V', 'L', 'C' };
+
+/** @brief Name of the index file inside a chunked level directory */
+constexpr char CHUNK_INDEX_FILE[] = "chunks.idx";
+
+/** @brief printf pattern for the chunk files inside a chunked level directory */
+constexpr char CHUNK_FILE_PATTERN[] = "chunk_%05u.lvl";
+
+/**
+ * @struct ChunkIndexHeader
+ * @brief Contents of CHUNK_INDEX_FILE
+ * 
+ * A chunked level is a directory holding this index and one ordinary level
+ * file per chunk. Chunk i covers x in [i * chunkWidth, (i + 1) * chunkWidth);
+ * platforms crossing a boundary are split so every piece lives in exactly
+ * one chunk, and spawns go to the chunk containing their x.
+ */
+struct ChunkIndexHeader
+{
+    char magic[4];              ///< CHUNK_INDEX_MAGIC
+    std::uint32_t version;      ///< LEVEL_FORMAT_VERSION
+    std::uint32_t chunkCount;   ///< Number of chunk files
+    float chunkWidth;           ///< Width of every chunk in pixels
+    float playerX;              ///< Player spawn (center point)
+    float playerY;
+    float worldWidth;           ///< Horizontal extent the player is clamped to
+    float worldHeight;
+};
+
+static_assert(sizeof(LevelHeader) == 80, "LevelHeader layout changed; bump LEVEL_FORMAT_VERSION");
+static_assert(sizeof(EnemySpawn) == 16, "EnemySpawn layout changed; bump LEVEL_FORMAT_VERSION");
+static_assert(sizeof(ChunkIndexHeader) == 32, "ChunkIndexHeader layout changed; bump LEVEL_FORMAT_VERSION");
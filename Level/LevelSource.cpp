@@ -0,0 +1,282 @@
+#include "LevelSource.h"
+#include "../Enemy/Enemy.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+namespace
+{
+    // Arrays start on 16-byte boundaries so they can be loaded with SIMD
+    std::uint64_t alignUp(std::uint64_t offset)
+    {
+        return (offset + 15) & ~std::uint64_t(15);
+    }
+    
+    // Write `bytes` at `offset`, zero-padding from the current position
+    void writeAt(std::ofstream& out, std::uint64_t offset, const void* source, std::size_t bytes)
+    {
+        static const char zeros[16] = {};
+        std::uint64_t position = static_cast<std::uint64_t>(out.tellp());
+        out.write(zeros, static_cast<std::streamsize>(offset - position));
+        out.write(static_cast<const char*>(source), static_cast<std::streamsize>(bytes));
+    }
+}
+
+void LevelSource::addPlatform(float x, float y, float width, float height, sf::Color color)
+{
+    platformX.push_back(x);
+    platformY.push_back(y);
+    platformWidth.push_back(width);
+    platformHeight.push_back(height);
+    platformColor.push_back(color.toInteger());
+}
+
+bool LevelSource::loadFromText(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file) 
+    {
+        std::cout << "Failed to open level source: " << path << std::endl;
+        return false;
+    }
+    
+    *this = LevelSource();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) 
+    {
+        lineNumber++;
+        std::istringstream in(line);
+        std::string kind;
+        if (!(in >> kind) || kind[0] == '#') 
+        {
+            continue;
+        }
+        
+        bool ok = false;
+        if (kind == "world") 
+        {
+            ok = static_cast<bool>(in >> worldSize.x >> worldSize.y);
+        }
+        else if (kind == "player") 
+        {
+            ok = static_cast<bool>(in >> playerSpawn.x >> playerSpawn.y);
+        }
+        else if (kind == "platform") 
+        {
+            float x, y, w, h;
+            int r, g, b, a = 255;
+            ok = static_cast<bool>(in >> x >> y >> w >> h >> r >> g >> b);
+            if (ok) 
+            {
+                in >> a; // Optional alpha
+                addPlatform(x, y, w, h, sf::Color(static_cast<std::uint8_t>(r), static_cast<std::uint8_t>(g), 
+                                                  static_cast<std::uint8_t>(b), static_cast<std::uint8_t>(a)));
+            }
+        }
+        else if (kind == "enemy") 
+        {
+            std::string family;
+            EnemySpawn spawn = {};
+            ok = static_cast<bool>(in >> family >> spawn.x >> spawn.y);
+            
+            // Map the folder name back to its EnemyType
+            bool known = false;
+            for (std::uint32_t t = 0; t < static_cast<std::uint32_t>(EnemyType::COUNT); t++) 
+            {
+                if (family == Enemy::familyName(static_cast<EnemyType>(t))) 
+                {
+                    spawn.type = t;
+                    known = true;
+                }
+            }
+            ok = ok && known;
+            if (ok) 
+            {
+                spawns.push_back(spawn);
+            }
+        }
+        
+        if (!ok) 
+        {
+            std::cout << path << ":" << lineNumber << ": malformed level record: " << line << std::endl;
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+bool LevelSource::writeText(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) 
+    {
+        std::cout << "Failed to create level source: " << path << std::endl;
+        return false;
+    }
+    
+    out << "world " << worldSize.x << " " << worldSize.y << "\n"
+        << "player " << playerSpawn.x << " " << playerSpawn.y << "\n";
+    for (std::size_t i = 0; i < platformX.size(); i++) 
+    {
+        sf::Color c(platformColor[i]);
+        out << "platform " << platformX[i] << " " << platformY[i] << " " 
+            << platformWidth[i] << " " << platformHeight[i] << " " 
+            << int(c.r) << " " << int(c.g) << " " << int(c.b) << " " << int(c.a) << "\n";
+    }
+    for (const EnemySpawn& spawn : spawns) 
+    {
+        out << "enemy " << Enemy::familyName(static_cast<EnemyType>(spawn.type)) << " " 
+            << spawn.x << " " << spawn.y << "\n";
+    }
+    
+    return static_cast<bool>(out);
+}
+
+bool LevelSource::writeBinary(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) 
+    {
+        std::cout << "Failed to create level file: " << path << std::endl;
+        return false;
+    }
+    
+    const std::uint64_t count = platformX.size();
+    const std::uint64_t floatBytes = count * sizeof(float);
+    
+    LevelHeader header = {};
+    std::memcpy(header.magic, LEVEL_MAGIC, sizeof(LEVEL_MAGIC));
+    header.version = LEVEL_FORMAT_VERSION;
+    header.platformCount = static_cast<std::uint32_t>(count);
+    header.spawnCount = static_cast<std::uint32_t>(spawns.size());
+    header.playerX = playerSpawn.x;
+    header.playerY = playerSpawn.y;
+    header.worldWidth = worldSize.x;
+    header.worldHeight = worldSize.y;
+    header.platformXOffset = alignUp(sizeof(LevelHeader));
+    header.platformYOffset = alignUp(header.platformXOffset + floatBytes);
+    header.platformWidthOffset = alignUp(header.platformYOffset + floatBytes);
+    header.platformHeightOffset = alignUp(header.platformWidthOffset + floatBytes);
+    header.platformColorOffset = alignUp(header.platformHeightOffset + floatBytes);
+    header.spawnOffset = alignUp(header.platformColorOffset + count * sizeof(std::uint32_t));
+    
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeAt(out, header.platformXOffset, platformX.data(), floatBytes);
+    writeAt(out, header.platformYOffset, platformY.data(), floatBytes);
+    writeAt(out, header.platformWidthOffset, platformWidth.data(), floatBytes);
+    writeAt(out, header.platformHeightOffset, platformHeight.data(), floatBytes);
+    writeAt(out, header.platformColorOffset, platformColor.data(), count * sizeof(std::uint32_t));
+    writeAt(out, header.spawnOffset, spawns.data(), spawns.size() * sizeof(EnemySpawn));
+    
+    return static_cast<bool>(out);
+}
+
+bool LevelSource::writeChunks(const std::string& directory, float chunkWidth) const
+{
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error || chunkWidth <= 0.0f) 
+    {
+        std::cout << "Failed to create chunk directory: " << directory << std::endl;
+        return false;
+    }
+    
+    const std::uint32_t chunkCount = std::max<std::uint32_t>(1, static_cast<std::uint32_t>(std::ceil(worldSize.x / chunkWidth)));
+    auto chunkOf = [&](float x) 
+    {
+        float index = std::floor(x / chunkWidth);
+        return static_cast<std::uint32_t>(std::min(std::max(index, 0.0f), static_cast<float>(chunkCount - 1)));
+    };
+    
+    std::vector<LevelSource> chunks(chunkCount);
+    for (LevelSource& chunk : chunks) 
+    {
+        chunk.worldSize = worldSize;
+        chunk.playerSpawn = playerSpawn;
+    }
+    
+    // Cut platforms at chunk boundaries; the outermost chunks keep whatever
+    // hangs off the ends of the world
+    for (std::size_t i = 0; i < platformX.size(); i++) 
+    {
+        float left = platformX[i];
+        float right = platformX[i] + platformWidth[i];
+        std::uint32_t first = chunkOf(left);
+        std::uint32_t last = chunkOf(std::nextafter(right, left));
+        for (std::uint32_t c = first; c <= last; c++) 
+        {
+            float pieceLeft = c == first ? left : c * chunkWidth;
+            float pieceRight = c == last ? right : (c + 1) * chunkWidth;
+            chunks[c].addPlatform(pieceLeft, platformY[i], pieceRight - pieceLeft, platformHeight[i], sf::Color(platformColor[i]));
+        }
+    }
+    for (const EnemySpawn& spawn : spawns) 
+    {
+        chunks[chunkOf(spawn.x)].spawns.push_back(spawn);
+    }
+    
+    for (std::uint32_t c = 0; c < chunkCount; c++) 
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), CHUNK_FILE_PATTERN, static_cast<unsigned int>(c));
+        if (!chunks[c].writeBinary((std::filesystem::path(directory) / name).string())) 
+        {
+            return false;
+        }
+    }
+    
+    ChunkIndexHeader index = {};
+    std::memcpy(index.magic, CHUNK_INDEX_MAGIC, sizeof(CHUNK_INDEX_MAGIC));
+    index.version = LEVEL_FORMAT_VERSION;
+    index.chunkCount = chunkCount;
+    index.chunkWidth = chunkWidth;
+    index.playerX = playerSpawn.x;
+    index.playerY = playerSpawn.y;
+    index.worldWidth = worldSize.x;
+    index.worldHeight = worldSize.y;
+    
+    std::ofstream out(std::filesystem::path(directory) / CHUNK_INDEX_FILE, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char*>(&index), sizeof(index));
+    if (!out) 
+    {
+        std::cout << "Failed to write chunk index in: " << directory << std::endl;
+        return false;
+    }
+    return true;
+}
+
+LevelSource LevelSource::generate(std::size_t platformCount, unsigned int seed)
+{
+    LevelSource level;
+    float width = std::max(800.0f, static_cast<float>(platformCount) * 40.0f);
+    level.worldSize = sf::Vector2f(width, 600.0f);
+    level.playerSpawn = sf::Vector2f(100.0f, 400.0f);
+    if (platformCount == 0) 
+    {
+        return level;
+    }
+    level.addPlatform(0, 550, width, 50, sf::Color::Green);
+    
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> xDist(0.0f, width - 150.0f);
+    std::uniform_real_distribution<float> yDist(100.0f, 500.0f);
+    for (std::size_t i = 1; i < platformCount; i++) 
+    {
+        level.addPlatform(xDist(rng), yDist(rng), 150, 20, sf::Color::Black);
+    }
+    
+    std::uint32_t typeCount = static_cast<std::uint32_t>(EnemyType::COUNT);
+    for (std::size_t i = 0; i < platformCount / 100; i++) 
+    {
+        level.spawns.push_back(EnemySpawn{ xDist(rng), 500.0f, static_cast<std::uint32_t>(i) % typeCount, 0 });
+    }
+    return level;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "LevelFormat.h"
+
+/**
+ * @struct LevelSource
+ * @brief Editable, in-memory level used by tools to produce .lvl files
+ * 
+ * Holds the same arrays as the binary format. It can be filled from the
+ * human-readable text format and written out as a binary level that
+ * LevelFile maps at runtime.
+ * 
+ * Text format (one record per line, '#' starts a comment):
+ * @code
+ * world    <width> <height>
+ * player   <x> <y>
+ * platform <x> <y> <width> <height> <r> <g> <b> [a]
+ * enemy    <family> <x> <y>        # family = folder under assets/Enemies
+ * @endcode
+ */
+struct LevelSource
+{
+    /** @brief Player spawn (center point) */
+    sf::Vector2f playerSpawn = sf::Vector2f(20.0f, 550.0f);
+    
+    /** @brief World size; the player is clamped to [0, width] */
+    sf::Vector2f worldSize = sf::Vector2f(800.0f, 600.0f);
+    
+    /// @name Platform Arrays (same layout as the binary file)
+    /// @{
+    std::vector<float> platformX;
+    std::vector<float> platformY;
+    std::vector<float> platformWidth;
+    std::vector<float> platformHeight;
+    std::vector<std::uint32_t> platformColor;
+    /// @}
+    
+    /** @brief Enemy spawn table */
+    std::vector<EnemySpawn> spawns;
+    
+    /**
+     * @brief Appends a platform
+     */
+    void addPlatform(float x, float y, float width, float height, sf::Color color);
+    
+    /**
+     * @brief Parses a text level, replacing the current contents
+     * 
+     * @param path Path to the text source
+     * @return true on success; errors are reported with their line number
+     */
+    bool loadFromText(const std::string& path);
+    
+    /**
+     * @brief Writes the level in the text format
+     * 
+     * @param path Output path (conventionally *.txt)
+     * @return true if the file was written completely
+     */
+    bool writeText(const std::string& path) const;
+    
+    /**
+     * @brief Writes the level in the binary format described in LevelFormat.h
+     * 
+     * @param path Output path (conventionally *.lvl)
+     * @return true if the file was written completely
+     */
+    bool writeBinary(const std::string& path) const;
+    
+    /**
+     * @brief Writes the level as a chunked level directory for streaming
+     * 
+     * Creates the directory if needed, then writes one binary level per
+     * chunk plus the index described by ChunkIndexHeader. Platforms that
+     * cross a chunk boundary are split at it.
+     * 
+     * @param directory  Output directory
+     * @param chunkWidth Width of each chunk in pixels
+     * @return true if every file was written completely
+     */
+    bool writeChunks(const std::string& directory, float chunkWidth) const;
+    
+    /**
+     * @brief Builds a synthetic level for stress tests and benchmarks
+     * 
+     * A ground strip plus randomly scattered 150x20 ledges over a level
+     * whose width grows with the platform count, and one enemy spawn per
+     * hundred platforms.
+     * 
+     * @param platformCount Total number of platforms (including the ground)
+     * @param seed          Random seed, so runs are reproducible
+     */
+    static LevelSource generate(std::size_t platformCount, unsigned int seed = 2024);
+};
@@ -0,0 +1,139 @@
+#include "EnemyNavigator.h"
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // EnemyPool::plan values: a link index, CHASE | span index, or STAY
+    constexpr std::uint32_t CHASE = 0x80000000u;
+    constexpr std::uint32_t STAY = 0xFFFFFFFEu;
+}
+
+EnemyNavigator::EnemyNavigator(const NavParams& params)
+    : graph(params)
+{
+}
+
+void EnemyNavigator::steer(EnemyPool& enemies, const SpatialGrid& grid, const sf::Vector2f& target)
+{
+    prepare(enemies, grid, target);
+    for (std::size_t i = 0; i < enemies.size(); i++) 
+    {
+        if (enemies.onGround[i] && enemies.state[i] != EnemyState::DEAD) 
+        {
+            think(enemies, i);
+        }
+    }
+    move(enemies);
+}
+
+void EnemyNavigator::prepare(EnemyPool& enemies, const SpatialGrid& grid, const sf::Vector2f& target)
+{
+    if (graph.gridVersion != grid.version) 
+    {
+        PROFILE_SCOPE("NavGraph::build");
+        graph.build(grid);
+        
+        // Plans are link and span indices into the old graph
+        std::fill(enemies.plan.begin(), enemies.plan.begin() + enemies.size(), EnemyPool::NO_PLAN);
+    }
+    goalPoint = target;
+    goalSpan = graph.spanBelow(target.x, target.y);
+}
+
+void EnemyNavigator::think(EnemyPool& enemies, std::size_t index)
+{
+    float x = enemies.positionX[index];
+    sf::FloatRect bounds = enemies.getBounds(index);
+    std::uint32_t span = graph.findSpan(x, bounds.position.y + bounds.size.y);
+    if (span == NavGraph::NO_SPAN || goalSpan == NavGraph::NO_SPAN) 
+    {
+        enemies.plan[index] = STAY;
+        return;
+    }
+    
+    // Walk to the target once on its span, otherwise take the route's first link
+    if (span == goalSpan) 
+    {
+        enemies.plan[index] = CHASE | span;
+        return;
+    }
+    const NavRoute& route = pathCache.find(graph, pathFinder, span, x, goalSpan, goalPoint.x);
+    enemies.plan[index] = route.found && route.count > 0 ? route.links[0] : STAY;
+}
+
+bool EnemyNavigator::needsThink(const EnemyPool& enemies, std::size_t index) const
+{
+    std::uint32_t plan = enemies.plan[index];
+    if (plan == EnemyPool::NO_PLAN) 
+    {
+        return true;
+    }
+    if (plan == STAY) 
+    {
+        return false;
+    }
+    std::uint32_t span = planSpan(plan);
+    if ((plan & CHASE) && span != goalSpan) 
+    {
+        return true;
+    }
+    sf::FloatRect bounds = enemies.getBounds(index);
+    return !graph.standsOn(span, enemies.positionX[index], bounds.position.y + bounds.size.y);
+}
+
+void EnemyNavigator::move(EnemyPool& enemies) const
+{
+    const float speed = graph.params.speed;
+    const float timestep = graph.params.timestep;
+    const float stepDistance = speed * timestep;
+    
+    for (std::size_t i = 0; i < enemies.size(); i++) 
+    {
+        if (!enemies.onGround[i] || enemies.state[i] == EnemyState::DEAD) 
+        {
+            continue;
+        }
+        if (enemies.plan[i] == STAY || needsThink(enemies, i)) 
+        {
+            enemies.velocityX[i] = 0.0f;
+            continue;
+        }
+        
+        // Head for the next takeoff, or for the target once on its span
+        float x = enemies.positionX[i];
+        float goalX = goalPoint.x;
+        if (!(enemies.plan[i] & CHASE)) 
+        {
+            const NavLink& link = graph.getLink(enemies.plan[i]);
+            if (link.type == NavLinkType::JUMP && std::abs(link.takeoffX - x) <= stepDistance) 
+            {
+                // Take off exactly where the arc was traced from
+                enemies.positionX[i] = link.takeoffX;
+                enemies.velocityX[i] = link.velocityX;
+                enemies.velocityY[i] = -graph.params.jumpSpeed;
+                enemies.onGround[i] = 0;
+                continue;
+            }
+            goalX = link.takeoffX;
+        }
+        
+        // Full speed, slowing only to stop on the spot (drops are walked past the edge)
+        float dx = goalX - x;
+        enemies.velocityX[i] = std::abs(dx) <= stepDistance ? dx / timestep : std::copysign(speed, dx);
+    }
+}
+
+std::uint32_t EnemyNavigator::planSpan(std::uint32_t plan) const
+{
+    if (plan == EnemyPool::NO_PLAN || plan == STAY) 
+    {
+        return NavGraph::NO_SPAN;
+    }
+    if (plan & CHASE) 
+    {
+        return plan & ~CHASE;
+    }
+    return plan < graph.linkCount() ? graph.getLink(plan).from : NavGraph::NO_SPAN;
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "NavGraph.h"
+#include "PathFinder.h"
+#include "PathCache.h"
+#include "../Enemy/EnemyPool.h"
+#include "../Physics/SpatialGrid.h"
+
+/**
+ * @class EnemyNavigator
+ * @brief Makes the enemies in a pool chase a target across platforms
+ * 
+ * Navigation is split into a decision and the movement that follows it.
+ * think() is the expensive part: it finds the span an enemy stands on,
+ * looks up its route to the target's span (through the shared PathCache)
+ * and stores the outcome in EnemyPool::plan, either the first link to
+ * take, "walk to the target on this span" or "stay put". move() is cheap
+ * and runs for every grounded enemy each tick: it walks towards the
+ * plan's takeoff point and jumps there, or walks straight to the target.
+ * Drops happen by walking off the edge. Airborne enemies keep the
+ * velocity they have, so a jump or fall follows the arc the link was
+ * traced with.
+ * 
+ * steer() thinks for every enemy every tick. An AIScheduler instead picks
+ * which enemies think on each tick, and the rest keep following their
+ * last plan until it goes stale (see needsThink()).
+ * 
+ * The graph is rebuilt whenever the platform grid changes (its version),
+ * which covers level loads and chunk streaming; every plan is dropped then.
+ * 
+ * Steering only reads the enemy columns and the graph, plans are saved with
+ * the pool, and cached routes depend on nothing but their key, so the
+ * result is deterministic and a rolled-back world steers exactly as it did
+ * the first time.
+ * 
+ * @example
+ * @code
+ * EnemyNavigator navigator;
+ * world.navigator = &navigator;  // World::step() steers before moving enemies
+ * @endcode
+ */
+class EnemyNavigator
+{
+public:
+    /**
+     * @brief Creates a navigator with an empty graph
+     * 
+     * @param params Agent size and movement limits for the graph
+     */
+    explicit EnemyNavigator(const NavParams& params = NavParams());
+    
+    /**
+     * @brief Sets this tick's velocity of every grounded, living enemy
+     * 
+     * prepare(), think() for every grounded, living enemy, then move().
+     * Enemies standing off the graph, or with no route to the target, stop.
+     * 
+     * @param enemies Pool to steer (velocities, and positions at takeoff)
+     * @param grid    Platform broadphase the enemies collide with
+     * @param target  Point to chase: center X and feet Y (e.g. the player's)
+     */
+    void steer(EnemyPool& enemies, const SpatialGrid& grid, const sf::Vector2f& target);
+    
+    /**
+     * @brief Gets ready for a tick of think() and move() calls
+     * 
+     * Rebuilds the graph if the grid has changed (resetting every plan to
+     * EnemyPool::NO_PLAN) and finds the span under the target.
+     * 
+     * @param enemies Pool whose plans refer to the graph
+     * @param grid    Platform broadphase the enemies collide with
+     * @param target  Point to chase: center X and feet Y (e.g. the player's)
+     */
+    void prepare(EnemyPool& enemies, const SpatialGrid& grid, const sf::Vector2f& target);
+    
+    /**
+     * @brief Decides how one grounded enemy gets to the target
+     * 
+     * Writes enemies.plan[index]; leaves velocities to move().
+     * 
+     * @param enemies Pool holding the enemy
+     * @param index   Dense index of a grounded enemy
+     */
+    void think(EnemyPool& enemies, std::size_t index);
+    
+    /**
+     * @brief Whether an enemy's plan no longer fits where it is
+     * 
+     * True if it has none yet, stands on a different span than the plan
+     * was made on, or is walking to a target that has left its span.
+     * Cheap: no lookups.
+     */
+    bool needsThink(const EnemyPool& enemies, std::size_t index) const;
+    
+    /**
+     * @brief Sets the velocity of every grounded, living enemy from its plan
+     * 
+     * Enemies whose plan needsThink() stop until they think again.
+     * 
+     * @param enemies Pool to move (velocities, and positions at takeoff)
+     */
+    void move(EnemyPool& enemies) const;
+    
+    /** @brief Walkable spans and links, rebuilt from the grid on demand */
+    NavGraph graph;
+    
+    /** @brief Search state reused by every cache miss */
+    PathFinder pathFinder;
+    
+    /** @brief Routes shared by enemies heading to the same target */
+    PathCache pathCache;
+    
+private:
+    /** @brief Span an enemy's plan was made on, or NO_SPAN for NO_PLAN and STAY */
+    std::uint32_t planSpan(std::uint32_t plan) const;
+    
+    /** @brief Target passed to the last prepare() */
+    sf::Vector2f goalPoint;
+    
+    /** @brief Span under the target, or NO_SPAN */
+    std::uint32_t goalSpan = NavGraph::NO_SPAN;
+};
@@ -0,0 +1,379 @@
+#include "NavGraph.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    // Feet this far from a span's height still count as standing on it
+    constexpr float SUPPORT_TOLERANCE = 2.0f;
+    
+    // Feet may be this far below a top on the step before they count as landing on it
+    constexpr float LANDING_TOLERANCE = 0.01f;
+    
+    // Gap kept between the box and an edge it has to clear
+    constexpr float EDGE_CLEARANCE = 0.5f;
+    
+    // Jumps need the feet to clear the target's top by at least this much
+    constexpr float HEADROOM = 4.0f;
+    
+    // Strict overlap: boxes that only touch (an agent standing on a top) do not count
+    bool overlaps(const sf::FloatRect& a, const sf::FloatRect& b)
+    {
+        return a.position.x < b.position.x + b.size.x && b.position.x < a.position.x + a.size.x &&
+               a.position.y < b.position.y + b.size.y && b.position.y < a.position.y + a.size.y;
+    }
+    
+    // Stepping velocity before position, as the game does, puts the body on
+    // the exact parabola of a slightly slower jump at every step: height
+    // v t - g t^2 / 2 with v = jumpSpeed - gravity * timestep / 2
+    float effectiveJumpSpeed(const NavParams& params)
+    {
+        return params.jumpSpeed - params.gravity * params.timestep * 0.5f;
+    }
+    
+    bool spanBefore(const NavSpan& a, const NavSpan& b)
+    {
+        return a.y < b.y || (a.y == b.y && a.left < b.left);
+    }
+}
+
+NavGraph::NavGraph(const NavParams& params)
+    : params(params)
+{
+}
+
+void NavGraph::build(const SpatialGrid& grid)
+{
+    buildSpans(grid);
+    
+    std::vector<sf::FloatRect> rects;
+    rects.reserve(spans.size());
+    for (const NavSpan& span : spans) 
+    {
+        rects.push_back(sf::FloatRect(sf::Vector2f(span.left, span.y), sf::Vector2f(span.right - span.left, 1.0f)));
+    }
+    spanGrid.build(rects.data(), rects.size());
+    
+    // Links come out grouped by source span, so each span just records its range
+    links.clear();
+    for (std::uint32_t i = 0; i < spans.size(); i++) 
+    {
+        spans[i].firstLink = static_cast<std::uint32_t>(links.size());
+        linkSpan(grid, i);
+        spans[i].linkCount = static_cast<std::uint32_t>(links.size()) - spans[i].firstLink;
+    }
+    
+    version++;
+    gridVersion = grid.version;
+}
+
+void NavGraph::buildSpans(const SpatialGrid& grid)
+{
+    const float halfWidth = params.agentWidth * 0.5f;
+    std::vector<std::pair<float, float>> blocked;
+    
+    spans.clear();
+    for (std::size_t i = 0; i < grid.size(); i++) 
+    {
+        const sf::FloatRect& platform = grid.getBounds(i);
+        float left = platform.position.x;
+        float right = platform.position.x + platform.size.x;
+        float top = platform.position.y;
+        
+        // Room the agent's box needs above the top, for every center from left to right
+        sf::FloatRect clearance(sf::Vector2f(left - halfWidth, top - params.agentHeight),
+                                sf::Vector2f(platform.size.x + params.agentWidth, params.agentHeight));
+        grid.query(clearance, candidates);
+        blocked.clear();
+        for (std::size_t c : candidates) 
+        {
+            const sf::FloatRect& other = grid.getBounds(c);
+            if (c != i && overlaps(clearance, other)) 
+            {
+                blocked.emplace_back(other.position.x - halfWidth, other.position.x + other.size.x + halfWidth);
+            }
+        }
+        std::sort(blocked.begin(), blocked.end());
+        
+        // What is left of [left, right] once the blocked centers are cut out
+        float start = left;
+        for (const auto& interval : blocked) 
+        {
+            float end = std::min(interval.first, right);
+            if (end > start) 
+            {
+                spans.push_back(NavSpan{ start, end, top, 0, 0 });
+            }
+            start = std::max(start, interval.second);
+            if (start >= right) 
+            {
+                break;
+            }
+        }
+        if (start < right) 
+        {
+            spans.push_back(NavSpan{ start, right, top, 0, 0 });
+        }
+    }
+    
+    // Tops at the same height closer than the agent is wide are one walkable stretch
+    std::sort(spans.begin(), spans.end(), spanBefore);
+    std::size_t merged = 0;
+    for (std::size_t i = 0; i < spans.size(); i++) 
+    {
+        if (merged > 0 && spans[i].y == spans[merged - 1].y &&
+            spans[i].left - spans[merged - 1].right < params.agentWidth)
+        {
+            spans[merged - 1].right = std::max(spans[merged - 1].right, spans[i].right);
+        }
+        else 
+        {
+            spans[merged++] = spans[i];
+        }
+    }
+    spans.resize(merged);
+}
+
+void NavGraph::linkSpan(const SpatialGrid& grid, std::uint32_t index)
+{
+    const NavSpan span = spans[index];
+    const float halfWidth = params.agentWidth * 0.5f;
+    const float jumpSpeed = effectiveJumpSpeed(params);
+    const float gravity = params.gravity;
+    
+    // Walk off either end and fall wherever that leads
+    for (float direction : { -1.0f, 1.0f }) 
+    {
+        float takeoffX = direction < 0.0f ? span.left - halfWidth - EDGE_CLEARANCE
+                                          : span.right + halfWidth + EDGE_CLEARANCE;
+        sf::Vector2f landing;
+        float time = 0.0f;
+        if (!trace(grid, takeoffX, span.y, direction * params.speed, 0.0f, span.y + params.maxDrop, landing, time)) 
+        {
+            continue;
+        }
+        std::uint32_t to = findSpan(landing.x, landing.y);
+        if (to != NO_SPAN && to != index) 
+        {
+            links.push_back(NavLink{ index, to, takeoffX, landing.x, direction * params.speed, time, NavLinkType::DROP });
+        }
+    }
+    
+    // Jump to every span the arc can reach: up to the apex, down to maxDrop
+    float rise = jumpSpeed * jumpSpeed / (2.0f * gravity) - HEADROOM;
+    float longest = (jumpSpeed + std::sqrt(jumpSpeed * jumpSpeed + 2.0f * gravity * params.maxDrop)) / gravity;
+    float reach = params.speed * longest + params.agentWidth;
+    sf::FloatRect area(sf::Vector2f(span.left - reach, span.y - rise),
+                       sf::Vector2f(span.right - span.left + 2.0f * reach, rise + params.maxDrop));
+    spanGrid.query(area, targets);
+    for (std::size_t t : targets) 
+    {
+        const NavSpan& target = spans[t];
+        if (t == index || target.y < span.y - rise || target.y > span.y + params.maxDrop) 
+        {
+            continue;
+        }
+        // Lower spans right underneath are reached by the drops
+        bool underneath = target.y >= span.y && target.left <= span.right && span.left <= target.right;
+        if (underneath) 
+        {
+            continue;
+        }
+        tryJump(grid, index, static_cast<std::uint32_t>(t), 1.0f);
+        tryJump(grid, index, static_cast<std::uint32_t>(t), -1.0f);
+    }
+}
+
+void NavGraph::tryJump(const SpatialGrid& grid, std::uint32_t from, std::uint32_t to, float direction)
+{
+    const NavSpan& source = spans[from];
+    const NavSpan& target = spans[to];
+    const float halfWidth = params.agentWidth * 0.5f;
+    const float jumpSpeed = effectiveJumpSpeed(params);
+    const float gravity = params.gravity;
+    
+    // Time until the feet come back down to the target's height
+    float drop = target.y - source.y;
+    float discriminant = jumpSpeed * jumpSpeed + 2.0f * gravity * drop;
+    if (discriminant <= 0.0f) 
+    {
+        return;
+    }
+    float root = std::sqrt(discriminant);
+    float flight = (jumpSpeed + root) / gravity;
+    
+    // Land a little inside the target's near end (closer makes upward jumps shorter)
+    float inset = std::min(halfWidth * 0.5f, (target.right - target.left) * 0.5f);
+    float landingX = direction > 0.0f ? target.left + inset : target.right - inset;
+    
+    // Going up, the box must not reach the target's side before the feet
+    // have risen past its top, so the inset plus half a box is only covered
+    // in the time after that. Going down there is nothing to clear.
+    float distance = 0.0f;
+    if (drop < 0.0f) 
+    {
+        float rising = (jumpSpeed - root) / gravity;
+        distance = (inset + halfWidth + EDGE_CLEARANCE) / (1.0f - rising / flight);
+    }
+    
+    // Take off at that distance, or from the source's end if that is further back
+    float takeoffX = landingX - direction * distance;
+    if (direction > 0.0f) 
+    {
+        takeoffX = std::min(takeoffX, source.right);
+        if (takeoffX < source.left) 
+        {
+            return;
+        }
+    }
+    else 
+    {
+        takeoffX = std::max(takeoffX, source.left);
+        if (takeoffX > source.right) 
+        {
+            return;
+        }
+    }
+    
+    float velocityX = (landingX - takeoffX) / flight;
+    if (std::abs(velocityX) > params.speed) 
+    {
+        return;
+    }
+    
+    sf::Vector2f landing;
+    float time = 0.0f;
+    if (trace(grid, takeoffX, source.y, velocityX, -params.jumpSpeed, target.y + SUPPORT_TOLERANCE, landing, time) &&
+        findSpan(landing.x, landing.y) == to)
+    {
+        links.push_back(NavLink{ from, to, takeoffX, landing.x, velocityX, time, NavLinkType::JUMP });
+    }
+}
+
+bool NavGraph::trace(const SpatialGrid& grid, float x, float feetY, float velocityX, float velocityY, 
+                     float lowestFeet, sf::Vector2f& landing, float& time)
+{
+    const float halfWidth = params.agentWidth * 0.5f;
+    const float gravity = params.gravity;
+    const float dt = params.timestep;
+    
+    // One query covering the whole arc: takeoff, apex, and down to lowestFeet
+    // plus the last step's overshoot
+    float rise = velocityY < 0.0f ? velocityY * velocityY / (2.0f * gravity) : 0.0f;
+    float fallSpeed = std::sqrt(velocityY * velocityY + 2.0f * gravity * std::max(lowestFeet - feetY, 0.0f));
+    float flight = (fallSpeed - velocityY) / gravity + dt;
+    float endX = x + velocityX * flight;
+    float bottom = std::max(feetY, lowestFeet + (fallSpeed + gravity * dt) * dt);
+    sf::FloatRect area(sf::Vector2f(std::min(x, endX) - halfWidth, feetY - rise - params.agentHeight), 
+                       sf::Vector2f(std::abs(endX - x) + params.agentWidth, bottom - (feetY - rise - params.agentHeight)));
+    grid.query(area, candidates);
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(), 
+                                    [&](std::size_t c) { return !overlaps(area, grid.getBounds(c)); }), 
+                     candidates.end());
+    
+    // Same integration as EnemyPool::update(): velocity first, then position
+    float feet = feetY;
+    for (int step = 0; ; step++) 
+    {
+        float previousFeet = feet;
+        if (step > 0) 
+        {
+            velocityY += gravity * dt;
+            x += velocityX * dt;
+            feet += velocityY * dt;
+        }
+        
+        sf::FloatRect box(sf::Vector2f(x - halfWidth, feet - params.agentHeight), 
+                          sf::Vector2f(params.agentWidth, params.agentHeight));
+        bool landed = false;
+        float top = feet;
+        for (std::size_t c : candidates) 
+        {
+            const sf::FloatRect& platform = grid.getBounds(c);
+            if (!overlaps(box, platform)) 
+            {
+                continue;
+            }
+            // Only coming down onto a top counts; anything else is a bump
+            if (step == 0 || velocityY <= 0.0f || previousFeet > platform.position.y + LANDING_TOLERANCE) 
+            {
+                return false;
+            }
+            landed = true;
+            top = std::min(top, platform.position.y);
+        }
+        if (landed) 
+        {
+            landing = sf::Vector2f(x, top);
+            time = step * dt;
+            return true;
+        }
+        if (velocityY > 0.0f && feet > lowestFeet) 
+        {
+            return false;
+        }
+    }
+}
+
+std::uint32_t NavGraph::findSpan(float x, float feetY)
+{
+    return searchSpans(x, feetY - SUPPORT_TOLERANCE, feetY + SUPPORT_TOLERANCE);
+}
+
+std::uint32_t NavGraph::spanBelow(float x, float y)
+{
+    float bottom = spanGrid.origin.y + spanGrid.rows * spanGrid.cellSize;
+    return searchSpans(x, y - SUPPORT_TOLERANCE, std::max(bottom, y));
+}
+
+bool NavGraph::standsOn(std::uint32_t span, float x, float feetY) const
+{
+    if (span >= spans.size()) 
+    {
+        return false;
+    }
+    const float halfWidth = params.agentWidth * 0.5f;
+    const NavSpan& s = spans[span];
+    return s.y >= feetY - SUPPORT_TOLERANCE && s.y <= feetY + SUPPORT_TOLERANCE && 
+           s.left - halfWidth <= x && x <= s.right + halfWidth;
+}
+
+std::uint32_t NavGraph::searchSpans(float x, float top, float bottom)
+{
+    const float halfWidth = params.agentWidth * 0.5f;
+    
+    // Results come in index order, which is height order, so the first
+    // span that fits is the highest
+    sf::FloatRect column(sf::Vector2f(x - halfWidth, top), sf::Vector2f(params.agentWidth, bottom - top));
+    spanGrid.query(column, nearby);
+    for (std::size_t n : nearby) 
+    {
+        const NavSpan& span = spans[n];
+        if (span.y >= top && span.y <= bottom && span.left - halfWidth <= x && x <= span.right + halfWidth) 
+        {
+            return static_cast<std::uint32_t>(n);
+        }
+    }
+    return NO_SPAN;
+}
+
+const NavSpan& NavGraph::getSpan(std::uint32_t index) const
+{
+    return spans[index];
+}
+
+const NavLink& NavGraph::getLink(std::uint32_t index) const
+{
+    return links[index];
+}
+
+std::size_t NavGraph::spanCount() const
+{
+    return spans.size();
+}
+
+std::size_t NavGraph::linkCount() const
+{
+    return links.size();
+}
@@ -0,0 +1,201 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Physics/SpatialGrid.h"
+#include "../Player/Player.h"
+
+/**
+ * @struct NavParams
+ * @brief Size and movement limits of the agent a NavGraph is built for
+ * 
+ * Jumps and falls are only linked if an agent of this size, moving like
+ * the player does (same gravity and jump impulse, horizontal speed at most
+ * speed), gets from one span to the other without touching anything.
+ */
+struct NavParams
+{
+    float agentWidth = 60.0f;                ///< Collision box width (the widest enemy family)
+    float agentHeight = 60.0f;               ///< Collision box height (the tallest enemy family)
+    float speed = Player::WALK_SPEED;        ///< Walking speed, and the fastest horizontal speed in the air
+    float gravity = Player::GRAVITY;         ///< Pixels per second squared
+    float jumpSpeed = Player::JUMP_SPEED;    ///< Upward speed at takeoff
+    float maxDrop = 600.0f;                  ///< Deepest fall or jump down that is linked
+    float timestep = 1.0f / 120.0f;          ///< Step used to trace arcs (World::TIMESTEP)
+};
+
+/**
+ * @struct NavSpan
+ * @brief A stretch of platform top an agent can stand and walk on
+ * 
+ * left and right bound the agent's center. Touching platform tops at the
+ * same height are merged into one span; parts with a platform less than
+ * agentHeight above them are cut out.
+ */
+struct NavSpan
+{
+    float left;                  ///< Leftmost standing center X
+    float right;                 ///< Rightmost standing center X
+    float y;                     ///< Surface height (the agent's feet)
+    std::uint32_t firstLink;     ///< First outgoing link in NavGraph's link list
+    std::uint32_t linkCount;     ///< Number of outgoing links
+};
+
+/** @brief How a NavLink is traversed */
+enum class NavLinkType : std::uint8_t
+{
+    DROP,  ///< Keep walking past the edge and fall
+    JUMP   ///< Jump from takeoffX with velocityX
+};
+
+/**
+ * @struct NavLink
+ * @brief A validated move from one span to another
+ */
+struct NavLink
+{
+    std::uint32_t from;      ///< Span the move starts on
+    std::uint32_t to;        ///< Span it lands on
+    float takeoffX;          ///< Center X to walk to (a drop falls once past it)
+    float landingX;          ///< Center X the traced arc landed at
+    float velocityX;         ///< Horizontal speed during the move
+    float time;              ///< Seconds from takeoff to landing
+    NavLinkType type;
+};
+
+/**
+ * @class NavGraph
+ * @brief Walkable spans and the jumps and drops between them
+ * 
+ * Built from the platform broadphase, so it follows whatever the world
+ * collides with: the default layout, a loaded level or the resident chunks
+ * of a streamed one. Each span gets a drop link off either end and a jump
+ * link to every span within jumping reach. Every link is checked by
+ * tracing the agent's box along the arc with the same integration
+ * EnemyPool::update() uses, and only kept if the arc lands on the target
+ * span without hitting anything on the way.
+ * 
+ * Spans are sorted by height, then left edge, and indexed in a grid of
+ * their own for the lookups. Outgoing links are stored together per span.
+ * 
+ * @note The lookups use scratch buffers; do not call them from several
+ *       threads at once.
+ * 
+ * @example
+ * @code
+ * NavGraph graph;
+ * graph.build(world.platformGrid);
+ * std::uint32_t span = graph.findSpan(x, feetY);
+ * @endcode
+ */
+class NavGraph
+{
+public:
+    /** @brief Returned by the span lookups when nothing matches */
+    static constexpr std::uint32_t NO_SPAN = 0xFFFFFFFFu;
+    
+    /**
+     * @brief Constructs an empty graph
+     * 
+     * @param params Agent the graph is built for
+     */
+    explicit NavGraph(const NavParams& params = NavParams());
+    
+    /**
+     * @brief Rebuilds spans and links from the platforms in a grid
+     * 
+     * @param grid Platform broadphase (also used to trace the arcs)
+     */
+    void build(const SpatialGrid& grid);
+    
+    /**
+     * @brief Finds the span an agent standing at a point is on
+     * 
+     * The agent counts as standing on a span while its box overlaps it,
+     * i.e. up to half the agent width past either end.
+     * 
+     * @param x     Agent center X
+     * @param feetY Bottom of the agent's box
+     * @return Span index, or NO_SPAN
+     */
+    std::uint32_t findSpan(float x, float feetY);
+    
+    /**
+     * @brief Finds the first span at or below a point, e.g. under a jumping player
+     * 
+     * @return Span index, or NO_SPAN
+     */
+    std::uint32_t spanBelow(float x, float y);
+    
+    /**
+     * @brief Checks one span with the same rule as findSpan(), without a lookup
+     * 
+     * @param span  Span index (anything out of range is never stood on)
+     * @param x     Agent center X
+     * @param feetY Bottom of the agent's box
+     */
+    bool standsOn(std::uint32_t span, float x, float feetY) const;
+    
+    /** @brief Gets a span by index */
+    const NavSpan& getSpan(std::uint32_t index) const;
+    
+    /** @brief Gets a link by index */
+    const NavLink& getLink(std::uint32_t index) const;
+    
+    /** @brief Number of spans */
+    std::size_t spanCount() const;
+    
+    /** @brief Number of links */
+    std::size_t linkCount() const;
+    
+    /** @brief Agent the graph is built for; call build() again after changing it */
+    NavParams params;
+    
+    /** @brief Bumped by every build(); cached routes compare against it */
+    std::uint32_t version = 0;
+    
+    /** @brief SpatialGrid::version of the grid the graph was last built from */
+    std::uint32_t gridVersion = 0;
+    
+private:
+    /** @brief Highest span between two heights that an agent at x stands on */
+    std::uint32_t searchSpans(float x, float top, float bottom);
+    
+    /** @brief Cuts the platform tops into spans and merges neighbours */
+    void buildSpans(const SpatialGrid& grid);
+    
+    /** @brief Adds the drop and jump links leaving one span */
+    void linkSpan(const SpatialGrid& grid, std::uint32_t index);
+    
+    /**
+     * @brief Plans a jump between two spans, traces it and adds it if it lands
+     * 
+     * @param direction +1 to land on the target's left end moving right,
+     *                  -1 to land on its right end moving left
+     */
+    void tryJump(const SpatialGrid& grid, std::uint32_t from, std::uint32_t to, float direction);
+    
+    /**
+     * @brief Traces the agent's box from a point until it lands
+     * 
+     * @param lowestFeet Give up once the feet fall below this without landing
+     * @param landing    Receives the landing center X and surface height
+     * @param time       Receives the flight time in seconds
+     * @return false if the box starts inside, hits anything other than a top, or falls past lowestFeet
+     */
+    bool trace(const SpatialGrid& grid, float x, float feetY, float velocityX, float velocityY, 
+               float lowestFeet, sf::Vector2f& landing, float& time);
+    
+    std::vector<NavSpan> spans;
+    
+    std::vector<NavLink> links;
+    
+    /** @brief Broadphase over the spans, for the lookups and the jump targets in reach */
+    SpatialGrid spanGrid;
+    
+    /** @brief Scratch buffers for grid query results */
+    std::vector<std::size_t> candidates;
+    std::vector<std::size_t> targets;
+    std::vector<std::size_t> nearby;
+};
@@ -0,0 +1,97 @@
+#include "PathCache.h"
+#include <algorithm>
+#include <cmath>
+
+PathCache::PathCache(std::size_t slotCount, float bucketWidth)
+    : bucketWidth(bucketWidth)
+{
+    std::size_t size = WAYS;
+    while (size < slotCount) 
+    {
+        size *= 2;
+    }
+    slots.resize(size);
+}
+
+const NavRoute& PathCache::find(const NavGraph& graph, PathFinder& pathFinder, std::uint32_t startSpan, float startX,
+                                std::uint32_t goalSpan, float goalX)
+{
+    std::int32_t startBucket = bucketOf(startX);
+    std::int32_t goalBucket = bucketOf(goalX);
+    
+    std::uint64_t hash = startSpan * 0x9E3779B97F4A7C15ULL;
+    hash ^= static_cast<std::uint32_t>(startBucket) * 0xC2B2AE3D27D4EB4FULL;
+    hash ^= goalSpan * 0x165667B19E3779F9ULL;
+    hash ^= static_cast<std::uint32_t>(goalBucket) * 0x27D4EB2F165667C5ULL;
+    Slot* set = &slots[((hash ^ (hash >> 29)) & (slots.size() / WAYS - 1)) * WAYS];
+    
+    // Look through the set, remembering the least recently used way in case of a miss
+    Slot* victim = set;
+    for (std::size_t way = 0; way < WAYS; way++) 
+    {
+        Slot& candidate = set[way];
+        if (candidate.graphVersion == graph.version && candidate.startSpan == startSpan && 
+            candidate.startBucket == startBucket && candidate.goalSpan == goalSpan && candidate.goalBucket == goalBucket) 
+        {
+            stats.hits++;
+            candidate.lastUsed = ++useCounter;
+            return candidate.route;
+        }
+        if (candidate.lastUsed < victim->lastUsed) 
+        {
+            victim = &candidate;
+        }
+    }
+    
+    // Search from the bucket centers, not the caller's exact points, so the
+    // route is the same whichever agent in the bucket asked first
+    stats.misses++;
+    Slot& slot = *victim;
+    slot.lastUsed = ++useCounter;
+    slot.startSpan = startSpan;
+    slot.startBucket = startBucket;
+    slot.goalSpan = goalSpan;
+    slot.goalBucket = goalBucket;
+    slot.graphVersion = graph.version;
+    path.clear();
+    slot.route.found = false;
+    if (startSpan < graph.spanCount() && goalSpan < graph.spanCount()) 
+    {
+        slot.route.found = pathFinder.findPath(graph, startSpan, bucketCenter(graph.getSpan(startSpan), startBucket), 
+                                               goalSpan, bucketCenter(graph.getSpan(goalSpan), goalBucket), path);
+        stats.expanded += pathFinder.getExpanded();
+    }
+    slot.route.count = static_cast<std::uint32_t>(std::min(path.size(), NavRoute::MAX_LINKS));
+    std::copy(path.begin(), path.begin() + slot.route.count, slot.route.links);
+    return slot.route;
+}
+
+void PathCache::clear()
+{
+    for (Slot& slot : slots) 
+    {
+        slot.graphVersion = 0;
+        slot.lastUsed = 0;
+    }
+    useCounter = 0;
+}
+
+PathCacheStats PathCache::getStats() const
+{
+    return stats;
+}
+
+void PathCache::resetStats()
+{
+    stats = PathCacheStats();
+}
+
+std::int32_t PathCache::bucketOf(float x) const
+{
+    return static_cast<std::int32_t>(std::floor(x / bucketWidth));
+}
+
+float PathCache::bucketCenter(const NavSpan& span, std::int32_t bucket) const
+{
+    return std::clamp((bucket + 0.5f) * bucketWidth, span.left, span.right);
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "NavGraph.h"
+#include "PathFinder.h"
+
+/**
+ * @struct NavRoute
+ * @brief A cached route: the first links of the path, in travel order
+ */
+struct NavRoute
+{
+    /** @brief Longest prefix of a path kept in the cache */
+    static constexpr std::size_t MAX_LINKS = 16;
+    
+    std::uint32_t links[MAX_LINKS];   ///< Link indices into the NavGraph
+    std::uint32_t count = 0;          ///< Valid entries in links (0 when on the goal span)
+    bool found = false;               ///< false if the goal cannot be reached
+};
+
+/**
+ * @struct PathCacheStats
+ * @brief Lookups served by a PathCache and searches it had to run
+ */
+struct PathCacheStats
+{
+    std::size_t hits = 0;       ///< Lookups answered from a slot
+    std::size_t misses = 0;     ///< Lookups that ran PathFinder::findPath()
+    std::size_t expanded = 0;   ///< Nodes expanded by those searches
+};
+
+/**
+ * @class PathCache
+ * @brief Routes shared by every agent going from the same place to the same target
+ * 
+ * Start and goal points are snapped to buckets bucketWidth pixels wide
+ * along their spans, and the route is searched from the bucket's center
+ * to the goal bucket's center. A crowd chasing the player therefore runs
+ * one search per occupied bucket instead of one per enemy, and the rest
+ * read the slot. Each agent still walks to its own exact target once on
+ * the goal span.
+ * 
+ * Slots live in a fixed table of WAYS-slot sets indexed by a hash of the
+ * key; a new key replaces the least recently used slot of its set, so
+ * two keys sharing a set no longer evict each other every tick. Slots are
+ * tagged with NavGraph::version, so a rebuilt graph invalidates them all.
+ * Because a route only depends on its key and the graph, the cache never
+ * changes what an agent does, only how often the search runs; restoring a
+ * saved world does not need to restore it.
+ * 
+ * @example
+ * @code
+ * PathCache cache;
+ * const NavRoute& route = cache.find(graph, pathFinder, span, x, targetSpan, targetX);
+ * if (route.found && route.count > 0)
+ * {
+ *     const NavLink& next = graph.getLink(route.links[0]);
+ * }
+ * @endcode
+ */
+class PathCache
+{
+public:
+    /**
+     * @brief Creates an empty cache
+     * 
+     * @param slotCount   Table size, rounded up to a power of two (at least WAYS)
+     * @param bucketWidth Width of the start/goal buckets in pixels
+     */
+    explicit PathCache(std::size_t slotCount = 4096, float bucketWidth = 128.0f);
+    
+    /**
+     * @brief Gets the route between two standing points, searching on a miss
+     * 
+     * @return The slot's route (valid until the next find())
+     */
+    const NavRoute& find(const NavGraph& graph, PathFinder& pathFinder, std::uint32_t startSpan, float startX,
+                         std::uint32_t goalSpan, float goalX);
+    
+    /** @brief Empties every slot */
+    void clear();
+    
+    /** @brief Hits, misses and search work since the last resetStats() */
+    PathCacheStats getStats() const;
+    
+    /** @brief Zeroes the counters */
+    void resetStats();
+    
+    /** @brief Width of the start/goal buckets in pixels */
+    const float bucketWidth;
+    
+    /** @brief Slots per set; a key can live in any slot of its set */
+    static constexpr std::size_t WAYS = 4;
+    
+private:
+    /** @brief One cached route and the key it was searched for */
+    struct Slot
+    {
+        std::uint32_t startSpan = 0;
+        std::int32_t startBucket = 0;
+        std::uint32_t goalSpan = 0;
+        std::int32_t goalBucket = 0;
+        std::uint32_t graphVersion = 0;   ///< 0 = empty (graph versions start at 1)
+        std::uint64_t lastUsed = 0;       ///< useCounter at the latest hit or fill
+        NavRoute route;
+    };
+    
+    /** @brief Bucket of an X coordinate */
+    std::int32_t bucketOf(float x) const;
+    
+    /** @brief Center of a bucket, kept on the span */
+    float bucketCenter(const NavSpan& span, std::int32_t bucket) const;
+    
+    std::vector<Slot> slots;
+    
+    /** @brief Bumped on every hit or fill to order slots by use */
+    std::uint64_t useCounter = 0;
+    
+    /** @brief Receives full paths before they are copied into a slot */
+    std::vector<std::uint32_t> path;
+    
+    PathCacheStats stats;
+};
@@ -0,0 +1,193 @@
+#include "PathFinder.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // cameFrom value of nodes entered straight from the start point
+    constexpr std::uint32_t NO_NODE = 0xFFFFFFFFu;
+}
+
+bool PathFinder::findPath(const NavGraph& graph, std::uint32_t startSpan, float startX,
+                          std::uint32_t goalSpan, float goalX, std::vector<std::uint32_t>& path)
+{
+    path.clear();
+    lastExpanded = 0;
+    if (startSpan >= graph.spanCount() || goalSpan >= graph.spanCount()) 
+    {
+        return false;
+    }
+    
+    const std::uint32_t linkCount = static_cast<std::uint32_t>(graph.linkCount());
+    const std::uint32_t goal = linkCount;
+    const float secondsPerPixel = 1.0f / graph.params.speed;
+    reserve(linkCount + 1);
+    
+    // A new stamp makes every node unvisited without touching the arrays
+    if (++stamp == 0) 
+    {
+        std::fill(seen.begin(), seen.end(), 0u);
+        stamp = 1;
+    }
+    heap.clear();
+    
+    // From the start point: straight to the goal, or to every takeoff on the start span
+    if (startSpan == goalSpan) 
+    {
+        relax(goal, std::abs(goalX - startX) * secondsPerPixel, NO_NODE, 0.0f);
+    }
+    const NavSpan& start = graph.getSpan(startSpan);
+    for (std::uint32_t l = start.firstLink; l < start.firstLink + start.linkCount; l++) 
+    {
+        const NavLink& link = graph.getLink(l);
+        float cost = std::abs(link.takeoffX - startX) * secondsPerPixel + link.time;
+        relax(l, cost, NO_NODE, std::abs(goalX - link.landingX) * secondsPerPixel);
+    }
+    
+    while (!heap.empty()) 
+    {
+        std::uint32_t node = popBest();
+        lastExpanded++;
+        if (node == goal) 
+        {
+            break;
+        }
+        
+        // Landed from link node: walk to the goal, or to each next takeoff
+        const NavLink& arrival = graph.getLink(node);
+        if (arrival.to == goalSpan) 
+        {
+            relax(goal, costSoFar[node] + std::abs(goalX - arrival.landingX) * secondsPerPixel, node, 0.0f);
+        }
+        const NavSpan& span = graph.getSpan(arrival.to);
+        for (std::uint32_t l = span.firstLink; l < span.firstLink + span.linkCount; l++) 
+        {
+            const NavLink& link = graph.getLink(l);
+            float cost = costSoFar[node] + std::abs(link.takeoffX - arrival.landingX) * secondsPerPixel + link.time;
+            relax(l, cost, node, std::abs(goalX - link.landingX) * secondsPerPixel);
+        }
+    }
+    
+    if (seen[goal] != stamp || !closed[goal]) 
+    {
+        return false;
+    }
+    
+    // Walk back from the goal, then put the links in travel order
+    lastCost = costSoFar[goal];
+    for (std::uint32_t node = cameFrom[goal]; node != NO_NODE; node = cameFrom[node]) 
+    {
+        path.push_back(node);
+    }
+    std::reverse(path.begin(), path.end());
+    return true;
+}
+
+void PathFinder::relax(std::uint32_t node, float cost, std::uint32_t from, float heuristic)
+{
+    if (seen[node] != stamp) 
+    {
+        seen[node] = stamp;
+        closed[node] = 0;
+        costSoFar[node] = cost;
+        estimate[node] = cost + heuristic;
+        cameFrom[node] = from;
+        heapPosition[node] = static_cast<std::uint32_t>(heap.size());
+        heap.push_back(node);
+        siftUp(heap.size() - 1);
+        return;
+    }
+    // The heuristic is consistent, so a closed node already has its best cost
+    if (closed[node] || cost >= costSoFar[node]) 
+    {
+        return;
+    }
+    costSoFar[node] = cost;
+    estimate[node] = cost + heuristic;
+    cameFrom[node] = from;
+    siftUp(heapPosition[node]);
+}
+
+std::uint32_t PathFinder::popBest()
+{
+    std::uint32_t best = heap.front();
+    closed[best] = 1;
+    heap.front() = heap.back();
+    heapPosition[heap.front()] = 0;
+    heap.pop_back();
+    if (!heap.empty()) 
+    {
+        siftDown(0);
+    }
+    return best;
+}
+
+void PathFinder::siftUp(std::size_t position)
+{
+    std::uint32_t node = heap[position];
+    while (position > 0) 
+    {
+        std::size_t parent = (position - 1) / 2;
+        if (estimate[heap[parent]] <= estimate[node]) 
+        {
+            break;
+        }
+        heap[position] = heap[parent];
+        heapPosition[heap[position]] = static_cast<std::uint32_t>(position);
+        position = parent;
+    }
+    heap[position] = node;
+    heapPosition[node] = static_cast<std::uint32_t>(position);
+}
+
+void PathFinder::siftDown(std::size_t position)
+{
+    std::uint32_t node = heap[position];
+    const std::size_t size = heap.size();
+    while (true) 
+    {
+        std::size_t child = position * 2 + 1;
+        if (child >= size) 
+        {
+            break;
+        }
+        if (child + 1 < size && estimate[heap[child + 1]] < estimate[heap[child]]) 
+        {
+            child++;
+        }
+        if (estimate[node] <= estimate[heap[child]]) 
+        {
+            break;
+        }
+        heap[position] = heap[child];
+        heapPosition[heap[position]] = static_cast<std::uint32_t>(position);
+        position = child;
+    }
+    heap[position] = node;
+    heapPosition[node] = static_cast<std::uint32_t>(position);
+}
+
+void PathFinder::reserve(std::size_t nodes)
+{
+    if (seen.size() >= nodes) 
+    {
+        return;
+    }
+    costSoFar.resize(nodes);
+    estimate.resize(nodes);
+    cameFrom.resize(nodes);
+    seen.resize(nodes, 0u);
+    closed.resize(nodes);
+    heapPosition.resize(nodes);
+    heap.reserve(nodes);
+}
+
+float PathFinder::getCost() const
+{
+    return lastCost;
+}
+
+std::size_t PathFinder::getExpanded() const
+{
+    return lastExpanded;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "NavGraph.h"
+
+/**
+ * @class PathFinder
+ * @brief A* over a NavGraph with search state that is reused between queries
+ * 
+ * The search runs over links: a node is "just landed from this link", so
+ * costs can include the exact walk from each landing point to the next
+ * takeoff. Costs are in seconds; the heuristic is the horizontal distance
+ * to the goal at NavParams::speed, which no move beats.
+ * 
+ * All per-node state lives in arrays sized to the largest graph seen and
+ * is invalidated between queries by bumping a search stamp, and the open
+ * set is an indexed binary heap in a preallocated array. After the first
+ * query on a graph, findPath() does not allocate (the output path only
+ * grows past its capacity on a longer route than before).
+ * 
+ * @note Not thread-safe; use one PathFinder per thread.
+ * 
+ * @example
+ * @code
+ * PathFinder pathFinder;
+ * std::vector<std::uint32_t> route;
+ * if (pathFinder.findPath(graph, startSpan, x, goalSpan, targetX, route))
+ * {
+ *     const NavLink& next = graph.getLink(route.front());
+ * }
+ * @endcode
+ */
+class PathFinder
+{
+public:
+    /**
+     * @brief Finds the quickest way from one standing point to another
+     * 
+     * @param graph     Graph to search
+     * @param startSpan Span the agent stands on
+     * @param startX    Agent center X
+     * @param goalSpan  Span to get to
+     * @param goalX     Center X to end at
+     * @param path      Receives the links to take in order (empty if already on the goal span)
+     * @return false if the goal span cannot be reached (path is then empty)
+     */
+    bool findPath(const NavGraph& graph, std::uint32_t startSpan, float startX,
+                  std::uint32_t goalSpan, float goalX, std::vector<std::uint32_t>& path);
+    
+    /** @brief Estimated seconds of the last path found */
+    float getCost() const;
+    
+    /** @brief Nodes expanded by the last query */
+    std::size_t getExpanded() const;
+    
+private:
+    /** @brief Grows the node arrays to fit a graph (no-op once they do) */
+    void reserve(std::size_t nodes);
+    
+    /** @brief Opens a node or lowers its cost; false if it was closed */
+    void relax(std::uint32_t node, float cost, std::uint32_t from, float heuristic);
+    
+    /** @brief Restores the heap order upwards from a heap position */
+    void siftUp(std::size_t position);
+    
+    /** @brief Restores the heap order downwards from a heap position */
+    void siftDown(std::size_t position);
+    
+    /** @brief Removes and returns the open node with the lowest estimate */
+    std::uint32_t popBest();
+    
+    /// @name Per-Node Search State (index = link, plus one for the goal)
+    /// @{
+    
+    std::vector<float> costSoFar;        ///< Seconds from the start
+    std::vector<float> estimate;         ///< costSoFar plus heuristic
+    std::vector<std::uint32_t> cameFrom; ///< Previous link, or NO_NODE for the start
+    std::vector<std::uint32_t> seen;     ///< Search stamp when the node was first reached
+    std::vector<std::uint8_t> closed;    ///< Set once expanded (valid while seen is current)
+    std::vector<std::uint32_t> heapPosition; ///< Position in heap while open
+    
+    /// @}
+    
+    /** @brief Open set as a binary min-heap on estimate */
+    std::vector<std::uint32_t> heap;
+    
+    /** @brief Incremented per query; a node whose seen differs is unvisited */
+    std::uint32_t stamp = 0;
+    
+    float lastCost = 0.0f;
+    
+    std::size_t lastExpanded = 0;
+};
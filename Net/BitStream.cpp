@@ -0,0 +1,117 @@
+#include "BitStream.h"
+
+namespace
+{
+    // Sign folded into the low bit so small negative deltas stay small
+    std::uint32_t zigzag(std::int32_t value)
+    {
+        return (static_cast<std::uint32_t>(value) << 1) ^ static_cast<std::uint32_t>(value >> 31);
+    }
+    
+    std::int32_t unzigzag(std::uint32_t value)
+    {
+        return static_cast<std::int32_t>(value >> 1) ^ -static_cast<std::int32_t>(value & 1);
+    }
+}
+
+void BitWriter::write(std::uint32_t value, unsigned int count)
+{
+    std::uint64_t mask = (std::uint64_t(1) << count) - 1;
+    scratch |= (std::uint64_t(value) & mask) << scratchBits;
+    scratchBits += count;
+    bits += count;
+    
+    while (scratchBits >= 8) 
+    {
+        bytes.push_back(static_cast<std::uint8_t>(scratch));
+        scratch >>= 8;
+        scratchBits -= 8;
+    }
+}
+
+void BitWriter::writeDelta(std::int32_t delta)
+{
+    std::uint32_t value = zigzag(delta);
+    if (value == 0) 
+    {
+        write(0, 1);
+    }
+    else if (value < (1u << 5)) 
+    {
+        write(0x1, 2); // 1 then 0
+        write(value, 5);
+    }
+    else if (value < (1u << 12)) 
+    {
+        write(0x3, 3); // 1 1 0
+        write(value, 12);
+    }
+    else 
+    {
+        write(0x7, 3); // 1 1 1
+        write(value, 32);
+    }
+}
+
+const std::vector<std::uint8_t>& BitWriter::finish()
+{
+    if (scratchBits > 0) 
+    {
+        // Pad to a whole byte; later writes start after the padding, which
+        // bitCount() leaves out
+        unsigned int padding = 8 - scratchBits;
+        write(0, padding);
+        bits -= padding;
+    }
+    return bytes;
+}
+
+void BitWriter::clear()
+{
+    bytes.clear();
+    scratch = 0;
+    scratchBits = 0;
+    bits = 0;
+}
+
+BitReader::BitReader(const std::uint8_t* data, std::size_t size)
+    : data(data),
+      size(size)
+{
+}
+
+std::uint32_t BitReader::read(unsigned int count)
+{
+    while (scratchBits < count) 
+    {
+        if (position == size) 
+        {
+            overflow = true;
+            return 0;
+        }
+        scratch |= std::uint64_t(data[position++]) << scratchBits;
+        scratchBits += 8;
+    }
+    
+    std::uint32_t value = static_cast<std::uint32_t>(scratch & ((std::uint64_t(1) << count) - 1));
+    scratch >>= count;
+    scratchBits -= count;
+    return value;
+}
+
+std::int32_t BitReader::readDelta()
+{
+    if (!readBool()) 
+    {
+        return 0;
+    }
+    if (!readBool()) 
+    {
+        return unzigzag(read(5));
+    }
+    if (!readBool()) 
+    {
+        return unzigzag(read(12));
+    }
+    return unzigzag(read(32));
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class BitWriter
+ * @brief Packs values of any bit width back to back into a byte buffer
+ * 
+ * Bits are written least significant first into a 64-bit scratch word and
+ * flushed a byte at a time, so a 3-bit field followed by a 5-bit field
+ * takes one byte. Used to build network packets.
+ * 
+ * @example
+ * @code
+ * BitWriter writer;
+ * writer.write(type, 3);
+ * writer.writeDelta(position - baseline);
+ * transport.send(address, writer.finish().data(), writer.finish().size());
+ * @endcode
+ */
+class BitWriter
+{
+public:
+    /**
+     * @brief Appends the low bits of a value
+     * 
+     * @param value Value to write (bits above count are ignored)
+     * @param count Number of bits, 1 to 32
+     */
+    void write(std::uint32_t value, unsigned int count);
+    
+    /** @brief Appends one bit */
+    void writeBool(bool value) { write(value ? 1u : 0u, 1); }
+    
+    /**
+     * @brief Appends a signed difference, using fewer bits the smaller it is
+     * 
+     * 0 takes 1 bit, |delta| < 16 takes 7, |delta| < 2048 takes 15 and
+     * anything else 35. Meant for the change of a quantized value since a
+     * baseline, which is usually zero or small.
+     */
+    void writeDelta(std::int32_t delta);
+    
+    /** @brief Bits written so far */
+    std::size_t bitCount() const { return bits; }
+    
+    /**
+     * @brief Flushes the last partial byte and returns the packed bytes
+     * 
+     * The final byte is padded with zeros. Writing after finish() is
+     * allowed and starts at the next whole byte: the padding stays in the
+     * output, but bitCount() does not include it.
+     */
+    const std::vector<std::uint8_t>& finish();
+    
+    /** @brief Empties the buffer, keeping its capacity */
+    void clear();
+    
+private:
+    std::vector<std::uint8_t> bytes;
+    std::uint64_t scratch = 0;
+    unsigned int scratchBits = 0;
+    std::size_t bits = 0;
+};
+
+/**
+ * @class BitReader
+ * @brief Reads back what a BitWriter wrote
+ * 
+ * Reading past the end returns zeros and sets overflowed(), so a packet
+ * parser can read every field unconditionally and check once at the end
+ * whether the packet was truncated.
+ */
+class BitReader
+{
+public:
+    /**
+     * @param data Packed bytes (not copied; must outlive the reader)
+     * @param size Number of bytes
+     */
+    BitReader(const std::uint8_t* data, std::size_t size);
+    
+    /**
+     * @brief Reads an unsigned value
+     * 
+     * @param count Number of bits, 1 to 32
+     */
+    std::uint32_t read(unsigned int count);
+    
+    /** @brief Reads one bit */
+    bool readBool() { return read(1) != 0; }
+    
+    /** @brief Reads a value written with BitWriter::writeDelta */
+    std::int32_t readDelta();
+    
+    /** @brief Whether a read ran past the end of the data */
+    bool overflowed() const { return overflow; }
+    
+private:
+    const std::uint8_t* data;
+    std::size_t size;
+    std::size_t position = 0;  ///< Next byte to load into scratch
+    std::uint64_t scratch = 0;
+    unsigned int scratchBits = 0;
+    bool overflow = false;
+};
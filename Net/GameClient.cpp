@@ -0,0 +1,304 @@
+#include "GameClient.h"
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+
+GameClient::GameClient(World& world, Transport& transport, const NetAddress& server)
+    : world(world),
+      transport(transport),
+      server(server),
+      player(0.0f, 0.0f)
+{
+    inputs.fill(0);
+    sentAt.fill(0);
+    for (NetSnapshot& snapshot : received) 
+    {
+        snapshot.tick = NO_TICK;
+    }
+    latest.tick = NO_TICK;
+    before.tick = NO_TICK;
+}
+
+void GameClient::tick(const InputFrame& input)
+{
+    PROFILE_SCOPE("GameClient::tick");
+    localTick++;
+    receivePackets();
+    
+    if (connected && localTick - lastHeard > TIMEOUT_TICKS) 
+    {
+        connected = false;
+    }
+    if (!connected) 
+    {
+        if (!rejected && localTick % CONNECT_RETRY_TICKS == 1) 
+        {
+            writer.clear();
+            writePacketHeader(writer, NetPacketType::CONNECT);
+            send();
+        }
+        return;
+    }
+    
+    // Predict right away; the server's answer arrives a round trip later
+    if (nextSequence - serverRan < INPUT_HISTORY) 
+    {
+        std::uint32_t sequence = nextSequence++;
+        inputs[sequence % INPUT_HISTORY] = input.toBits();
+        sentAt[sequence % INPUT_HISTORY] = localTick;
+        predict(sequence);
+    }
+    else 
+    {
+        stats.stalledTicks++;
+    }
+    
+    sendInputs();
+    stats.unacknowledgedInputs = nextSequence - serverRan;
+}
+
+void GameClient::disconnect()
+{
+    if (connected) 
+    {
+        writer.clear();
+        writePacketHeader(writer, NetPacketType::DISCONNECT);
+        send();
+        connected = false;
+    }
+}
+
+bool GameClient::isConnected() const
+{
+    return connected;
+}
+
+bool GameClient::isRejected() const
+{
+    return rejected;
+}
+
+std::size_t GameClient::getSlot() const
+{
+    return slot;
+}
+
+const Player& GameClient::getPlayer() const
+{
+    return player;
+}
+
+const NetSnapshot& GameClient::getSnapshot() const
+{
+    return latest;
+}
+
+const NetSnapshot& GameClient::getPreviousSnapshot() const
+{
+    return before;
+}
+
+const NetClientStats& GameClient::getStats() const
+{
+    return stats;
+}
+
+void GameClient::receivePackets()
+{
+    NetAddress from;
+    while (transport.receive(from, packet)) 
+    {
+        if (from != server) 
+        {
+            continue;
+        }
+        stats.packetsReceived++;
+        stats.bytesReceived += packet.size();
+        
+        BitReader reader(packet.data(), packet.size());
+        NetPacketType type;
+        if (!readPacketHeader(reader, type)) 
+        {
+            continue;
+        }
+        lastHeard = localTick;
+        
+        switch (type) 
+        {
+            case NetPacketType::ACCEPT:
+                handleAccept(reader);
+                break;
+            case NetPacketType::REJECT:
+                rejected = !connected;
+                break;
+            case NetPacketType::SNAPSHOT:
+                if (connected) 
+                {
+                    handleSnapshot(reader);
+                }
+                break;
+            case NetPacketType::DISCONNECT:
+                connected = false;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void GameClient::handleAccept(BitReader& reader)
+{
+    std::size_t acceptedSlot = reader.read(6);
+    std::uint32_t sequence = reader.read(32);
+    NetPlayerState state = readPlayerState(reader, NetPlayerState());
+    if (connected || reader.overflowed()) 
+    {
+        return; // Duplicate answer to a resent CONNECT
+    }
+    
+    connected = true;
+    slot = acceptedSlot;
+    nextSequence = sequence;
+    serverRan = sequence;
+    serverHas = sequence;
+    firstSequence = sequence;
+    
+    // Start exactly where the server put us; "after input sequence - 1" is the spawn
+    state.apply(player);
+    collision.playerContacts.clear();
+    predicted[(sequence - 1) % INPUT_HISTORY] = state;
+    
+    for (NetSnapshot& snapshot : received) 
+    {
+        snapshot.tick = NO_TICK;
+    }
+    latest.tick = NO_TICK;
+    before.tick = NO_TICK;
+}
+
+void GameClient::handleSnapshot(BitReader& reader)
+{
+    std::uint32_t tick = reader.read(32);
+    bool hasBaseline = reader.readBool();
+    std::uint32_t baselineTick = hasBaseline ? reader.read(32) : 0;
+    std::uint32_t nextInput = reader.read(32);
+    std::uint32_t inputsReceived = nextInput + static_cast<std::uint32_t>(reader.readDelta());
+    if (reader.overflowed() || findSnapshot(tick)) 
+    {
+        return; // Truncated or duplicate
+    }
+    
+    const NetSnapshot* baseline = nullptr;
+    if (hasBaseline) 
+    {
+        baseline = findSnapshot(baselineTick);
+        if (!baseline) 
+        {
+            stats.snapshotsUndecodable++;
+            return;
+        }
+    }
+    decoded.tick = tick;
+    if (!readSnapshotPlayers(reader, decoded, baseline)) 
+    {
+        return;
+    }
+    
+    // Every decoded snapshot can serve as a baseline, even a late one
+    received[receivedNext] = decoded;
+    receivedNext = (receivedNext + 1) % NET_SNAPSHOT_HISTORY;
+    stats.snapshotsReceived++;
+    
+    if (latest.tick != NO_TICK && tick < latest.tick) 
+    {
+        stats.snapshotsOutOfOrder++;
+        return;
+    }
+    before = latest;
+    latest = decoded;
+    
+    // Newer snapshots never report fewer inputs; ignore anything inconsistent
+    if (nextInput < serverRan || nextInput > nextSequence || inputsReceived < nextInput) 
+    {
+        return;
+    }
+    serverHas = std::max(serverHas, std::min(inputsReceived, nextSequence));
+    if (latest.has(slot)) 
+    {
+        reconcile(latest.players[slot], nextInput);
+    }
+}
+
+void GameClient::reconcile(const NetPlayerState& authoritative, std::uint32_t nextInput)
+{
+    PROFILE_SCOPE("GameClient::reconcile");
+    serverRan = nextInput;
+    if (nextInput > firstSequence) 
+    {
+        stats.inputLatencyMs = (localTick - sentAt[(nextInput - 1) % INPUT_HISTORY]) * World::TIMESTEP * 1000.0;
+    }
+    
+    // Predicted state after the server's last input; equal means nothing to do
+    NetPlayerState& prediction = predicted[(nextInput - 1) % INPUT_HISTORY];
+    if (prediction == authoritative) 
+    {
+        return;
+    }
+    
+    stats.corrections++;
+    prediction = authoritative;
+    authoritative.apply(player);
+    collision.playerContacts.clear();
+    for (std::uint32_t sequence = nextInput; sequence != nextSequence; sequence++) 
+    {
+        predict(sequence);
+        stats.replayedInputs++;
+    }
+}
+
+void GameClient::predict(std::uint32_t sequence)
+{
+    world.simulatePlayer(player, collision, InputFrame::fromBits(inputs[sequence % INPUT_HISTORY]));
+    NetPlayerState::quantize(player);
+    predicted[sequence % INPUT_HISTORY] = NetPlayerState::capture(player);
+}
+
+void GameClient::sendInputs()
+{
+    // Everything the server is missing, oldest first, so one lost packet costs nothing
+    std::uint32_t count = std::min(nextSequence - serverHas, NET_MAX_INPUTS_PER_PACKET);
+    
+    writer.clear();
+    writePacketHeader(writer, NetPacketType::INPUT);
+    writer.writeBool(latest.tick != NO_TICK);
+    if (latest.tick != NO_TICK) 
+    {
+        writer.write(latest.tick, 32);
+    }
+    writer.write(serverHas, 32);
+    writer.write(count, 7);
+    for (std::uint32_t i = 0; i < count; i++) 
+    {
+        writer.write(inputs[(serverHas + i) % INPUT_HISTORY], 3);
+    }
+    send();
+}
+
+void GameClient::send()
+{
+    const std::vector<std::uint8_t>& bytes = writer.finish();
+    transport.send(server, bytes.data(), bytes.size());
+    stats.packetsSent++;
+    stats.bytesSent += bytes.size();
+}
+
+const NetSnapshot* GameClient::findSnapshot(std::uint32_t tick) const
+{
+    for (const NetSnapshot& snapshot : received) 
+    {
+        if (snapshot.tick == tick) 
+        {
+            return &snapshot;
+        }
+    }
+    return nullptr;
+}
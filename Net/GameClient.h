@@ -0,0 +1,182 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../World/World.h"
+#include "../Input/InputSource.h"
+#include "BitStream.h"
+#include "NetProtocol.h"
+#include "Transport.h"
+
+/**
+ * @struct NetClientStats
+ * @brief Traffic and prediction quality of a GameClient since it started
+ */
+struct NetClientStats
+{
+    std::uint64_t packetsSent = 0;
+    std::uint64_t packetsReceived = 0;
+    std::uint64_t bytesSent = 0;            ///< Payload bytes, without UDP/IP headers
+    std::uint64_t bytesReceived = 0;
+    std::uint64_t snapshotsReceived = 0;
+    std::uint64_t snapshotsOutOfOrder = 0;  ///< Older than one already applied (kept as baselines only)
+    std::uint64_t snapshotsUndecodable = 0; ///< Baseline no longer in the history
+    std::uint64_t corrections = 0;          ///< Snapshots that disagreed with the prediction
+    std::uint64_t replayedInputs = 0;       ///< Inputs re-simulated by corrections
+    std::uint64_t stalledTicks = 0;         ///< Ticks skipped because the input history was full
+    std::uint32_t unacknowledgedInputs = 0; ///< Predicted but not yet run by the server
+    double inputLatencyMs = 0.0;            ///< Latest input's send-to-result round trip
+};
+
+/**
+ * @class GameClient
+ * @brief Client side of GameServer: predicts the local player, reconciles with snapshots
+ * 
+ * The client's World must hold the same level as the server's; it is only
+ * read, so several clients (bots) may share one. Every tick() the local
+ * input is numbered, run immediately on the client's own Player with
+ * World::simulatePlayer() (prediction) and sent to the server together with
+ * every input the server has not confirmed receiving.
+ * 
+ * Each new snapshot says which inputs the server has run. The client
+ * compares the server's state for its player with what it predicted after
+ * the same input; if they differ it takes the server's state and replays
+ * the inputs the server has not run yet (reconciliation). Both sides run
+ * the same inputs and quantize identically, so this only happens when the
+ * two simulations disagree (e.g. a different level file or build); the
+ * local player normally never snaps.
+ * 
+ * Other players are not predicted; draw them from getSnapshot() and
+ * getPreviousSnapshot().
+ * 
+ * @example
+ * @code
+ * World world;
+ * world.loadLevel(level);
+ * UdpTransport socket;
+ * socket.bind(sf::Socket::AnyPort);
+ * GameClient client(world, socket, serverAddress);
+ * 
+ * // Every World::TIMESTEP:
+ * client.tick(readKeyboard());
+ * drawPlayer(client.getPlayer());
+ * @endcode
+ */
+class GameClient
+{
+public:
+    /** @brief Inputs remembered for replay; the client stalls if the server falls this far behind */
+    static constexpr std::uint32_t INPUT_HISTORY = 1024;
+    
+    /** @brief Ticks between CONNECT attempts */
+    static constexpr std::uint32_t CONNECT_RETRY_TICKS = 30;
+    
+    /** @brief Ticks without a packet from the server before giving up (5 s) */
+    static constexpr std::uint32_t TIMEOUT_TICKS = 600;
+    
+    /** @brief Tick of a snapshot that has not been received */
+    static constexpr std::uint32_t NO_TICK = 0xFFFFFFFF;
+    
+    /**
+     * @param world     Local copy of the level (not owned)
+     * @param transport Socket or loopback endpoint (not owned)
+     * @param server    Address of the GameServer
+     */
+    GameClient(World& world, Transport& transport, const NetAddress& server);
+    
+    GameClient(const GameClient&) = delete;
+    GameClient& operator=(const GameClient&) = delete;
+    
+    /**
+     * @brief Runs one client tick
+     * 
+     * Reads waiting packets (reconciling on new snapshots), then predicts
+     * this tick's input and sends it. Before the server has accepted the
+     * client this only retries CONNECT.
+     * 
+     * @param input Input held during this tick
+     */
+    void tick(const InputFrame& input);
+    
+    /** @brief Tells the server the client is leaving */
+    void disconnect();
+    
+    /** @brief Whether the server has accepted the client and not timed out */
+    bool isConnected() const;
+    
+    /** @brief Whether the server turned the client away (full) */
+    bool isRejected() const;
+    
+    /** @brief The client's player slot on the server (valid once connected) */
+    std::size_t getSlot() const;
+    
+    /** @brief The predicted local player */
+    const Player& getPlayer() const;
+    
+    /** @brief Newest snapshot received (tick is NO_TICK before the first) */
+    const NetSnapshot& getSnapshot() const;
+    
+    /** @brief Snapshot received before getSnapshot(), for interpolating other players */
+    const NetSnapshot& getPreviousSnapshot() const;
+    
+    /** @brief Counters */
+    const NetClientStats& getStats() const;
+    
+private:
+    void receivePackets();
+    void handleAccept(BitReader& reader);
+    void handleSnapshot(BitReader& reader);
+    
+    /** @brief Compares a server state with the prediction and replays if they differ */
+    void reconcile(const NetPlayerState& authoritative, std::uint32_t nextInput);
+    
+    /** @brief Runs one input on the local player and records the result */
+    void predict(std::uint32_t sequence);
+    
+    void sendInputs();
+    
+    /** @brief Sends the writer's packet and counts it */
+    void send();
+    
+    /** @brief Received snapshot with a given tick, or nullptr */
+    const NetSnapshot* findSnapshot(std::uint32_t tick) const;
+    
+    World& world;
+    Transport& transport;
+    NetAddress server;
+    
+    /** @brief Predicted local player and its collision handler (holds its contact cache) */
+    Player player;
+    Collision collision;
+    
+    bool connected = false;
+    bool rejected = false;
+    std::size_t slot = 0;
+    std::uint32_t localTick = 0;
+    std::uint32_t lastHeard = 0;
+    
+    /// @name Inputs (by sequence % INPUT_HISTORY)
+    /// @{
+    std::uint32_t nextSequence = 0;   ///< Sequence number the next input gets
+    std::uint32_t serverRan = 0;      ///< The server has run every input below this
+    std::uint32_t serverHas = 0;      ///< The server has received every input below this
+    std::uint32_t firstSequence = 0;  ///< Sequence of the first input after connecting
+    std::array<std::uint8_t, INPUT_HISTORY> inputs;
+    std::array<NetPlayerState, INPUT_HISTORY> predicted;  ///< State after running each input
+    std::array<std::uint32_t, INPUT_HISTORY> sentAt;      ///< localTick each input was predicted
+    /// @}
+    
+    /// @name Snapshots
+    /// @{
+    std::array<NetSnapshot, NET_SNAPSHOT_HISTORY> received;  ///< Decoded snapshots (baselines), oldest overwritten first
+    std::size_t receivedNext = 0;
+    NetSnapshot decoded;   ///< Scratch for the snapshot being read
+    NetSnapshot latest;    ///< Newest snapshot (tick NO_TICK until one arrives)
+    NetSnapshot before;    ///< The one it replaced
+    /// @}
+    
+    NetClientStats stats;
+    BitWriter writer;
+    std::vector<std::uint8_t> packet;
+};
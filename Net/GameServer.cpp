@@ -0,0 +1,309 @@
+#include "GameServer.h"
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace
+{
+    constexpr std::uint32_t NO_SEQUENCE = std::numeric_limits<std::uint32_t>::max();
+}
+
+GameServer::Client::Client(const NetAddress& address, const sf::Vector2f& spawn)
+    : address(address),
+      player(spawn.x, spawn.y)
+{
+    inputs.fill(0);
+    inputSequence.fill(NO_SEQUENCE);
+    NetPlayerState::quantize(player);
+}
+
+GameServer::GameServer(World& world, Transport& transport)
+    : world(world),
+      transport(transport),
+      spawn(world.player.getPosition())
+{
+    for (NetSnapshot& snapshot : history) 
+    {
+        snapshot.tick = NO_SEQUENCE;
+    }
+}
+
+void GameServer::tick()
+{
+    PROFILE_SCOPE("GameServer::tick");
+    auto start = std::chrono::steady_clock::now();
+    
+    receivePackets();
+    runInputs();
+    if (serverTick % snapshotInterval == 0) 
+    {
+        sendSnapshots();
+    }
+    serverTick++;
+    
+    stats.ticks++;
+    stats.lastTickMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.maxTickMs = std::max(stats.maxTickMs, stats.lastTickMs);
+    stats.overBudgetTicks += stats.lastTickMs > World::TIMESTEP * 1000.0;
+    totalTickMs += stats.lastTickMs;
+    stats.averageTickMs = totalTickMs / stats.ticks;
+}
+
+const Player* GameServer::getPlayer(std::size_t slot) const
+{
+    return slot < NET_MAX_CLIENTS && clients[slot] ? &clients[slot]->player : nullptr;
+}
+
+const NetServerStats& GameServer::getStats() const
+{
+    return stats;
+}
+
+void GameServer::receivePackets()
+{
+    PROFILE_SCOPE("GameServer::receive");
+    NetAddress from;
+    while (transport.receive(from, packet)) 
+    {
+        stats.packetsReceived++;
+        stats.bytesReceived += packet.size();
+        
+        BitReader reader(packet.data(), packet.size());
+        NetPacketType type;
+        if (!readPacketHeader(reader, type)) 
+        {
+            stats.invalidPackets++;
+            continue;
+        }
+        
+        if (type == NetPacketType::CONNECT) 
+        {
+            handleConnect(from);
+            continue;
+        }
+        
+        std::size_t slot = findClient(from);
+        if (slot == NET_MAX_CLIENTS) 
+        {
+            stats.invalidPackets++;
+            continue;
+        }
+        clients[slot]->lastHeard = serverTick;
+        
+        if (type == NetPacketType::INPUT) 
+        {
+            handleInput(*clients[slot], reader);
+        }
+        else if (type == NetPacketType::DISCONNECT) 
+        {
+            clients[slot] = nullptr;
+            stats.clients--;
+        }
+    }
+}
+
+void GameServer::handleConnect(const NetAddress& from)
+{
+    // A repeated CONNECT means our ACCEPT was lost: answer again
+    std::size_t slot = findClient(from);
+    if (slot == NET_MAX_CLIENTS) 
+    {
+        slot = 0;
+        while (slot < NET_MAX_CLIENTS && clients[slot]) 
+        {
+            slot++;
+        }
+        if (slot == NET_MAX_CLIENTS) 
+        {
+            writer.clear();
+            writePacketHeader(writer, NetPacketType::REJECT);
+            send(from);
+            return;
+        }
+        clients[slot] = std::make_unique<Client>(from, spawn);
+        stats.clients++;
+    }
+    clients[slot]->lastHeard = serverTick;
+    sendAccept(slot);
+}
+
+void GameServer::handleInput(Client& client, BitReader& reader)
+{
+    bool hasAck = reader.readBool();
+    std::uint32_t ackTick = hasAck ? reader.read(32) : 0;
+    std::uint32_t first = reader.read(32);
+    std::uint32_t count = reader.read(7);
+    if (reader.overflowed() || count > NET_MAX_INPUTS_PER_PACKET) 
+    {
+        stats.invalidPackets++;
+        return;
+    }
+    
+    // Acks can arrive out of order; only ever move forward
+    if (hasAck && ackTick <= serverTick && (!client.hasAck || ackTick > client.ackedTick)) 
+    {
+        client.hasAck = true;
+        client.ackedTick = ackTick;
+    }
+    
+    for (std::uint32_t i = 0; i < count; i++) 
+    {
+        std::uint8_t bits = static_cast<std::uint8_t>(reader.read(3));
+        std::uint32_t sequence = first + i;
+        if (reader.overflowed()) 
+        {
+            break;
+        }
+        // Already run, or too far ahead to buffer: the client will resend it
+        if (sequence < client.nextInput || sequence - client.nextInput >= INPUT_BUFFER) 
+        {
+            continue;
+        }
+        client.inputs[sequence % INPUT_BUFFER] = bits;
+        client.inputSequence[sequence % INPUT_BUFFER] = sequence;
+    }
+}
+
+void GameServer::runInputs()
+{
+    PROFILE_SCOPE("GameServer::simulate");
+    for (std::unique_ptr<Client>& client : clients) 
+    {
+        if (!client) 
+        {
+            continue;
+        }
+        if (serverTick - client->lastHeard > TIMEOUT_TICKS) 
+        {
+            client = nullptr;
+            stats.clients--;
+            continue;
+        }
+        
+        // Inputs only run in order; a gap waits for the client's resend
+        std::uint32_t ready = receivedUpTo(*client) - client->nextInput;
+        if (client->buffering) 
+        {
+            // Refill the jitter buffer, but never wait longer than filling it should take
+            if (ready < inputDelay && client->bufferedTicks < inputDelay) 
+            {
+                client->bufferedTicks++;
+                stats.starvedTicks++;
+                continue;
+            }
+            client->buffering = false;
+        }
+        
+        // One input per tick keeps the buffer full; only a real backlog is hurried
+        std::uint32_t limit = ready > 2 * inputDelay ? MAX_INPUTS_PER_TICK : 1;
+        std::uint32_t run = 0;
+        while (run < limit && run < ready) 
+        {
+            InputFrame input = InputFrame::fromBits(client->inputs[client->nextInput % INPUT_BUFFER]);
+            world.simulatePlayer(client->player, client->collision, input);
+            NetPlayerState::quantize(client->player);
+            client->nextInput++;
+            run++;
+        }
+        stats.inputsRun += run;
+        if (run == 0) 
+        {
+            stats.starvedTicks++;
+            client->buffering = true;
+            client->bufferedTicks = 0;
+        }
+    }
+}
+
+void GameServer::sendSnapshots()
+{
+    PROFILE_SCOPE("GameServer::sendSnapshots");
+    NetSnapshot& snapshot = history[(serverTick / snapshotInterval) % NET_SNAPSHOT_HISTORY];
+    snapshot.tick = serverTick;
+    snapshot.present = 0;
+    for (std::size_t slot = 0; slot < NET_MAX_CLIENTS; slot++) 
+    {
+        if (clients[slot]) 
+        {
+            snapshot.present |= std::uint64_t(1) << slot;
+            snapshot.players[slot] = NetPlayerState::capture(clients[slot]->player);
+        }
+    }
+    
+    for (const std::unique_ptr<Client>& client : clients) 
+    {
+        if (!client) 
+        {
+            continue;
+        }
+        
+        // Delta against what the client has, if we still remember it
+        const NetSnapshot* baseline = nullptr;
+        if (client->hasAck && client->ackedTick != serverTick) 
+        {
+            const NetSnapshot& candidate = history[(client->ackedTick / snapshotInterval) % NET_SNAPSHOT_HISTORY];
+            if (candidate.tick == client->ackedTick) 
+            {
+                baseline = &candidate;
+            }
+        }
+        
+        writer.clear();
+        writePacketHeader(writer, NetPacketType::SNAPSHOT);
+        writer.write(serverTick, 32);
+        writer.writeBool(baseline != nullptr);
+        if (baseline) 
+        {
+            writer.write(baseline->tick, 32);
+        }
+        writer.write(client->nextInput, 32);
+        writer.writeDelta(static_cast<std::int32_t>(receivedUpTo(*client) - client->nextInput));
+        writeSnapshotPlayers(writer, snapshot, baseline);
+        send(client->address);
+        
+        stats.snapshotsSent++;
+        stats.deltaSnapshots += baseline != nullptr;
+    }
+}
+
+void GameServer::sendAccept(std::size_t slot)
+{
+    const Client& client = *clients[slot];
+    writer.clear();
+    writePacketHeader(writer, NetPacketType::ACCEPT);
+    writer.write(static_cast<std::uint32_t>(slot), 6);
+    writer.write(client.nextInput, 32);
+    writePlayerState(writer, NetPlayerState::capture(client.player), NetPlayerState());
+    send(client.address);
+}
+
+void GameServer::send(const NetAddress& to)
+{
+    const std::vector<std::uint8_t>& bytes = writer.finish();
+    transport.send(to, bytes.data(), bytes.size());
+    stats.packetsSent++;
+    stats.bytesSent += bytes.size();
+}
+
+std::size_t GameServer::findClient(const NetAddress& address) const
+{
+    for (std::size_t slot = 0; slot < NET_MAX_CLIENTS; slot++) 
+    {
+        if (clients[slot] && clients[slot]->address == address) 
+        {
+            return slot;
+        }
+    }
+    return NET_MAX_CLIENTS;
+}
+
+std::uint32_t GameServer::receivedUpTo(const Client& client) const
+{
+    std::uint32_t sequence = client.nextInput;
+    while (sequence - client.nextInput < INPUT_BUFFER && client.inputSequence[sequence % INPUT_BUFFER] == sequence) 
+    {
+        sequence++;
+    }
+    return sequence;
+}
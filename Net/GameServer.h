@@ -0,0 +1,190 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "../Player/Player.h"
+#include "../Physics/Collision.h"
+#include "../World/World.h"
+#include "BitStream.h"
+#include "NetProtocol.h"
+#include "Transport.h"
+
+/**
+ * @struct NetServerStats
+ * @brief Traffic and tick cost of a GameServer since it started
+ */
+struct NetServerStats
+{
+    std::size_t clients = 0;              ///< Connected right now
+    std::uint64_t ticks = 0;
+    std::uint64_t packetsSent = 0;
+    std::uint64_t packetsReceived = 0;
+    std::uint64_t bytesSent = 0;          ///< Payload bytes, without UDP/IP headers
+    std::uint64_t bytesReceived = 0;
+    std::uint64_t snapshotsSent = 0;
+    std::uint64_t deltaSnapshots = 0;     ///< Snapshots coded against an acknowledged baseline
+    std::uint64_t inputsRun = 0;          ///< Client inputs simulated
+    std::uint64_t starvedTicks = 0;       ///< Per client, ticks with no input run (refilling the jitter buffer included)
+    std::uint64_t invalidPackets = 0;     ///< Malformed or from unknown senders
+    double lastTickMs = 0.0;              ///< Cost of the latest tick(), network I/O included
+    double averageTickMs = 0.0;
+    double maxTickMs = 0.0;
+    std::uint64_t overBudgetTicks = 0;    ///< Ticks that took longer than World::TIMESTEP
+};
+
+/**
+ * @class GameServer
+ * @brief Authoritative server: simulates every connected player, sends snapshots
+ * 
+ * Each client gets its own Player (and Collision, which holds its contact
+ * cache) moved through the world's level with World::simulatePlayer(). The
+ * server runs a client's inputs in sequence order and snaps the player to
+ * the network grid after each one. Inputs are never skipped: a gap left by
+ * a lost packet waits for the client's resend. A client that replays the
+ * same inputs from a received state therefore reaches exactly the
+ * server's result.
+ * 
+ * Inputs go through a small jitter buffer. A client's player only starts,
+ * or restarts after running dry, once inputDelay inputs are waiting (or
+ * after inputDelay ticks), and then runs one input per tick, so packets
+ * arriving a little late or a resend after a loss do not stall it. Only a
+ * backlog beyond twice the buffer is worked off faster, up to
+ * MAX_INPUTS_PER_TICK per tick.
+ * 
+ * Every snapshotInterval ticks the state of all players is recorded and
+ * sent to each client, delta-coded against the newest snapshot that client
+ * acknowledged (if still in the history) and otherwise in full.
+ * 
+ * @note Only players are replicated; the world's enemies are not stepped.
+ *       Input sequence numbers and ticks are 32 bits and do not wrap
+ *       (over a year at 120 Hz).
+ * 
+ * @example
+ * @code
+ * World world;
+ * world.loadLevel(level);
+ * UdpTransport socket;
+ * socket.bind(40000);
+ * GameServer server(world, socket);
+ * 
+ * // Every World::TIMESTEP:
+ * server.tick();
+ * @endcode
+ */
+class GameServer
+{
+public:
+    /** @brief Most inputs run for one client in a single tick */
+    static constexpr std::uint32_t MAX_INPUTS_PER_TICK = 4;
+    
+    /** @brief Inputs buffered ahead of the next one to run, per client */
+    static constexpr std::uint32_t INPUT_BUFFER = 128;
+    
+    /** @brief Ticks without a packet before a client is dropped (5 s) */
+    static constexpr std::uint32_t TIMEOUT_TICKS = 600;
+    
+    /**
+     * @param world     Level to simulate in; new players start at world.player's position
+     * @param transport Socket or loopback endpoint clients send to (not owned)
+     */
+    GameServer(World& world, Transport& transport);
+    
+    GameServer(const GameServer&) = delete;
+    GameServer& operator=(const GameServer&) = delete;
+    
+    /**
+     * @brief Runs one server tick
+     * 
+     * Reads every waiting packet, runs the clients' inputs, drops clients
+     * that timed out and, on snapshot ticks, sends every client a snapshot.
+     */
+    void tick();
+    
+    /** @brief The player in a slot, or nullptr if the slot is free */
+    const Player* getPlayer(std::size_t slot) const;
+    
+    /** @brief Counters and tick cost */
+    const NetServerStats& getStats() const;
+    
+    /** @brief Ticks between snapshots (4 = 30 per second); set before the first tick */
+    std::uint32_t snapshotInterval = 4;
+    
+    /** 
+     * @brief Depth of each client's jitter buffer in inputs (3 = 25 ms)
+     * 
+     * Covers that much jitter plus a lost packet's resend, at the cost of
+     * as many ticks of input latency. 0 runs every input as soon as it
+     * arrives.
+     */
+    std::uint32_t inputDelay = 3;
+    
+private:
+    /** @brief A connected client */
+    struct Client
+    {
+        Client(const NetAddress& address, const sf::Vector2f& spawn);
+        
+        NetAddress address;
+        Player player;
+        Collision collision;
+        
+        /** @brief Sequence number of the next input to run */
+        std::uint32_t nextInput = 0;
+        
+        /** @brief Waiting for the jitter buffer to fill before running inputs again */
+        bool buffering = true;
+        
+        /** @brief Ticks spent buffering so far */
+        std::uint32_t bufferedTicks = 0;
+        
+        /// @name Inputs Received Ahead (by sequence % INPUT_BUFFER)
+        /// @{
+        std::array<std::uint8_t, INPUT_BUFFER> inputs;
+        std::array<std::uint32_t, INPUT_BUFFER> inputSequence;  ///< Sequence stored in each entry
+        /// @}
+        
+        bool hasAck = false;
+        std::uint32_t ackedTick = 0;   ///< Newest snapshot the client has
+        std::uint32_t lastHeard = 0;   ///< Server tick of the client's last packet
+    };
+    
+    void receivePackets();
+    void handleConnect(const NetAddress& from);
+    void handleInput(Client& client, BitReader& reader);
+    void runInputs();
+    void sendSnapshots();
+    
+    /** @brief Writes an ACCEPT packet for a client */
+    void sendAccept(std::size_t slot);
+    
+    /** @brief Sends the writer's packet and counts it */
+    void send(const NetAddress& to);
+    
+    /** @brief Slot of the client at an address, or NET_MAX_CLIENTS */
+    std::size_t findClient(const NetAddress& address) const;
+    
+    /** @brief First sequence not yet received, counting from nextInput */
+    std::uint32_t receivedUpTo(const Client& client) const;
+    
+    World& world;
+    Transport& transport;
+    sf::Vector2f spawn;
+    
+    std::array<std::unique_ptr<Client>, NET_MAX_CLIENTS> clients;
+    
+    /** @brief Recorded snapshots, by (tick / snapshotInterval) % NET_SNAPSHOT_HISTORY */
+    std::array<NetSnapshot, NET_SNAPSHOT_HISTORY> history;
+    
+    std::uint32_t serverTick = 0;
+    NetServerStats stats;
+    double totalTickMs = 0.0;
+    
+    /// @name Scratch Reused Every Tick
+    /// @{
+    BitWriter writer;
+    std::vector<std::uint8_t> packet;
+    /// @}
+};
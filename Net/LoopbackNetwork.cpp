@@ -0,0 +1,102 @@
+#include "LoopbackNetwork.h"
+#include <algorithm>
+
+namespace
+{
+    constexpr std::uint32_t LOOPBACK_HOST = 0x7F000001; // 127.0.0.1
+}
+
+LoopbackNetwork::LoopbackNetwork(std::uint32_t seed)
+    : rng(seed)
+{
+}
+
+Transport& LoopbackNetwork::endpoint(std::uint16_t port)
+{
+    NetAddress local = address(port);
+    if (Endpoint* existing = find(local)) 
+    {
+        return *existing;
+    }
+    endpoints.push_back(std::make_unique<Endpoint>(*this, local));
+    return *endpoints.back();
+}
+
+NetAddress LoopbackNetwork::address(std::uint16_t port)
+{
+    NetAddress result;
+    result.host = LOOPBACK_HOST;
+    result.port = port;
+    return result;
+}
+
+void LoopbackNetwork::advance(double seconds)
+{
+    now += seconds;
+}
+
+LoopbackNetwork::Endpoint* LoopbackNetwork::find(const NetAddress& address)
+{
+    for (const auto& endpoint : endpoints) 
+    {
+        if (endpoint->local == address) 
+        {
+            return endpoint.get();
+        }
+    }
+    return nullptr;
+}
+
+namespace
+{
+    // Min-heap on delivery time, then on send order
+    struct LaterDatagram
+    {
+        template <typename Datagram>
+        bool operator()(const Datagram& a, const Datagram& b) const
+        {
+            return a.deliverAt != b.deliverAt ? a.deliverAt > b.deliverAt : a.order > b.order;
+        }
+    };
+}
+
+bool LoopbackNetwork::Endpoint::send(const NetAddress& to, const void* data, std::size_t size)
+{
+    network.datagramsSent++;
+    network.bytesSent += size;
+    
+    // Draw both numbers every time so the loss pattern does not depend on jitter
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    float lossRoll = unit(network.rng);
+    float jitterRoll = unit(network.rng);
+    
+    Endpoint* target = network.find(to);
+    if (!target || lossRoll < network.lossRate) 
+    {
+        network.datagramsDropped++;
+        return true; // Lost on the way, not refused
+    }
+    
+    const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+    Datagram datagram;
+    datagram.deliverAt = network.now + network.latencySeconds + jitterRoll * network.jitterSeconds;
+    datagram.order = network.sendCount++;
+    datagram.from = local;
+    datagram.data.assign(bytes, bytes + size);
+    target->inbox.push_back(std::move(datagram));
+    std::push_heap(target->inbox.begin(), target->inbox.end(), LaterDatagram());
+    return true;
+}
+
+bool LoopbackNetwork::Endpoint::receive(NetAddress& from, std::vector<std::uint8_t>& data)
+{
+    if (inbox.empty() || inbox.front().deliverAt > network.now) 
+    {
+        return false;
+    }
+    std::pop_heap(inbox.begin(), inbox.end(), LaterDatagram());
+    from = inbox.back().from;
+    data = std::move(inbox.back().data);
+    inbox.pop_back();
+    return true;
+}
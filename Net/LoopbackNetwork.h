@@ -0,0 +1,108 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Transport.h"
+
+/**
+ * @class LoopbackNetwork
+ * @brief In-process network with simulated latency, jitter and packet loss
+ * 
+ * Each endpoint() is a Transport with its own address. A sent datagram is
+ * dropped with probability lossRate, otherwise it becomes receivable once
+ * the network's clock has advanced by latency plus a random jitter; jitter
+ * can reorder datagrams, as on a real network. Time only moves when the
+ * owner calls advance(), and randomness comes from a seeded generator, so a
+ * run is reproducible and can go faster than real time.
+ * 
+ * @example
+ * @code
+ * LoopbackNetwork network;
+ * network.latencySeconds = 0.05f;
+ * network.lossRate = 0.05f;
+ * GameServer server(world, network.endpoint(40000));
+ * GameClient client(clientWorld, network.endpoint(50000), network.address(40000));
+ * 
+ * // Every tick:
+ * client.tick(input);
+ * server.tick();
+ * network.advance(World::TIMESTEP);
+ * @endcode
+ */
+class LoopbackNetwork
+{
+public:
+    /**
+     * @param seed Seed for loss and jitter
+     */
+    explicit LoopbackNetwork(std::uint32_t seed = 1);
+    
+    LoopbackNetwork(const LoopbackNetwork&) = delete;
+    LoopbackNetwork& operator=(const LoopbackNetwork&) = delete;
+    
+    /**
+     * @brief Transport bound to a port on the loopback address
+     * 
+     * Creates the endpoint on first use; the reference stays valid for the
+     * network's lifetime.
+     */
+    Transport& endpoint(std::uint16_t port);
+    
+    /** @brief Address of the endpoint on a port */
+    static NetAddress address(std::uint16_t port);
+    
+    /** @brief Moves the network's clock forward, releasing datagrams that are due */
+    void advance(double seconds);
+    
+    /// @name Conditions (apply to datagrams sent afterwards)
+    /// @{
+    
+    float lossRate = 0.0f;         ///< Probability that a datagram is dropped
+    float latencySeconds = 0.0f;   ///< One-way delay
+    float jitterSeconds = 0.0f;    ///< Extra delay, uniform in 0..jitterSeconds
+    
+    /// @}
+    
+    /// @name Statistics
+    /// @{
+    
+    std::size_t datagramsSent = 0;
+    std::size_t datagramsDropped = 0;
+    std::size_t bytesSent = 0;
+    
+    /// @}
+    
+private:
+    struct Datagram
+    {
+        double deliverAt;
+        std::uint64_t order;  ///< Send order, breaks ties so equal delays stay in order
+        NetAddress from;
+        std::vector<std::uint8_t> data;
+    };
+    
+    class Endpoint : public Transport
+    {
+    public:
+        Endpoint(LoopbackNetwork& network, NetAddress address) : network(network), local(address) {}
+        
+        bool send(const NetAddress& to, const void* data, std::size_t size) override;
+        
+        bool receive(NetAddress& from, std::vector<std::uint8_t>& data) override;
+        
+        LoopbackNetwork& network;
+        NetAddress local;
+        
+        /** @brief Datagrams in flight to this endpoint, a min-heap on delivery time */
+        std::vector<Datagram> inbox;
+    };
+    
+    Endpoint* find(const NetAddress& address);
+    
+    std::vector<std::unique_ptr<Endpoint>> endpoints;
+    std::mt19937 rng;
+    double now = 0.0;
+    std::uint64_t sendCount = 0;
+};
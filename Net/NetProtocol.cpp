@@ -0,0 +1,169 @@
+#include "NetProtocol.h"
+#include <cmath>
+
+namespace
+{
+    constexpr std::uint8_t ON_GROUND_BIT = 1 << 0;
+    constexpr std::uint8_t FACING_RIGHT_BIT = 1 << 1;
+    constexpr unsigned int STATE_SHIFT = 2;
+    constexpr unsigned int FLAG_BITS = 4;
+    
+    // Highest occupied slot + 1, written in 7 bits (0..64)
+    constexpr unsigned int SLOT_COUNT_BITS = 7;
+    
+    std::int32_t quantizeValue(float value, float scale)
+    {
+        return static_cast<std::int32_t>(std::lround(value * scale));
+    }
+}
+
+NetPlayerState NetPlayerState::capture(const Player& player)
+{
+    NetPlayerState state;
+    state.x = quantizeValue(player.position.x, NET_POSITION_SCALE);
+    state.y = quantizeValue(player.position.y, NET_POSITION_SCALE);
+    state.vx = quantizeValue(player.velocity.x, NET_VELOCITY_SCALE);
+    state.vy = quantizeValue(player.velocity.y, NET_VELOCITY_SCALE);
+    state.flags = static_cast<std::uint8_t>((player.onGround ? ON_GROUND_BIT : 0) |
+                                            (player.facingRight ? FACING_RIGHT_BIT : 0) |
+                                            (static_cast<std::uint8_t>(player.currentState) << STATE_SHIFT));
+    return state;
+}
+
+void NetPlayerState::apply(Player& player) const
+{
+    PlayerState state = static_cast<PlayerState>(flags >> STATE_SHIFT);
+    unsigned int frame = state == player.currentState && player.currentAnimation ? player.currentAnimation->getCurrentFrame() : 0;
+    sf::Vector2f position(x / NET_POSITION_SCALE, y / NET_POSITION_SCALE);
+    player.setPose(state, frame, (flags & FACING_RIGHT_BIT) != 0, position);
+    player.velocity = sf::Vector2f(vx / NET_VELOCITY_SCALE, vy / NET_VELOCITY_SCALE);
+    player.onGround = (flags & ON_GROUND_BIT) != 0;
+}
+
+void NetPlayerState::quantize(Player& player)
+{
+    // Scales are powers of two, so the snapped values are exact floats
+    player.setPosition(sf::Vector2f(quantizeValue(player.position.x, NET_POSITION_SCALE) / NET_POSITION_SCALE, 
+                                    quantizeValue(player.position.y, NET_POSITION_SCALE) / NET_POSITION_SCALE));
+    player.velocity.x = quantizeValue(player.velocity.x, NET_VELOCITY_SCALE) / NET_VELOCITY_SCALE;
+    player.velocity.y = quantizeValue(player.velocity.y, NET_VELOCITY_SCALE) / NET_VELOCITY_SCALE;
+}
+
+void writePacketHeader(BitWriter& writer, NetPacketType type)
+{
+    writer.write(NET_PROTOCOL_ID, 32);
+    writer.write(static_cast<std::uint32_t>(type), 3);
+}
+
+bool readPacketHeader(BitReader& reader, NetPacketType& type)
+{
+    if (reader.read(32) != NET_PROTOCOL_ID) 
+    {
+        return false;
+    }
+    std::uint32_t value = reader.read(3);
+    if (reader.overflowed() || value > static_cast<std::uint32_t>(NetPacketType::DISCONNECT)) 
+    {
+        return false;
+    }
+    type = static_cast<NetPacketType>(value);
+    return true;
+}
+
+void writePlayerState(BitWriter& writer, const NetPlayerState& state, const NetPlayerState& baseline)
+{
+    // Deltas wrap instead of overflowing; the reader wraps them back
+    auto delta = [](std::int32_t value, std::int32_t base)
+    {
+        return static_cast<std::int32_t>(static_cast<std::uint32_t>(value) - static_cast<std::uint32_t>(base));
+    };
+    writer.writeDelta(delta(state.x, baseline.x));
+    writer.writeDelta(delta(state.y, baseline.y));
+    writer.writeDelta(delta(state.vx, baseline.vx));
+    writer.writeDelta(delta(state.vy, baseline.vy));
+    writer.writeBool(state.flags != baseline.flags);
+    if (state.flags != baseline.flags) 
+    {
+        writer.write(state.flags, FLAG_BITS);
+    }
+}
+
+NetPlayerState readPlayerState(BitReader& reader, const NetPlayerState& baseline)
+{
+    auto undelta = [](std::int32_t delta, std::int32_t base)
+    {
+        return static_cast<std::int32_t>(static_cast<std::uint32_t>(base) + static_cast<std::uint32_t>(delta));
+    };
+    NetPlayerState state;
+    state.x = undelta(reader.readDelta(), baseline.x);
+    state.y = undelta(reader.readDelta(), baseline.y);
+    state.vx = undelta(reader.readDelta(), baseline.vx);
+    state.vy = undelta(reader.readDelta(), baseline.vy);
+    state.flags = reader.readBool() ? static_cast<std::uint8_t>(reader.read(FLAG_BITS)) : baseline.flags;
+    return state;
+}
+
+void writeSnapshotPlayers(BitWriter& writer, const NetSnapshot& snapshot, const NetSnapshot* baseline)
+{
+    std::uint32_t slots = 0;
+    for (std::uint32_t slot = 0; slot < NET_MAX_CLIENTS; slot++) 
+    {
+        if (snapshot.has(slot)) 
+        {
+            slots = slot + 1;
+        }
+    }
+    writer.write(slots, SLOT_COUNT_BITS);
+    
+    static const NetPlayerState empty;
+    for (std::uint32_t slot = 0; slot < slots; slot++) 
+    {
+        writer.writeBool(snapshot.has(slot));
+        if (!snapshot.has(slot)) 
+        {
+            continue;
+        }
+        
+        // Players the receiver already knows cost one bit while unchanged
+        bool known = baseline && baseline->has(slot);
+        if (known) 
+        {
+            bool changed = snapshot.players[slot] != baseline->players[slot];
+            writer.writeBool(changed);
+            if (!changed) 
+            {
+                continue;
+            }
+        }
+        writePlayerState(writer, snapshot.players[slot], known ? baseline->players[slot] : empty);
+    }
+}
+
+bool readSnapshotPlayers(BitReader& reader, NetSnapshot& snapshot, const NetSnapshot* baseline)
+{
+    std::uint32_t slots = reader.read(SLOT_COUNT_BITS);
+    if (slots > NET_MAX_CLIENTS) 
+    {
+        return false;
+    }
+    
+    static const NetPlayerState empty;
+    snapshot.present = 0;
+    for (std::uint32_t slot = 0; slot < slots; slot++) 
+    {
+        if (!reader.readBool()) 
+        {
+            continue;
+        }
+        snapshot.present |= std::uint64_t(1) << slot;
+        
+        bool known = baseline && baseline->has(slot);
+        if (known && !reader.readBool()) 
+        {
+            snapshot.players[slot] = baseline->players[slot];
+            continue;
+        }
+        snapshot.players[slot] = readPlayerState(reader, known ? baseline->players[slot] : empty);
+    }
+    return !reader.overflowed();
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "../Player/Player.h"
+#include "BitStream.h"
+
+/**
+ * @file NetProtocol.h
+ * @brief Packet layout and quantized player state shared by GameServer and GameClient
+ * 
+ * Every packet starts with NET_PROTOCOL_ID (32 bits) and a NetPacketType
+ * (3 bits); the rest is bit-packed with BitWriter:
+ * 
+ * @code
+ * CONNECT     (client -> server, resent until answered)
+ * ACCEPT      slot:6  nextInput:32  state:absolute player state    (server -> client)
+ * REJECT      (server full)
+ * INPUT       hasAck:1 [ackTick:32]  firstSequence:32  count:7  buttons:3 * count
+ * SNAPSHOT    tick:32  hasBaseline:1 [baselineTick:32]  nextInput:32  received:delta  players
+ * DISCONNECT  (either side)
+ * @endcode
+ * 
+ * ACCEPT's nextInput is the sequence number the client's first input has
+ * to carry. INPUT repeats every input the server has not received yet, so
+ * a lost packet is covered by the next one. SNAPSHOT's nextInput is the
+ * sequence number of the first input the server has not run yet for that
+ * client, and received (coded as a delta from nextInput) the first it
+ * does not have.
+ * Its players are delta-coded against the newest snapshot the client
+ * acknowledged (ackTick); when that is too old or missing they are coded
+ * against an empty snapshot.
+ */
+
+/** @brief First 32 bits of every packet; anything else is ignored */
+constexpr std::uint32_t NET_PROTOCOL_ID = 0x31504E47; // "GNP1"
+
+/** @brief Player slots on a server (fits the 6-bit slot field) */
+constexpr std::size_t NET_MAX_CLIENTS = 64;
+
+/** @brief Largest packet either side sends, below common path MTUs */
+constexpr std::size_t NET_MAX_PACKET = 1200;
+
+/** @brief Quantization steps per pixel (positions) and per pixel/second (velocities) */
+constexpr float NET_POSITION_SCALE = 16.0f;
+constexpr float NET_VELOCITY_SCALE = 16.0f;
+
+/** @brief Snapshots kept by both sides to serve as delta baselines */
+constexpr std::size_t NET_SNAPSHOT_HISTORY = 32;
+
+/** @brief Most inputs carried by one INPUT packet (fits the 7-bit count field) */
+constexpr std::uint32_t NET_MAX_INPUTS_PER_PACKET = 64;
+
+/**
+ * @enum NetPacketType
+ * @brief Second field of every packet
+ */
+enum class NetPacketType : std::uint8_t
+{
+    CONNECT,
+    ACCEPT,
+    REJECT,
+    INPUT,
+    SNAPSHOT,
+    DISCONNECT,
+};
+
+/**
+ * @struct NetPlayerState
+ * @brief One player's simulation state, quantized as it goes over the wire
+ * 
+ * Both server and client snap their players to this grid after every tick
+ * (see quantize()), so a client replaying the server's inputs from a
+ * received state lands on exactly the same values the server computed.
+ */
+struct NetPlayerState
+{
+    std::int32_t x = 0;   ///< Position in 1/NET_POSITION_SCALE pixels
+    std::int32_t y = 0;
+    std::int32_t vx = 0;  ///< Velocity in 1/NET_VELOCITY_SCALE pixels per second
+    std::int32_t vy = 0;
+    std::uint8_t flags = 0;  ///< onGround, facingRight, then PlayerState in 2 bits
+    
+    /** @brief Quantizes a player's state */
+    static NetPlayerState capture(const Player& player);
+    
+    /**
+     * @brief Sets a player to this state
+     * 
+     * The animation frame is kept when the state does not change, so a
+     * correction does not restart the animation.
+     */
+    void apply(Player& player) const;
+    
+    /** @brief Snaps a player to the quantization grid */
+    static void quantize(Player& player);
+    
+    bool operator==(const NetPlayerState& other) const
+    {
+        return x == other.x && y == other.y && vx == other.vx && vy == other.vy && flags == other.flags;
+    }
+    bool operator!=(const NetPlayerState& other) const { return !(*this == other); }
+};
+
+/**
+ * @struct NetSnapshot
+ * @brief State of every player slot at one server tick
+ */
+struct NetSnapshot
+{
+    std::uint32_t tick = 0;                                ///< Server tick the state belongs to
+    std::uint64_t present = 0;                             ///< Bit per slot that holds a player
+    std::array<NetPlayerState, NET_MAX_CLIENTS> players;  ///< Valid where present
+    
+    bool has(std::size_t slot) const { return (present >> slot) & 1; }
+};
+
+/**
+ * @brief Writes a packet's protocol id and type
+ */
+void writePacketHeader(BitWriter& writer, NetPacketType type);
+
+/**
+ * @brief Reads a packet's protocol id and type
+ * 
+ * @return false if the packet does not start with NET_PROTOCOL_ID or the type is unknown
+ */
+bool readPacketHeader(BitReader& reader, NetPacketType& type);
+
+/**
+ * @brief Writes a player state field by field as deltas from a baseline
+ */
+void writePlayerState(BitWriter& writer, const NetPlayerState& state, const NetPlayerState& baseline);
+
+/**
+ * @brief Reads a state written by writePlayerState() with the same baseline
+ */
+NetPlayerState readPlayerState(BitReader& reader, const NetPlayerState& baseline);
+
+/**
+ * @brief Writes the players of a snapshot as deltas from a baseline
+ * 
+ * Costs one bit per slot up to the highest occupied one, two for a player
+ * that has not changed since the baseline, and a handful more per field
+ * that did.
+ * 
+ * @param baseline Snapshot the receiver already has, or nullptr for none
+ */
+void writeSnapshotPlayers(BitWriter& writer, const NetSnapshot& snapshot, const NetSnapshot* baseline);
+
+/**
+ * @brief Reads players written by writeSnapshotPlayers() with the same baseline
+ * 
+ * @return false if the data is malformed
+ */
+bool readSnapshotPlayers(BitReader& reader, NetSnapshot& snapshot, const NetSnapshot* baseline);
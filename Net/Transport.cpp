@@ -0,0 +1,39 @@
+#include "Transport.h"
+#include <iostream>
+#include <optional>
+
+bool UdpTransport::bind(unsigned short port)
+{
+    if (socket.bind(port) != sf::Socket::Status::Done) 
+    {
+        std::cout << "Failed to bind UDP port " << port << std::endl;
+        return false;
+    }
+    socket.setBlocking(false);
+    return true;
+}
+
+unsigned short UdpTransport::getLocalPort() const
+{
+    return socket.getLocalPort();
+}
+
+bool UdpTransport::send(const NetAddress& to, const void* data, std::size_t size)
+{
+    return socket.send(data, size, sf::IpAddress(to.host), to.port) == sf::Socket::Status::Done;
+}
+
+bool UdpTransport::receive(NetAddress& from, std::vector<std::uint8_t>& data)
+{
+    std::size_t received = 0;
+    std::optional<sf::IpAddress> remote;
+    unsigned short port = 0;
+    if (socket.receive(buffer.data(), buffer.size(), received, remote, port) != sf::Socket::Status::Done || !remote) 
+    {
+        return false;
+    }
+    from.host = remote->toInteger();
+    from.port = port;
+    data.assign(buffer.begin(), buffer.begin() + received);
+    return true;
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <SFML/Network.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct NetAddress
+ * @brief IPv4 address and port of a datagram's sender or receiver
+ */
+struct NetAddress
+{
+    std::uint32_t host = 0;  ///< IPv4 address, sf::IpAddress::toInteger() order
+    std::uint16_t port = 0;
+    
+    bool operator==(const NetAddress& other) const { return host == other.host && port == other.port; }
+    bool operator!=(const NetAddress& other) const { return !(*this == other); }
+};
+
+/**
+ * @class Transport
+ * @brief Unreliable, unordered datagram delivery (UDP or a simulated network)
+ * 
+ * GameServer and GameClient only talk through this, so the same code runs
+ * over real sockets and over LoopbackNetwork in tests and benchmarks.
+ */
+class Transport
+{
+public:
+    virtual ~Transport() = default;
+    
+    /**
+     * @brief Sends one datagram (may be silently lost)
+     * 
+     * @return false if it could not even be handed to the network
+     */
+    virtual bool send(const NetAddress& to, const void* data, std::size_t size) = 0;
+    
+    /**
+     * @brief Takes the next datagram that has arrived, without waiting
+     * 
+     * @param from Receives the sender's address
+     * @param data Receives the payload (resized to fit)
+     * @return false if nothing is waiting
+     */
+    virtual bool receive(NetAddress& from, std::vector<std::uint8_t>& data) = 0;
+};
+
+/**
+ * @class UdpTransport
+ * @brief Transport over a non-blocking sf::UdpSocket
+ */
+class UdpTransport : public Transport
+{
+public:
+    /**
+     * @brief Binds the socket and switches it to non-blocking mode
+     * 
+     * @param port Local port, or sf::Socket::AnyPort for an ephemeral one (clients)
+     * @return true on success
+     */
+    bool bind(unsigned short port);
+    
+    /** @brief Port the socket is bound to */
+    unsigned short getLocalPort() const;
+    
+    bool send(const NetAddress& to, const void* data, std::size_t size) override;
+    
+    bool receive(NetAddress& from, std::vector<std::uint8_t>& data) override;
+    
+private:
+    sf::UdpSocket socket;
+    std::array<std::uint8_t, sf::UdpSocket::MaxDatagramSize> buffer;
+};
@@ -0,0 +1,181 @@
+#include "AabbKernel.h"
+#include <algorithm>
+
+// Widest instruction set the compiler is allowed to emit
+#if !defined(GAME_DISABLE_SIMD) && defined(__AVX__)
+    #include <immintrin.h>
+    #define AABB_KERNEL_AVX
+#elif !defined(GAME_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64))
+    #include <emmintrin.h>
+    #define AABB_KERNEL_SSE
+#endif
+
+namespace
+{
+    // Bits set in a mask word
+    std::size_t popCount(std::uint32_t bits)
+    {
+        std::size_t count = 0;
+        for (; bits != 0; bits &= bits - 1) 
+        {
+            count++;
+        }
+        return count;
+    }
+}
+
+void AabbArrays::assign(const sf::FloatRect* rects, std::size_t count)
+{
+    clear();
+    minX.reserve(count);
+    minY.reserve(count);
+    maxX.reserve(count);
+    maxY.reserve(count);
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        push(rects[i]);
+    }
+}
+
+void AabbArrays::push(const sf::FloatRect& rect)
+{
+    minX.push_back(rect.position.x);
+    minY.push_back(rect.position.y);
+    maxX.push_back(rect.position.x + rect.size.x);
+    maxY.push_back(rect.position.y + rect.size.y);
+}
+
+void AabbArrays::clear()
+{
+    minX.clear();
+    minY.clear();
+    maxX.clear();
+    maxY.clear();
+}
+
+std::size_t AabbKernel::overlap(const sf::FloatRect& box, const AabbArrays& boxes, std::size_t first, std::size_t count,
+                                std::uint32_t* hits, float* overlapX, float* overlapY)
+{
+    return overlap(box, boxes.minX.data() + first, boxes.minY.data() + first,
+                   boxes.maxX.data() + first, boxes.maxY.data() + first, count, hits, overlapX, overlapY);
+}
+
+std::size_t AabbKernel::overlapScalar(const sf::FloatRect& box, const float* minX, const float* minY,
+                                      const float* maxX, const float* maxY, std::size_t count,
+                                      std::uint32_t* hits, float* overlapX, float* overlapY)
+{
+    // Same operations as findIntersection, so the extents match it bit for bit
+    const float boxMinX = box.position.x;
+    const float boxMinY = box.position.y;
+    const float boxMaxX = box.position.x + box.size.x;
+    const float boxMaxY = box.position.y + box.size.y;
+    
+    std::fill(hits, hits + maskWords(count), 0u);
+    std::size_t hitCount = 0;
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        float width = std::min(boxMaxX, maxX[i]) - std::max(boxMinX, minX[i]);
+        float height = std::min(boxMaxY, maxY[i]) - std::max(boxMinY, minY[i]);
+        overlapX[i] = width;
+        overlapY[i] = height;
+        if (width > 0.0f && height > 0.0f) 
+        {
+            hits[i / 32] |= 1u << (i % 32);
+            hitCount++;
+        }
+    }
+    return hitCount;
+}
+
+std::size_t AabbKernel::overlap(const sf::FloatRect& box, const float* minX, const float* minY,
+                                const float* maxX, const float* maxY, std::size_t count,
+                                std::uint32_t* hits, float* overlapX, float* overlapY)
+{
+#if defined(AABB_KERNEL_AVX)
+    const std::size_t width = 8;
+    const __m256 boxMinX = _mm256_set1_ps(box.position.x);
+    const __m256 boxMinY = _mm256_set1_ps(box.position.y);
+    const __m256 boxMaxX = _mm256_set1_ps(box.position.x + box.size.x);
+    const __m256 boxMaxY = _mm256_set1_ps(box.position.y + box.size.y);
+    const __m256 zero = _mm256_setzero_ps();
+    
+    std::fill(hits, hits + maskWords(count), 0u);
+    std::size_t i = 0;
+    for (; i + width <= count; i += width) 
+    {
+        __m256 w = _mm256_sub_ps(_mm256_min_ps(boxMaxX, _mm256_loadu_ps(maxX + i)),
+                                 _mm256_max_ps(boxMinX, _mm256_loadu_ps(minX + i)));
+        __m256 h = _mm256_sub_ps(_mm256_min_ps(boxMaxY, _mm256_loadu_ps(maxY + i)),
+                                 _mm256_max_ps(boxMinY, _mm256_loadu_ps(minY + i)));
+        _mm256_storeu_ps(overlapX + i, w);
+        _mm256_storeu_ps(overlapY + i, h);
+        
+        __m256 hit = _mm256_and_ps(_mm256_cmp_ps(w, zero, _CMP_GT_OQ), _mm256_cmp_ps(h, zero, _CMP_GT_OQ));
+        hits[i / 32] |= static_cast<std::uint32_t>(_mm256_movemask_ps(hit)) << (i % 32);
+    }
+#elif defined(AABB_KERNEL_SSE)
+    const std::size_t width = 4;
+    const __m128 boxMinX = _mm_set1_ps(box.position.x);
+    const __m128 boxMinY = _mm_set1_ps(box.position.y);
+    const __m128 boxMaxX = _mm_set1_ps(box.position.x + box.size.x);
+    const __m128 boxMaxY = _mm_set1_ps(box.position.y + box.size.y);
+    const __m128 zero = _mm_setzero_ps();
+    
+    std::fill(hits, hits + maskWords(count), 0u);
+    std::size_t i = 0;
+    for (; i + width <= count; i += width) 
+    {
+        __m128 w = _mm_sub_ps(_mm_min_ps(boxMaxX, _mm_loadu_ps(maxX + i)),
+                              _mm_max_ps(boxMinX, _mm_loadu_ps(minX + i)));
+        __m128 h = _mm_sub_ps(_mm_min_ps(boxMaxY, _mm_loadu_ps(maxY + i)),
+                              _mm_max_ps(boxMinY, _mm_loadu_ps(minY + i)));
+        _mm_storeu_ps(overlapX + i, w);
+        _mm_storeu_ps(overlapY + i, h);
+        
+        __m128 hit = _mm_and_ps(_mm_cmpgt_ps(w, zero), _mm_cmpgt_ps(h, zero));
+        hits[i / 32] |= static_cast<std::uint32_t>(_mm_movemask_ps(hit)) << (i % 32);
+    }
+#else
+    return overlapScalar(box, minX, minY, maxX, maxY, count, hits, overlapX, overlapY);
+#endif
+
+#if defined(AABB_KERNEL_AVX) || defined(AABB_KERNEL_SSE)
+    // Tail that does not fill a whole vector; i is a multiple of the width,
+    // so the tail's mask bits start on a fresh group within the word
+    if (i < count) 
+    {
+        std::uint32_t tail[1];
+        overlapScalar(box, minX + i, minY + i, maxX + i, maxY + i, count - i, tail, overlapX + i, overlapY + i);
+        hits[i / 32] |= tail[0] << (i % 32);
+    }
+    
+    std::size_t hitCount = 0;
+    for (std::size_t word = 0; word < maskWords(count); word++) 
+    {
+        hitCount += popCount(hits[word]);
+    }
+    return hitCount;
+#endif
+}
+
+const char* AabbKernel::instructionSet()
+{
+#if defined(AABB_KERNEL_AVX)
+    return "AVX";
+#elif defined(AABB_KERNEL_SSE)
+    return "SSE";
+#else
+    return "scalar";
+#endif
+}
+
+std::size_t AabbKernel::lanes()
+{
+#if defined(AABB_KERNEL_AVX)
+    return 8;
+#elif defined(AABB_KERNEL_SSE)
+    return 4;
+#else
+    return 1;
+#endif
+}
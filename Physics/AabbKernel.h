@@ -0,0 +1,99 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct AabbArrays
+ * @brief Axis-aligned boxes stored as four parallel float arrays
+ * 
+ * The layout AabbKernel reads: one contiguous array per edge, so a single
+ * vector load fetches the same edge of 4 or 8 boxes.
+ */
+struct AabbArrays
+{
+    std::vector<float> minX;  ///< Left edge
+    std::vector<float> minY;  ///< Top edge
+    std::vector<float> maxX;  ///< Right edge
+    std::vector<float> maxY;  ///< Bottom edge
+    
+    /** @brief Replaces the contents with a list of rectangles */
+    void assign(const sf::FloatRect* rects, std::size_t count);
+    
+    /** @brief Appends one rectangle */
+    void push(const sf::FloatRect& rect);
+    
+    /** @brief Removes every box (keeps capacity) */
+    void clear();
+    
+    /** @brief Number of boxes */
+    std::size_t size() const { return minX.size(); }
+};
+
+/**
+ * @class AabbKernel
+ * @brief Tests one box against many boxes, 4 or 8 per instruction
+ * 
+ * Computes the overlap extents of a query box with every box of a SoA set,
+ * exactly as sf::FloatRect::findIntersection would (same operations, same
+ * rounding), and packs the hit flags into bit masks.
+ * 
+ * The instruction set is picked at compile time: AVX (8 lanes) when the
+ * compiler targets it (-mavx / -mavx2 / -march=native, /arch:AVX2), SSE
+ * (4 lanes) on any x86-64 build, scalar otherwise. Define GAME_DISABLE_SIMD
+ * to force the scalar path.
+ * 
+ * @example
+ * @code
+ * std::vector<std::uint32_t> hits(AabbKernel::maskWords(arrays.size()));
+ * std::vector<float> overlapX(arrays.size()), overlapY(arrays.size());
+ * AabbKernel::overlap(player.getGlobalBounds(), arrays, 0, arrays.size(),
+ *                     hits.data(), overlapX.data(), overlapY.data());
+ * @endcode
+ */
+class AabbKernel
+{
+public:
+    /**
+     * @brief Overlap of one box against boxes [first, first + count)
+     * 
+     * @param box      Query box
+     * @param boxes    Boxes to test against
+     * @param first    First box to test
+     * @param count    Number of boxes to test
+     * @param hits     Receives one bit per tested box (bit i % 32 of word
+     *                 i / 32, i relative to first); maskWords(count) words
+     * @param overlapX Receives the intersection width per box (<= 0 on a miss)
+     * @param overlapY Receives the intersection height per box (<= 0 on a miss)
+     * @return Number of boxes that overlap
+     */
+    static std::size_t overlap(const sf::FloatRect& box, const AabbArrays& boxes, std::size_t first, std::size_t count,
+                               std::uint32_t* hits, float* overlapX, float* overlapY);
+    
+    /**
+     * @brief overlap() on raw arrays
+     */
+    static std::size_t overlap(const sf::FloatRect& box, const float* minX, const float* minY,
+                               const float* maxX, const float* maxY, std::size_t count,
+                               std::uint32_t* hits, float* overlapX, float* overlapY);
+    
+    /**
+     * @brief Portable one-box-at-a-time version of overlap()
+     * 
+     * What overlap() compiles to without SIMD; kept callable for
+     * benchmarks and for checking the vector paths against.
+     */
+    static std::size_t overlapScalar(const sf::FloatRect& box, const float* minX, const float* minY,
+                                     const float* maxX, const float* maxY, std::size_t count,
+                                     std::uint32_t* hits, float* overlapX, float* overlapY);
+    
+    /** @brief Number of mask words needed for count boxes */
+    static constexpr std::size_t maskWords(std::size_t count) { return (count + 31) / 32; }
+    
+    /** @brief Instruction set overlap() was compiled for ("AVX", "SSE" or "scalar") */
+    static const char* instructionSet();
+    
+    /** @brief Boxes tested per instruction by overlap() */
+    static std::size_t lanes();
+};
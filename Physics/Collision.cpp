@@ -1,7 +1,29 @@
 #include <optional>
 #include "Collision.h"
-#include <iostream>
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
+namespace
+{
+    // Index of the lowest set bit across mask words (caller knows one is set)
+    std::size_t firstHit(const std::uint32_t* words)
+    {
+        std::size_t base = 0;
+        for (; *words == 0; words++) 
+        {
+            base += 32;
+        }
+        std::uint32_t bits = *words;
+        while ((bits & 1u) == 0) 
+        {
+            bits >>= 1;
+            base++;
+        }
+        return base;
+    }
+}
 
 // Check collision and get intersection using findIntersection
 std::optional<sf::FloatRect> Collision::getIntersection(const Player& player, const Platform& platform) 
@@ -15,81 +37,371 @@ std::optional<sf::FloatRect> Collision::getIntersection(const Player& player, co
 // Handle player/platform collision using intersection data
 void Collision::handleCollision(Player& player, const Platform& platform) 
 {
-    std::optional<sf::FloatRect> intersection = getIntersection(player, platform);
+    handleCollision(player, platform.shape.getGlobalBounds());
+}
+
+// Resolve against the platforms the grid reports near the player
+void Collision::handleCollisions(Player& player, const SpatialGrid& grid) 
+{
+    // After a sweep a cache hit is the sweep's lookup again; a real query
+    // (the sweep's result was too crowded to cache) still counts
+    ContactStats lookup;
+    gatherCandidates(player.getGlobalBounds(), grid, playerContacts, candidates, lookup);
+    stats.queries += lookup.queries;
+    if (!swept) 
+    {
+        stats.queriesAvoided += lookup.queriesAvoided;
+    }
+    swept = false;
     
-    if (!intersection.has_value()) 
+    nearby.clear();
+    for (std::size_t index : candidates) 
+    {
+        nearby.push(grid.getBounds(index));
+    }
+    handleCollisions(player, nearby);
+}
+
+// Test every box at once, then resolve the hits in order
+void Collision::handleCollisions(Player& player, const AabbArrays& platforms) 
+{
+    PROFILE_SCOPE("Collision::handleCollisions");
+    std::size_t count = platforms.size();
+    hitMask.resize(AabbKernel::maskWords(count));
+    overlapX.resize(count);
+    overlapY.resize(count);
+    
+    std::size_t next = 0;
+    while (next < count) 
+    {
+        sf::FloatRect bounds = player.getGlobalBounds();
+        std::size_t hits = AabbKernel::overlap(bounds, platforms, next, count - next, 
+                                               hitMask.data(), overlapX.data(), overlapY.data());
+        if (hits == 0) 
+        {
+            break;
+        }
+        
+        // The push changes the player's bounds, so everything after this
+        // box is retested on the next pass
+        std::size_t hit = firstHit(hitMask.data());
+        applyResponse(player, resolveExtents(bounds, platforms.minX[next + hit], platforms.minY[next + hit], 
+                                             overlapX[hit], overlapY[hit]));
+        next += hit + 1;
+    }
+}
+
+// Resolve against a platform's (cached) bounds
+void Collision::handleCollision(Player& player, const sf::FloatRect& platformBounds) 
+{
+    std::optional<CollisionResponse> response = resolveOverlap(player.getGlobalBounds(), platformBounds);
+    
+    if (!response.has_value()) 
     {
         return; // No collision, return early
     }
     
-    // Print the intersection values
+    applyResponse(player, response.value());
+}
+
+void Collision::applyResponse(Player& player, const CollisionResponse& response) 
+{
+    player.setPosition(player.getPosition() + response.push);
+    if (response.stopX) 
+    {
+        player.velocity.x = 0;
+    }
+    if (response.stopY) 
+    {
+        player.velocity.y = 0;
+    }
+    if (response.landed) 
+    {
+        player.onGround = true;
+    }
+}
+
+// Work out how a body should be pushed out of a platform
+std::optional<CollisionResponse> Collision::resolveOverlap(const sf::FloatRect& bodyBounds, const sf::FloatRect& platformBounds) 
+{
+    std::optional<sf::FloatRect> intersection = bodyBounds.findIntersection(platformBounds);
+    
+    if (!intersection.has_value()) 
+    {
+        return std::nullopt;
+    }
+    
     sf::FloatRect overlap = intersection.value();
-   
+    return resolveExtents(bodyBounds, platformBounds.position.x, platformBounds.position.y, overlap.size.x, overlap.size.y);
+}
 
-    sf::Vector2f playerPos = player.getPosition();
-    sf::FloatRect playerBounds = player.getGlobalBounds();
-    sf::FloatRect platformBounds = platform.shape.getGlobalBounds();
+// Push direction from the shape of the overlap
+CollisionResponse Collision::resolveExtents(const sf::FloatRect& bodyBounds, float platformX, float platformY, 
+                                            float overlapX, float overlapY) 
+{
+    CollisionResponse response;
     
     // Determine collision direction based on intersection size
     // If overlap is wider than it is tall, it's a vertical collision (intersection rectangle is wider than tall)
     // If overlap is taller than it is wide, it's a horizontal collision (intersection rectangle is taller than wide)
     
-    if (overlap.size.x < overlap.size.y) 
+    if (overlapX < overlapY) 
     {
         // Horizontal collision (left/right)
-        if (playerBounds.position.x < platformBounds.position.x) 
-        {
-            // Player hit from the left - push player left
-            player.setPosition(
-                sf::Vector2f
-                (
-                    playerPos.x - overlap.size.x,
-                    playerPos.y
-                )
-            );
+        if (bodyBounds.position.x < platformX) 
+        {
+            // Body hit from the left - push it left
+            response.push.x = -overlapX;
         } 
         else 
         {
-            // Player hit from the right - push player right
-            player.setPosition(
-                sf::Vector2f
-                (
-                    playerPos.x + overlap.size.x,
-                    playerPos.y
-                )
-            );
+            // Body hit from the right - push it right
+            response.push.x = overlapX;
         }
-        player.velocity.x = 0;
+        response.stopX = true;
     } 
     else 
     {
         // Vertical collision (top/bottom)
-        if (playerBounds.position.y < platformBounds.position.y) 
+        if (bodyBounds.position.y < platformY) 
         {
-            // Player landed on top of platform
+            // Body landed on top of platform
             // Leave a tiny overlap (0.1 pixels) so collision continues to detect ground next frame
             // This prevents onGround from flickering between true/false
-            player.setPosition(
-                sf::Vector2f
-                (
-                    playerPos.x,
-                    playerPos.y - overlap.size.y + 0.1f
-                )
-            );
-            player.velocity.y = 0;
-            player.onGround = true;
+            response.push.y = -overlapY + 0.1f;
+            response.landed = true;
         } 
         else 
         {
-            // Player hit platform from below
-            player.setPosition(
-                sf::Vector2f
-                (
-                    playerPos.x,
-                    playerPos.y + overlap.size.y
-                )
-            );
-            player.velocity.y = 0;
+            // Body hit platform from below
+            response.push.y = overlapY;
+        }
+        response.stopY = true;
+    }
+    
+    return response;
+}
+
+// Slab test of the body's corner against the platform grown by the body's size
+std::optional<SweepHit> Collision::sweep(const sf::FloatRect& bodyBounds, const sf::Vector2f& displacement, 
+                                         const sf::FloatRect& platformBounds) 
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+    float entry[2];
+    float exit[2];
+    
+    const float origin[2] = { bodyBounds.position.x, bodyBounds.position.y };
+    const float delta[2] = { displacement.x, displacement.y };
+    const float slabMin[2] = { platformBounds.position.x - bodyBounds.size.x, platformBounds.position.y - bodyBounds.size.y };
+    const float slabMax[2] = { platformBounds.position.x + platformBounds.size.x, platformBounds.position.y + platformBounds.size.y };
+    
+    for (int axis = 0; axis < 2; axis++) 
+    {
+        if (delta[axis] == 0.0f) 
+        {
+            // Not moving on this axis: must already be strictly inside the slab
+            if (origin[axis] <= slabMin[axis] || origin[axis] >= slabMax[axis]) 
+            {
+                return std::nullopt;
+            }
+            entry[axis] = -infinity;
+            exit[axis] = infinity;
+        }
+        else 
+        {
+            float t1 = (slabMin[axis] - origin[axis]) / delta[axis];
+            float t2 = (slabMax[axis] - origin[axis]) / delta[axis];
+            entry[axis] = std::min(t1, t2);
+            exit[axis] = std::max(t1, t2);
         }
     }
-}
\ No newline at end of file
+    
+    float entryTime = std::max(entry[0], entry[1]);
+    float exitTime = std::min(exit[0], exit[1]);
+    
+    // Miss, contact beyond this step, or already overlapping at the start
+    if (entryTime >= exitTime || entryTime > 1.0f || entryTime < 0.0f) 
+    {
+        return std::nullopt;
+    }
+    
+    SweepHit hit;
+    hit.time = entryTime;
+    if (entry[0] > entry[1]) 
+    {
+        hit.normal.x = displacement.x > 0.0f ? -1.0f : 1.0f;
+    }
+    else 
+    {
+        hit.normal.y = displacement.y > 0.0f ? -1.0f : 1.0f;
+    }
+    return hit;
+}
+
+// Everything a move (slides, skin and ground probe included) can touch
+sf::FloatRect Collision::sweptBounds(const sf::FloatRect& bodyBounds, const sf::Vector2f& displacement) 
+{
+    sf::Vector2f low(std::min(0.0f, displacement.x) - SKIN * 2.0f, std::min(0.0f, displacement.y) - SKIN * 2.0f);
+    sf::Vector2f grow(std::abs(displacement.x) + SKIN * 4.0f, std::abs(displacement.y) + SKIN * 4.0f);
+    return sf::FloatRect(bodyBounds.position + low, bodyBounds.size + grow);
+}
+
+// Candidates for a box, from the cache when it still covers the box
+void Collision::gatherCandidates(const sf::FloatRect& needed, const SpatialGrid& grid, ContactCache& cache, 
+                                 std::vector<std::size_t>& out, ContactStats& stats) 
+{
+    if (cache.covers(needed, grid.version)) 
+    {
+        out.assign(cache.candidates, cache.candidates + cache.candidateCount);
+        stats.queriesAvoided++;
+        return;
+    }
+    
+    sf::FloatRect region(needed.position - sf::Vector2f(ContactCache::MARGIN, ContactCache::MARGIN), 
+                         needed.size + sf::Vector2f(ContactCache::MARGIN * 2.0f, ContactCache::MARGIN * 2.0f));
+    grid.query(region, out);
+    stats.queries++;
+    
+    // Crowded spots are not worth caching; query them every time
+    if (out.size() > ContactCache::MAX_CANDIDATES) 
+    {
+        cache.gridVersion = 0;
+        return;
+    }
+    cache.region = region;
+    cache.candidateCount = static_cast<std::uint32_t>(out.size());
+    for (std::size_t i = 0; i < out.size(); i++) 
+    {
+        cache.candidates[i] = static_cast<std::uint32_t>(out[i]);
+    }
+    cache.gridVersion = grid.version;
+}
+
+// One query for the whole move, then slide
+CollisionResponse Collision::moveAndSlide(sf::FloatRect bodyBounds, sf::Vector2f displacement, 
+                                          const SpatialGrid& grid, std::vector<std::size_t>& candidates) 
+{
+    grid.query(sweptBounds(bodyBounds, displacement), candidates);
+    return slide(bodyBounds, displacement, grid, candidates, ContactCache::NO_PLATFORM);
+}
+
+// Same, with candidates and support served from a contact cache
+CollisionResponse Collision::moveAndSlide(sf::FloatRect bodyBounds, sf::Vector2f displacement, 
+                                          const SpatialGrid& grid, ContactCache& cache, 
+                                          std::vector<std::size_t>& scratch, ContactStats& stats) 
+{
+    gatherCandidates(sweptBounds(bodyBounds, displacement), grid, cache, scratch, stats);
+    std::uint32_t support = cache.gridVersion == grid.version ? cache.support : ContactCache::NO_PLATFORM;
+    
+    CollisionResponse response = slide(bodyBounds, displacement, grid, scratch, support);
+    cache.support = response.support;
+    return response;
+}
+
+// Sweep, stop at the first contact, slide along it, repeat
+CollisionResponse Collision::slide(sf::FloatRect bodyBounds, sf::Vector2f displacement, const SpatialGrid& grid, 
+                                   const std::vector<std::size_t>& candidates, std::uint32_t support) 
+{
+    CollisionResponse response;
+    bool rising = displacement.y < 0.0f;
+    
+    for (int slide = 0; slide < MAX_SLIDES; slide++) 
+    {
+        if (displacement.x == 0.0f && displacement.y == 0.0f) 
+        {
+            break;
+        }
+        
+        std::optional<SweepHit> first;
+        std::size_t firstIndex = 0;
+        for (std::size_t index : candidates) 
+        {
+            std::optional<SweepHit> hit = sweep(bodyBounds, displacement, grid.getBounds(index));
+            if (hit.has_value() && (!first.has_value() || hit->time < first->time)) 
+            {
+                first = hit;
+                firstIndex = index;
+            }
+        }
+        
+        if (!first.has_value()) 
+        {
+            bodyBounds.position += displacement;
+            response.push += displacement;
+            break;
+        }
+        
+        // Stop just short of the surface so the next sweep starts clear of it
+        sf::Vector2f move = displacement * first->time + first->normal * SKIN;
+        bodyBounds.position += move;
+        response.push += move;
+        
+        // Keep only the motion along the surface
+        sf::Vector2f remaining = displacement * (1.0f - first->time);
+        if (first->normal.x != 0.0f) 
+        {
+            remaining.x = 0.0f;
+            response.stopX = true;
+        }
+        else 
+        {
+            remaining.y = 0.0f;
+            response.stopY = true;
+            if (first->normal.y < 0.0f) 
+            {
+                response.landed = true;
+                response.support = static_cast<std::uint32_t>(firstIndex);
+            }
+        }
+        displacement = remaining;
+    }
+    
+    // A body resting SKIN above a floor does not move into it every tick
+    // (no gravity while grounded), so probe just below to keep onGround
+    // steady; the platform it stood on last tick is the likely answer
+    if (!response.landed && !rising) 
+    {
+        sf::Vector2f probe(0.0f, SKIN * 2.0f);
+        if (support != ContactCache::NO_PLATFORM && support < grid.size() && 
+            sweep(bodyBounds, probe, grid.getBounds(support)).has_value()) 
+        {
+            response.landed = true;
+            response.support = support;
+        }
+        for (std::size_t i = 0; i < candidates.size() && !response.landed; i++) 
+        {
+            if (sweep(bodyBounds, probe, grid.getBounds(candidates[i])).has_value()) 
+            {
+                response.landed = true;
+                response.support = static_cast<std::uint32_t>(candidates[i]);
+            }
+        }
+    }
+    
+    return response;
+}
+
+// Redo the player's integration step as a swept move
+void Collision::sweepPlayer(Player& player, const sf::Vector2f& start, const SpatialGrid& grid) 
+{
+    PROFILE_SCOPE("Collision::sweepPlayer");
+    sf::Vector2f displacement = player.getPosition() - start;
+    sf::FloatRect bounds = player.getGlobalBounds();
+    bounds.position -= displacement;
+    
+    CollisionResponse response = moveAndSlide(bounds, displacement, grid, playerContacts, candidates, stats);
+    swept = true;
+    player.setPosition(start + response.push);
+    if (response.stopX) 
+    {
+        player.velocity.x = 0;
+    }
+    if (response.stopY) 
+    {
+        player.velocity.y = 0;
+    }
+    if (response.landed) 
+    {
+        player.onGround = true;
+    }
+}
@@ -2,7 +2,46 @@
 #include <SFML/Graphics.hpp>
 #include "../Player/Player.h"
 #include "../Platform/Platform.h"
+#include "SpatialGrid.h"
+#include "ContactCache.h"
+#include "AabbKernel.h"
 #include <optional>
+#include <vector>
+
+/**
+ * @struct CollisionResponse
+ * @brief How a body must move to get out of a platform it overlaps
+ */
+struct CollisionResponse
+{
+    /** @brief Offset to add to the body's position */
+    sf::Vector2f push = sf::Vector2f(0.f, 0.f);
+    
+    /** @brief Horizontal velocity should be zeroed (side hit) */
+    bool stopX = false;
+    
+    /** @brief Vertical velocity should be zeroed (landed or bumped head) */
+    bool stopY = false;
+    
+    /** @brief Body is now standing on the platform */
+    bool landed = false;
+    
+    /** @brief Grid index of the floor under the body (swept moves only) */
+    std::uint32_t support = ContactCache::NO_PLATFORM;
+};
+
+/**
+ * @struct SweepHit
+ * @brief First contact of a box moving along a straight line
+ */
+struct SweepHit
+{
+    /** @brief Fraction of the displacement travelled before contact (0..1) */
+    float time = 1.0f;
+    
+    /** @brief Surface normal of the contact, one of (+-1, 0) or (0, +-1) */
+    sf::Vector2f normal = sf::Vector2f(0.f, 0.f);
+};
 
 /**
  * @class Collision
@@ -15,6 +54,10 @@
  *       - Horizontal collisions occur when overlap width < overlap height
  *       - Vertical collisions occur when overlap width >= overlap height
  * 
+ * @note Overlap resolution alone lets fast bodies skip through thin platforms
+ *       between ticks. sweepPlayer()/moveAndSlide() sweep the motion first
+ *       so that cannot happen at any tick rate.
+ * 
  * @example
  * @code
  * Collision collision;
@@ -22,6 +65,11 @@
  * if (intersection.has_value()) {
  *     collision.handleCollision(player, platform);
  * }
+ * 
+ * // Or, for a whole level, only test platforms near the player:
+ * SpatialGrid grid;
+ * grid.build(platforms);
+ * collision.handleCollisions(player, grid);
  * @endcode
  */
 class Collision 
@@ -53,4 +101,190 @@ public:
      *       prevent flickering of the onGround flag between frames
      */
     void handleCollision(Player& player, const Platform& platform);
+    
+    /**
+     * @brief Resolves collision between player and a platform's bounds
+     * 
+     * Same resolution as handleCollision(Player&, const Platform&), but takes
+     * precomputed bounds so callers with cached AABBs skip the shape query.
+     * 
+     * @param player         The player object to adjust
+     * @param platformBounds Global bounds of the platform
+     */
+    void handleCollision(Player& player, const sf::FloatRect& platformBounds);
+    
+    /**
+     * @brief Resolves collisions against every nearby platform in a grid
+     * 
+     * Queries the grid for candidates around the player's bounds and resolves
+     * them in platform index order, matching a linear loop over all platforms
+     * while only touching the cells the player overlaps.
+     * 
+     * @param player The player object to adjust
+     * @param grid   Broadphase built from the level's platforms
+     */
+    void handleCollisions(Player& player, const SpatialGrid& grid);
+    
+    /**
+     * @brief Resolves collisions against a set of platform boxes
+     * 
+     * Tests the player against all boxes at once with AabbKernel and
+     * resolves the hits in order, using the kernel's overlap extents. After
+     * a push the remaining boxes are retested from the new position, so the
+     * result equals calling handleCollision() on each box in turn.
+     * 
+     * @param player    The player object to adjust
+     * @param platforms Platform bounds as edge arrays
+     */
+    void handleCollisions(Player& player, const AabbArrays& platforms);
+    
+    /**
+     * @brief Computes the response for any body overlapping a platform
+     * 
+     * This is the resolution rule used by handleCollision(), exposed so other
+     * entity types (e.g. pooled enemies) resolve exactly like the player.
+     * 
+     * @param bodyBounds     Global bounds of the moving body
+     * @param platformBounds Global bounds of the platform
+     * @return Response to apply, or empty optional if the boxes do not overlap
+     */
+    static std::optional<CollisionResponse> resolveOverlap(const sf::FloatRect& bodyBounds, 
+                                                           const sf::FloatRect& platformBounds);
+    
+    /**
+     * @brief resolveOverlap() for a pair already known to overlap
+     * 
+     * @param bodyBounds Global bounds of the moving body
+     * @param platformX  Left edge of the platform
+     * @param platformY  Top edge of the platform
+     * @param overlapX   Width of the intersection (positive)
+     * @param overlapY   Height of the intersection (positive)
+     */
+    static CollisionResponse resolveExtents(const sf::FloatRect& bodyBounds, float platformX, float platformY, 
+                                            float overlapX, float overlapY);
+    
+    /**
+     * @brief Time of impact of a moving box against a static box
+     * 
+     * Ray-casts the body's corner against the platform grown by the body's
+     * size (slab test). Boxes that merely touch or already overlap at the
+     * start report no hit; resolveOverlap() handles those.
+     * 
+     * @param bodyBounds     Body at the start of the move
+     * @param displacement   Full movement for this step
+     * @param platformBounds Obstacle
+     * @return Contact time and normal, or empty optional if the path is clear
+     */
+    static std::optional<SweepHit> sweep(const sf::FloatRect& bodyBounds, const sf::Vector2f& displacement, 
+                                         const sf::FloatRect& platformBounds);
+    
+    /**
+     * @brief Moves a box through the level, sliding along whatever it hits
+     * 
+     * Finds the earliest contact along the path, stops just short of it,
+     * drops the blocked component and continues with the rest, up to
+     * MAX_SLIDES times. No speed or step length can tunnel through a
+     * platform, however thin. A body that is not rising also probes just
+     * below itself, so resting on a floor keeps reporting landed.
+     * 
+     * @param bodyBounds   Body at the start of the move
+     * @param displacement Full movement for this step (velocity * dt)
+     * @param grid         Broadphase built from the level's platforms
+     * @param candidates   Scratch list for grid queries
+     * @return push = actual movement; stopX/stopY = blocked axis; landed = hit a floor
+     */
+    static CollisionResponse moveAndSlide(sf::FloatRect bodyBounds, sf::Vector2f displacement, 
+                                          const SpatialGrid& grid, std::vector<std::size_t>& candidates);
+    
+    /**
+     * @brief moveAndSlide() that reuses the entity's contact cache
+     * 
+     * Skips the grid query while the move stays inside the cached region,
+     * and checks the remembered support first when probing for ground.
+     * 
+     * @param bodyBounds   Body at the start of the move
+     * @param displacement Full movement for this step (velocity * dt)
+     * @param grid         Broadphase built from the level's platforms
+     * @param cache        The entity's contact cache (updated)
+     * @param scratch      Scratch list for candidates
+     * @param stats        Incremented with queries run/avoided
+     */
+    static CollisionResponse moveAndSlide(sf::FloatRect bodyBounds, sf::Vector2f displacement, 
+                                          const SpatialGrid& grid, ContactCache& cache, 
+                                          std::vector<std::size_t>& scratch, ContactStats& stats);
+    
+    /**
+     * @brief Platforms that may touch a box, from the cache or a grid query
+     * 
+     * Queries the box grown by ContactCache::MARGIN on a miss and keeps the
+     * result in the cache when it is small enough.
+     * 
+     * @param needed Region that has to be tested
+     * @param grid   Broadphase built from the level's platforms
+     * @param cache  The entity's contact cache (updated on a miss)
+     * @param out    Receives the candidate indices, ascending
+     * @param stats  Incremented with queries run/avoided
+     */
+    static void gatherCandidates(const sf::FloatRect& needed, const SpatialGrid& grid, ContactCache& cache, 
+                                 std::vector<std::size_t>& out, ContactStats& stats);
+    
+    /**
+     * @brief Region a move can touch: start and end boxes plus the skin and probe
+     */
+    static sf::FloatRect sweptBounds(const sf::FloatRect& bodyBounds, const sf::Vector2f& displacement);
+    
+    /**
+     * @brief Replaces the player's last straight move with a swept one
+     * 
+     * Call right after Player::update(). The player is moved back to where
+     * it started, then swept along the same displacement with moveAndSlide().
+     * Velocity into a blocking surface is zeroed and landing sets onGround.
+     * 
+     * @param player   Player that has just been integrated
+     * @param start    Player position before Player::update()
+     * @param grid     Broadphase built from the level's platforms
+     */
+    void sweepPlayer(Player& player, const sf::Vector2f& start, const SpatialGrid& grid);
+    
+    /** @brief Slide iterations per moveAndSlide() call */
+    static constexpr int MAX_SLIDES = 4;
+    
+    /** @brief Gap left between a swept body and the surface it stopped at */
+    static constexpr float SKIN = 0.01f;
+    
+    /** @brief The player's contact cache (used by sweepPlayer and handleCollisions) */
+    ContactCache playerContacts;
+    
+    /**
+     * @brief Broadphase queries run/avoided for the player since construction
+     * 
+     * Every grid query counts. When sweepPlayer() ran first, a cache hit in
+     * handleCollisions() is the sweep's own lookup again and is not counted
+     * as avoided a second time.
+     */
+    ContactStats stats;
+    
+private:
+    /** @brief moveAndSlide() over a candidate list that covers sweptBounds() */
+    static CollisionResponse slide(sf::FloatRect bodyBounds, sf::Vector2f displacement, const SpatialGrid& grid, 
+                                   const std::vector<std::size_t>& candidates, std::uint32_t support);
+    
+    /** @brief Moves the player and updates velocity/onGround per a response */
+    static void applyResponse(Player& player, const CollisionResponse& response);
+    
+    /** @brief Scratch buffer for grid query results, reused every call */
+    std::vector<std::size_t> candidates;
+    
+    /** @brief Set by sweepPlayer(), cleared by handleCollisions(); see stats */
+    bool swept = false;
+    
+    /// @name AabbKernel Scratch
+    /// @{
+    
+    AabbArrays nearby;                   ///< Candidate bounds gathered from the grid
+    std::vector<std::uint32_t> hitMask;  ///< One bit per tested box
+    std::vector<float> overlapX;         ///< Intersection width per tested box
+    std::vector<float> overlapY;         ///< Intersection height per tested box
+    
+    /// @}
 };
\ No newline at end of file
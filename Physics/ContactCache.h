@@ -0,0 +1,117 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @struct ContactCache
+ * @brief Per-entity memory of the platforms around it and the one it stands on
+ * 
+ * After a broadphase query over the entity's bounds grown by MARGIN, the
+ * (few) platforms found are kept together with that grown region. While
+ * everything the entity needs to test stays inside the region, the cached
+ * list is complete and the grid is not queried again. An entity resting on
+ * a ledge or walking across it therefore queries the grid about once per
+ * MARGIN pixels travelled instead of several times per tick.
+ * 
+ * The supporting platform is remembered separately so the ground probe can
+ * revalidate it first, without scanning the other candidates.
+ * 
+ * Caches are tied to a SpatialGrid::version and go stale automatically when
+ * the grid is rebuilt.
+ */
+struct ContactCache
+{
+    /** @brief Most platforms a cache entry can hold; busier areas are not cached */
+    static constexpr std::size_t MAX_CANDIDATES = 4;
+    
+    /** @brief Padding added around the queried box, in pixels */
+    static constexpr float MARGIN = 32.0f;
+    
+    /** @brief support value when the entity is not standing on anything */
+    static constexpr std::uint32_t NO_PLATFORM = 0xFFFFFFFFu;
+    
+    /** @brief Region the candidate list is complete for */
+    sf::FloatRect region;
+    
+    /** @brief Grid indices of every platform touching region, ascending */
+    std::uint32_t candidates[MAX_CANDIDATES];
+    
+    /** @brief Number of valid entries in candidates */
+    std::uint32_t candidateCount = 0;
+    
+    /** @brief SpatialGrid::version the entry was filled from (0 = empty) */
+    std::uint32_t gridVersion = 0;
+    
+    /** @brief Platform the entity last stood on */
+    std::uint32_t support = NO_PLATFORM;
+    
+    /**
+     * @brief Whether the cached candidates are complete for a box
+     * 
+     * @param box     Region that has to be tested
+     * @param version Current SpatialGrid::version
+     */
+    bool covers(const sf::FloatRect& box, std::uint32_t version) const
+    {
+        return gridVersion == version && 
+               box.position.x >= region.position.x && 
+               box.position.y >= region.position.y && 
+               box.position.x + box.size.x <= region.position.x + region.size.x && 
+               box.position.y + box.size.y <= region.position.y + region.size.y;
+    }
+    
+    /**
+     * @brief Whether an entry read back from a saved state is safe to use
+     * 
+     * covers() and the collision code trust candidateCount and, while the
+     * entry is current, every candidate index. An entry of another version
+     * is never read, so only its count matters.
+     * 
+     * @param version       Current SpatialGrid::version
+     * @param platformCount Number of platforms in that grid
+     */
+    bool fits(std::uint32_t version, std::size_t platformCount) const
+    {
+        if (candidateCount > MAX_CANDIDATES) 
+        {
+            return false;
+        }
+        for (std::uint32_t i = 0; gridVersion == version && i < candidateCount; i++) 
+        {
+            if (candidates[i] >= platformCount) 
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    
+    /** @brief Forgets everything (e.g. after a teleport or respawn) */
+    void clear()
+    {
+        gridVersion = 0;
+        candidateCount = 0;
+        support = NO_PLATFORM;
+    }
+};
+
+/**
+ * @struct ContactStats
+ * @brief Broadphase work done versus skipped thanks to contact caches
+ */
+struct ContactStats
+{
+    /** @brief Grid queries that actually ran */
+    std::size_t queries = 0;
+    
+    /** @brief Grid queries answered from a ContactCache */
+    std::size_t queriesAvoided = 0;
+    
+    ContactStats& operator+=(const ContactStats& other)
+    {
+        queries += other.queries;
+        queriesAvoided += other.queriesAvoided;
+        return *this;
+    }
+};
@@ -0,0 +1,209 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : cellSize(cellSize),
+    origin(0.f, 0.f),
+    columns(0),
+    rows(0),
+    baseCellSize(cellSize)
+{
+}
+
+void SpatialGrid::build(const std::vector<Platform>& platforms)
+{
+    // Cache bounds once instead of asking the shape every frame
+    bounds.clear();
+    bounds.reserve(platforms.size());
+    for (const auto& platform : platforms) 
+    {
+        bounds.push_back(platform.shape.getGlobalBounds());
+    }
+    buildCells();
+}
+
+void SpatialGrid::build(const float* x, const float* y, const float* width, const float* height, std::size_t count)
+{
+    bounds.resize(count);
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        bounds[i] = sf::FloatRect(sf::Vector2f(x[i], y[i]), sf::Vector2f(width[i], height[i]));
+    }
+    buildCells();
+}
+
+void SpatialGrid::build(const AabbArrays& boxes)
+{
+    bounds.resize(boxes.size());
+    for (std::size_t i = 0; i < boxes.size(); i++) 
+    {
+        bounds[i] = sf::FloatRect(sf::Vector2f(boxes.minX[i], boxes.minY[i]), 
+                                  sf::Vector2f(boxes.maxX[i] - boxes.minX[i], boxes.maxY[i] - boxes.minY[i]));
+    }
+    buildCells();
+}
+
+void SpatialGrid::build(const sf::FloatRect* rects, std::size_t count)
+{
+    bounds.assign(rects, rects + count);
+    buildCells();
+}
+
+void SpatialGrid::buildCells()
+{
+    version++;
+    arrays.assign(bounds.data(), bounds.size());
+    std::size_t count = bounds.size();
+    cellStart.clear();
+    cellItems.clear();
+    columns = 0;
+    rows = 0;
+    
+    if (count == 0) 
+    {
+        return;
+    }
+    
+    // Grid covers the union of all bounds
+    sf::Vector2f minCorner = bounds[0].position;
+    sf::Vector2f maxCorner = bounds[0].position + bounds[0].size;
+    for (const auto& rect : bounds) 
+    {
+        minCorner.x = std::min(minCorner.x, rect.position.x);
+        minCorner.y = std::min(minCorner.y, rect.position.y);
+        maxCorner.x = std::max(maxCorner.x, rect.position.x + rect.size.x);
+        maxCorner.y = std::max(maxCorner.y, rect.position.y + rect.size.y);
+    }
+    origin = minCorner;
+    
+    // Grow cells until the table fits in the cell budget, starting over
+    // from the requested size so one far-flung build does not leave every
+    // later grid coarse
+    sf::Vector2f extent = maxCorner - minCorner;
+    cellSize = baseCellSize;
+    for (;;) 
+    {
+        columns = std::max(1, static_cast<int>(std::ceil(extent.x / cellSize)));
+        rows = std::max(1, static_cast<int>(std::ceil(extent.y / cellSize)));
+        if (static_cast<std::size_t>(columns) * rows <= MAX_CELLS) 
+        {
+            break;
+        }
+        cellSize *= 2.0f;
+    }
+    
+    std::size_t cellCount = static_cast<std::size_t>(columns) * rows;
+    cellStart.assign(cellCount + 1, 0);
+    
+    // First pass: count entries per cell
+    for (const auto& rect : bounds) 
+    {
+        int x0 = columnOf(rect.position.x);
+        int x1 = columnOf(rect.position.x + rect.size.x);
+        int y0 = rowOf(rect.position.y);
+        int y1 = rowOf(rect.position.y + rect.size.y);
+        for (int y = y0; y <= y1; y++) 
+        {
+            for (int x = x0; x <= x1; x++) 
+            {
+                cellStart[static_cast<std::size_t>(y) * columns + x + 1]++;
+            }
+        }
+    }
+    
+    // Prefix sum turns counts into offsets
+    for (std::size_t i = 1; i <= cellCount; i++) 
+    {
+        cellStart[i] += cellStart[i - 1];
+    }
+    
+    // Second pass: scatter item indices (ascending per cell)
+    cellItems.resize(cellStart[cellCount]);
+    cellCursor.assign(cellStart.begin(), cellStart.end() - 1);
+    for (std::size_t i = 0; i < bounds.size(); i++) 
+    {
+        const sf::FloatRect& rect = bounds[i];
+        int x0 = columnOf(rect.position.x);
+        int x1 = columnOf(rect.position.x + rect.size.x);
+        int y0 = rowOf(rect.position.y);
+        int y1 = rowOf(rect.position.y + rect.size.y);
+        for (int y = y0; y <= y1; y++) 
+        {
+            for (int x = x0; x <= x1; x++) 
+            {
+                cellItems[cellCursor[static_cast<std::size_t>(y) * columns + x]++] = static_cast<unsigned int>(i);
+            }
+        }
+    }
+}
+
+const AabbArrays& SpatialGrid::getArrays() const
+{
+    return arrays;
+}
+
+void SpatialGrid::query(const sf::FloatRect& area, std::vector<std::size_t>& out) const
+{
+    out.clear();
+    if (columns == 0) 
+    {
+        return;
+    }
+    
+    int x0 = columnOf(area.position.x);
+    int x1 = columnOf(area.position.x + area.size.x);
+    int y0 = rowOf(area.position.y);
+    int y1 = rowOf(area.position.y + area.size.y);
+    
+    for (int y = y0; y <= y1; y++) 
+    {
+        for (int x = x0; x <= x1; x++) 
+        {
+            std::size_t cell = static_cast<std::size_t>(y) * columns + x;
+            for (unsigned int i = cellStart[cell]; i < cellStart[cell + 1]; i++) 
+            {
+                unsigned int item = cellItems[i];
+                const sf::FloatRect& rect = bounds[item];
+                
+                // An item spanning several visited cells is only reported from
+                // the first one, so no visited set is needed to deduplicate
+                int itemX = std::max(columnOf(rect.position.x), x0);
+                int itemY = std::max(rowOf(rect.position.y), y0);
+                if (itemX == x && itemY == y) 
+                {
+                    out.push_back(item);
+                }
+            }
+        }
+    }
+    
+    // Callers resolve in index order, like the old linear loop did
+    if (y1 > y0 || x1 > x0) 
+    {
+        std::sort(out.begin(), out.end());
+    }
+}
+
+const sf::FloatRect& SpatialGrid::getBounds(std::size_t index) const
+{
+    return bounds[index];
+}
+
+std::size_t SpatialGrid::size() const
+{
+    return bounds.size();
+}
+
+int SpatialGrid::columnOf(float x) const
+{
+    // Clamp in float space so far-away coordinates cannot overflow the cast
+    float column = std::floor((x - origin.x) / cellSize);
+    return static_cast<int>(std::clamp(column, 0.0f, static_cast<float>(columns - 1)));
+}
+
+int SpatialGrid::rowOf(float y) const
+{
+    float row = std::floor((y - origin.y) / cellSize);
+    return static_cast<int>(std::clamp(row, 0.0f, static_cast<float>(rows - 1)));
+}
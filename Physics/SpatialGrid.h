@@ -0,0 +1,161 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Platform/Platform.h"
+#include "AabbKernel.h"
+
+/**
+ * @class SpatialGrid
+ * @brief Static uniform-grid broadphase over platform bounds
+ * 
+ * Built once from the platform set, the grid caches every platform's
+ * axis-aligned bounds and buckets their indices into fixed-size cells.
+ * A query only visits the cells covered by the search rectangle, so the
+ * cost of finding collision candidates depends on local density rather
+ * than on the total number of platforms in the level.
+ * 
+ * @note Cells are stored in a compressed layout (one offset table plus one
+ *       flat index array) so building and querying never allocate per cell.
+ * @note query() keeps no mutable state and is safe to call from several
+ *       threads at once.
+ * 
+ * @example
+ * @code
+ * SpatialGrid grid;
+ * grid.build(platforms);
+ * 
+ * std::vector<std::size_t> candidates;
+ * grid.query(player.getGlobalBounds(), candidates);
+ * @endcode
+ */
+class SpatialGrid
+{
+public:
+    /**
+     * @brief Constructs an empty grid
+     * 
+     * @param cellSize Edge length of a grid cell in pixels (default: 128)
+     */
+    explicit SpatialGrid(float cellSize = 128.0f);
+    
+    /**
+     * @brief Rebuilds the grid from a list of platforms
+     * 
+     * @param platforms Platforms to index; indices in query results refer
+     *                  to positions in this vector
+     */
+    void build(const std::vector<Platform>& platforms);
+    
+    /**
+     * @brief Rebuilds the grid from raw bounding rectangles
+     * 
+     * @param rects Pointer to the first rectangle
+     * @param count Number of rectangles
+     */
+    void build(const sf::FloatRect* rects, std::size_t count);
+    
+    /**
+     * @brief Rebuilds the grid from structure-of-arrays bounds
+     * 
+     * Reads the arrays in place (e.g. straight out of a mapped LevelFile).
+     * 
+     * @param x      Top-left X of each item
+     * @param y      Top-left Y of each item
+     * @param width  Width of each item
+     * @param height Height of each item
+     * @param count  Number of items
+     */
+    void build(const float* x, const float* y, const float* width, const float* height, std::size_t count);
+    
+    /**
+     * @brief Rebuilds the grid from edge arrays, e.g. a tick's entity bounds
+     * 
+     * @param boxes Boxes to index; indices in query results refer to them
+     */
+    void build(const AabbArrays& boxes);
+    
+    /**
+     * @brief Collects indices of all items whose cells overlap an area
+     * 
+     * Results are appended in ascending index order and contain no duplicates.
+     * Candidates are only guaranteed to share a cell with the area; callers
+     * still run the narrow-phase test.
+     * 
+     * @param area Search rectangle in world coordinates
+     * @param out  Vector that receives candidate indices (cleared first)
+     */
+    void query(const sf::FloatRect& area, std::vector<std::size_t>& out) const;
+    
+    /**
+     * @brief Gets the cached bounds of an indexed item
+     * 
+     * @param index Item index as returned by query()
+     * @return Bounding rectangle captured at build time
+     */
+    const sf::FloatRect& getBounds(std::size_t index) const;
+    
+    /**
+     * @brief Gets the cached bounds of every item as SoA edge arrays
+     * 
+     * Same boxes as getBounds(), in the layout AabbKernel reads.
+     */
+    const AabbArrays& getArrays() const;
+    
+    /**
+     * @brief Gets the number of indexed items
+     */
+    std::size_t size() const;
+    
+    /// @name Grid Layout
+    /// @{
+    
+    /** @brief Edge length of a cell in pixels (the constructor's, or larger if the last build needed it) */
+    float cellSize;
+    
+    /** @brief World position of the grid's top-left corner */
+    sf::Vector2f origin;
+    
+    /** @brief Number of cell columns */
+    int columns;
+    
+    /** @brief Number of cell rows */
+    int rows;
+    
+    /** @brief Bumped by every build(); caches of item indices compare against it */
+    std::uint32_t version = 0;
+    
+    /// @}
+    
+    /** @brief Upper bound on total cells; cellSize grows to stay under it */
+    static constexpr std::size_t MAX_CELLS = 1u << 22;
+    
+private:
+    /** @brief Cell size passed to the constructor; every build starts from it */
+    float baseCellSize;
+    
+    /** @brief Cached bounds, one per indexed item */
+    std::vector<sf::FloatRect> bounds;
+    
+    /** @brief bounds as edge arrays, for AabbKernel */
+    AabbArrays arrays;
+    
+    /** @brief Offset of each cell's first entry in cellItems (size cells + 1) */
+    std::vector<unsigned int> cellStart;
+    
+    /** @brief Item indices for all cells, grouped by cell */
+    std::vector<unsigned int> cellItems;
+    
+    /** @brief Scatter position per cell, kept so grids rebuilt every tick do not reallocate it */
+    std::vector<unsigned int> cellCursor;
+    
+    /** @brief Buckets the cached bounds into cells */
+    void buildCells();
+    
+    /** @brief Converts a world X coordinate to a clamped column index */
+    int columnOf(float x) const;
+    
+    /** @brief Converts a world Y coordinate to a clamped row index */
+    int rowOf(float y) const;
+};
@@ -0,0 +1,96 @@
+#include "SweepAndPrune.h"
+#include <algorithm>
+
+void SweepAndPrune::update(const AabbArrays& boxes)
+{
+    const std::uint32_t count = static_cast<std::uint32_t>(boxes.size());
+    const bool fresh = order.empty();
+    
+    // Drop entities that no longer exist and append new ones at the end;
+    // the insertion sort below moves the newcomers into place
+    if (order.size() > count) 
+    {
+        order.erase(std::remove_if(order.begin(), order.end(),
+                                   [count](std::uint32_t id) { return id >= count; }), order.end());
+    }
+    for (std::uint32_t id = static_cast<std::uint32_t>(order.size()); id < count; id++) 
+    {
+        order.push_back(id);
+    }
+    
+    // Nothing to be coherent with yet: a full sort beats insertion sort here
+    if (fresh) 
+    {
+        std::sort(order.begin(), order.end(), [&boxes](std::uint32_t a, std::uint32_t b) 
+        {
+            return boxes.minX[a] < boxes.minX[b];
+        });
+    }
+    
+    // Insertion sort on last frame's order: cheap when little has moved
+    sortedMinX.resize(count);
+    for (std::uint32_t i = 0; i < count; i++) 
+    {
+        sortedMinX[i] = boxes.minX[order[i]];
+    }
+    swaps = 0;
+    for (std::uint32_t i = 1; i < count; i++) 
+    {
+        float key = sortedMinX[i];
+        std::uint32_t id = order[i];
+        std::uint32_t j = i;
+        while (j > 0 && sortedMinX[j - 1] > key) 
+        {
+            sortedMinX[j] = sortedMinX[j - 1];
+            order[j] = order[j - 1];
+            j--;
+        }
+        swaps += i - j;
+        sortedMinX[j] = key;
+        order[j] = id;
+    }
+    
+    // Gather the other edges once so the sweep reads them sequentially
+    sortedMaxX.resize(count);
+    sortedMinY.resize(count);
+    sortedMaxY.resize(count);
+    for (std::uint32_t i = 0; i < count; i++) 
+    {
+        sortedMaxX[i] = boxes.maxX[order[i]];
+        sortedMinY[i] = boxes.minY[order[i]];
+        sortedMaxY[i] = boxes.maxY[order[i]];
+    }
+    
+    // Everything after i that starts before i ends overlaps it on X
+    pairs.clear();
+    tests = 0;
+    for (std::uint32_t i = 0; i < count; i++) 
+    {
+        const float right = sortedMaxX[i];
+        const float top = sortedMinY[i];
+        const float bottom = sortedMaxY[i];
+        for (std::uint32_t j = i + 1; j < count && sortedMinX[j] < right; j++) 
+        {
+            tests++;
+            if (sortedMinY[j] < bottom && top < sortedMaxY[j] && sortedMinX[i] < sortedMaxX[j]) 
+            {
+                std::uint32_t a = order[i];
+                std::uint32_t b = order[j];
+                pairs.push_back(a < b ? EntityPair{ a, b } : EntityPair{ b, a });
+            }
+        }
+    }
+}
+
+const std::vector<EntityPair>& SweepAndPrune::getPairs() const
+{
+    return pairs;
+}
+
+void SweepAndPrune::clear()
+{
+    order.clear();
+    pairs.clear();
+    swaps = 0;
+    tests = 0;
+}
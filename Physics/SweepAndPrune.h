@@ -0,0 +1,101 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "AabbKernel.h"
+
+/**
+ * @struct EntityPair
+ * @brief Two boxes that overlap, by index into the array passed to update()
+ */
+struct EntityPair
+{
+    std::uint32_t first;   ///< Lower index
+    std::uint32_t second;  ///< Higher index
+};
+
+/**
+ * @class SweepAndPrune
+ * @brief Broadphase for moving boxes (player vs enemies, enemies vs enemies)
+ * 
+ * Keeps the boxes sorted by their left edge. Each update() starts from last
+ * frame's order and repairs it with an insertion sort: entities only move a
+ * few pixels per tick, so almost nothing changes place and the sort costs
+ * O(n + swaps) instead of O(n log n). A sweep over the sorted list then only
+ * compares boxes whose X ranges overlap, and checks Y for those.
+ * 
+ * Indices may be reused for different entities between updates (e.g. after
+ * an EnemyPool despawn moves the last enemy into the hole); the sort simply
+ * moves the changed entry to its new place.
+ * 
+ * @note Only X is swept. Levels are wide rather than tall, so X separates
+ *       entities best; a crowd stacked in one column degrades towards
+ *       testing every pair in it.
+ * 
+ * @example
+ * @code
+ * SweepAndPrune broadphase;
+ * 
+ * // Every tick:
+ * bounds.clear();
+ * bounds.push(player.getGlobalBounds());
+ * for (std::size_t i = 0; i < enemies.size(); i++)
+ * {
+ *     bounds.push(enemies.getBounds(i));
+ * }
+ * broadphase.update(bounds);
+ * for (const EntityPair& pair : broadphase.getPairs()) { ... }
+ * @endcode
+ */
+class SweepAndPrune
+{
+public:
+    /**
+     * @brief Re-sorts the boxes and collects every overlapping pair
+     * 
+     * Boxes overlap when their intersection has positive width and height
+     * (the same rule as sf::FloatRect::findIntersection).
+     * 
+     * @param boxes Current bounds; index i is entity i
+     */
+    void update(const AabbArrays& boxes);
+    
+    /**
+     * @brief Overlapping pairs found by the last update()
+     * 
+     * Pairs are listed in sweep order, each with first < second.
+     */
+    const std::vector<EntityPair>& getPairs() const;
+    
+    /** @brief Forgets the sort order (the next update() does a full sort) */
+    void clear();
+    
+    /// @name Statistics (last update)
+    /// @{
+    
+    /** @brief Entries moved by the insertion sort */
+    std::size_t swaps = 0;
+    
+    /** @brief Box pairs whose X ranges overlapped and were tested on Y */
+    std::size_t tests = 0;
+    
+    /// @}
+    
+private:
+    /** @brief Entity indices sorted by left edge */
+    std::vector<std::uint32_t> order;
+    
+    /// @name Bounds In Sorted Order
+    /// @{
+    
+    std::vector<float> sortedMinX;
+    std::vector<float> sortedMaxX;
+    std::vector<float> sortedMinY;
+    std::vector<float> sortedMaxY;
+    
+    /// @}
+    
+    /** @brief Result of the last update() */
+    std::vector<EntityPair> pairs;
+};
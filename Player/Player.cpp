@@ -2,6 +2,25 @@
 #include <iostream>
 #include <cmath>
 
+namespace
+{
+    // Sheet, frame count and speed of each animation, in PlayerState order
+    struct AnimationSheet
+    {
+        const char* file;
+        unsigned int frameCount;
+        float fps;
+    };
+    
+    const AnimationSheet SHEETS[4] = 
+    {
+        { "IDLE.png", 6, 8.0f },
+        { "WALK.png", 6, 12.0f },
+        { "RUN.png", 6, 15.0f },
+        { "JUMP.png", 5, 10.0f },
+    };
+}
+
 Player::Player(float x, float y) 
     : 
     position(x, y),
@@ -19,10 +38,11 @@ bool Player::loadAllAnimations(const std::string& basePath)
     this->frameSize.y = frameSizeY;
     
     // Load all animations
-    success &= loadAnimation(idleAnimation, basePath + "IDLE.png", this->frameSize, 6, 8.0f);
-    success &= loadAnimation(walkAnimation, basePath + "WALK.png", this->frameSize, 6, 12.0f);
-    success &= loadAnimation(runAnimation, basePath + "RUN.png", this->frameSize, 6, 15.0f);
-    success &= loadAnimation(jumpAnimation, basePath + "JUMP.png", this->frameSize, 5, 10.0f);
+    Animation* animations[4] = { &idleAnimation, &walkAnimation, &runAnimation, &jumpAnimation };
+    for (std::size_t i = 0; i < 4; i++) 
+    {
+        success &= loadAnimation(*animations[i], basePath + SHEETS[i].file, this->frameSize, SHEETS[i].frameCount, SHEETS[i].fps);
+    }
     
     
 
@@ -36,6 +56,35 @@ bool Player::loadAllAnimations(const std::string& basePath)
     return success;
 }
 
+bool Player::bindAnimations(ClipResidency& residency, const std::string& basePath)
+{
+    frameSize = sf::Vector2u(frameSizeX, frameSizeY);
+    
+    Animation* animations[4] = { &idleAnimation, &walkAnimation, &runAnimation, &jumpAnimation };
+    for (std::size_t i = 0; i < 4; i++) 
+    {
+        std::string path = basePath + SHEETS[i].file;
+        animations[i]->bindLazy(residency, residency.declareSheet(path, path, frameSize, SHEETS[i].frameCount, SHEETS[i].fps));
+        animations[i]->setOrigin(sf::Vector2f(frameSize.x / 2.0f, frameSize.y / 2.0f));
+        animations[i]->setPosition(position);
+    }
+    
+    currentAnimation = &idleAnimation;
+    currentState = PlayerState::IDLE;
+    idleAnimation.play();
+    return idleAnimation.clip != nullptr;
+}
+
+std::vector<std::string> Player::getAnimationPaths(const std::string& basePath)
+{
+    std::vector<std::string> paths;
+    for (const AnimationSheet& sheet : SHEETS) 
+    {
+        paths.push_back(basePath + sheet.file);
+    }
+    return paths;
+}
+
 bool Player::loadAnimation(Animation& animation, const std::string& filePath, 
                            const sf::Vector2u& frameSize, 
                            unsigned int frameCount, 
@@ -149,6 +198,12 @@ void Player::setAnimation(PlayerState newState)
     
     currentState = newState;
     
+    // A lazily loaded clip may be evicted while it is not showing
+    if (currentAnimation) 
+    {
+        currentAnimation->release();
+    }
+    
     // switch to new animation
     switch (newState) 
     {
@@ -177,11 +232,32 @@ void Player::setAnimation(PlayerState newState)
     }
 }
 
+void Player::setPose(PlayerState state, unsigned int frame, bool facing, const sf::Vector2f& pos)
+{
+    setAnimation(state);
+    
+    if (facing != facingRight) 
+    {
+        facingRight = facing;
+        sf::Vector2f scale = facingRight ? sf::Vector2f(1.0f, 1.0f) : sf::Vector2f(-1.0f, 1.0f);
+        idleAnimation.setScale(scale);
+        walkAnimation.setScale(scale);
+        runAnimation.setScale(scale);
+        jumpAnimation.setScale(scale);
+    }
+    
+    if (currentAnimation) 
+    {
+        currentAnimation->setFrame(frame);
+    }
+    setPosition(pos);
+}
+
 void Player::jump() 
 {
     if (onGround) 
     {
-        velocity.y = -470.0f;
+        velocity.y = -JUMP_SPEED;
         onGround = false;
     }
 }
@@ -220,4 +296,12 @@ const sf::Sprite& Player::getSprite() const
     }
     // fallback to idle if somehow currentAnimation is null
     return idleAnimation.getSprite();
+}
+
+void Player::draw(SpriteBatch& batch, int layer) const
+{
+    if (currentAnimation) 
+    {
+        currentAnimation->emit(batch, layer);
+    }
 }
\ No newline at end of file
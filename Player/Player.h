@@ -1,6 +1,7 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <vector>
 #include "../Animation/Animation.h"
 
 /**
@@ -109,13 +110,16 @@ public:
     /// @{
     
     /** @brief Walking speed in pixels per second */
-    const float WALK_SPEED = 200.0f;
+    static constexpr float WALK_SPEED = 200.0f;
     
     /** @brief Running speed in pixels per second */
-    const float RUN_SPEED = 350.0f;
+    static constexpr float RUN_SPEED = 350.0f;
     
     /** @brief Gravity acceleration in pixels per second squared */
-    const float GRAVITY = 980.0f;
+    static constexpr float GRAVITY = 980.0f;
+    
+    /** @brief Upward speed given by jump() in pixels per second */
+    static constexpr float JUMP_SPEED = 470.0f;
     
     /// @}
     
@@ -134,6 +138,30 @@ public:
      */
     bool loadAllAnimations(const std::string& basePath = "assets/with_outline/");
     
+    /**
+     * @brief Binds the animations to lazily loaded clips in a residency
+     * 
+     * Declares the same sheets loadAllAnimations() reads, but a sheet is
+     * only loaded when its animation first plays. The animation being left
+     * on a state change releases its clip, so the residency may evict it.
+     * 
+     * @param residency Residency to declare the clips in (must outlive the player's use of it)
+     * @param basePath  Same base directory passed to loadAllAnimations()
+     * @return true if the idle animation, which starts playing, loaded
+     */
+    bool bindAnimations(ClipResidency& residency, const std::string& basePath = "assets/with_outline/");
+    
+    /**
+     * @brief Lists the sprite sheets loadAllAnimations() reads
+     * 
+     * Lets a loader (e.g. AssetLoader) prefetch them in the background so
+     * loadAllAnimations() is served from the texture cache.
+     * 
+     * @param basePath Same base directory passed to loadAllAnimations()
+     * @return Paths of the IDLE, WALK, RUN and JUMP sheets
+     */
+    static std::vector<std::string> getAnimationPaths(const std::string& basePath = "assets/with_outline/");
+    
     /**
      * @brief Loads a single animation with custom parameters
      * 
@@ -207,6 +235,16 @@ public:
      */
     const sf::Sprite& getSprite() const;
     
+    /**
+     * @brief Queues the current animation frame into a sprite batch
+     * 
+     * Batched alternative to drawing getSprite() directly.
+     * 
+     * @param batch Batch to append to
+     * @param layer Draw layer passed to SpriteBatch::draw
+     */
+    void draw(SpriteBatch& batch, int layer = 0) const;
+    
     /**
      * @brief Updates the animation state based on player movement
      * 
@@ -230,6 +268,19 @@ public:
      */
     void updateAnimation(float deltaTime);
     
+    /**
+     * @brief Shows a given animation frame without simulating anything
+     * 
+     * Used by the render thread to pose its own copy of the player from a
+     * simulation snapshot.
+     * 
+     * @param state       Animation to show
+     * @param frame       Frame index within that animation
+     * @param facingRight Direction the sprite faces
+     * @param pos         Position (center point)
+     */
+    void setPose(PlayerState state, unsigned int frame, bool facingRight, const sf::Vector2f& pos);
+    
 private:
     /**
      * @brief Switches to a specific animation state
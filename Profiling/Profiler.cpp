@@ -0,0 +1,197 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    const std::chrono::steady_clock::time_point EPOCH = std::chrono::steady_clock::now();
+}
+
+Profiler& Profiler::global()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+std::int64_t Profiler::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - EPOCH).count();
+}
+
+Profiler::ThreadBuffer& Profiler::localBuffer()
+{
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) 
+    {
+        auto created = std::make_unique<ThreadBuffer>();
+        created->events.resize(RING_CAPACITY);
+        
+        std::lock_guard<std::mutex> lock(mutex);
+        created->threadIndex = static_cast<std::uint32_t>(buffers.size());
+        buffer = created.get();
+        buffers.push_back(std::move(created));
+    }
+    return *buffer;
+}
+
+void Profiler::record(const char* name, std::int64_t startNs, std::int64_t endNs)
+{
+    ThreadBuffer& buffer = localBuffer();
+    
+    // Single writer: plain slot write, then publish the new count
+    std::uint64_t index = buffer.written.load(std::memory_order_relaxed);
+    buffer.events[index % RING_CAPACITY] = ProfileEvent{ name, startNs, endNs - startNs };
+    buffer.written.store(index + 1, std::memory_order_release);
+    
+    // Per-frame totals; phases are few, so a linear scan beats hashing
+    std::lock_guard<std::mutex> lock(buffer.totalsMutex);
+    for (auto& total : buffer.frameTotals) 
+    {
+        if (total.first == name) 
+        {
+            total.second += endNs - startNs;
+            return;
+        }
+    }
+    buffer.frameTotals.emplace_back(name, endNs - startNs);
+}
+
+void Profiler::endFrame()
+{
+    std::int64_t frameEnd = now();
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    if (lastFrameEnd >= 0) 
+    {
+        frameWindow.push(frameEnd - lastFrameEnd);
+    }
+    lastFrameEnd = frameEnd;
+    
+    // Add up what every thread timed since the last call, the simulation
+    // thread and job workers included
+    mergedTotals.clear();
+    for (const auto& buffer : buffers) 
+    {
+        std::lock_guard<std::mutex> totalsLock(buffer->totalsMutex);
+        for (const auto& entry : buffer->frameTotals) 
+        {
+            auto merged = std::find_if(mergedTotals.begin(), mergedTotals.end(), 
+                                       [&entry](const auto& total) { return total.first == entry.first; });
+            if (merged != mergedTotals.end()) 
+            {
+                merged->second += entry.second;
+            }
+            else 
+            {
+                mergedTotals.push_back(entry);
+            }
+        }
+        buffer->frameTotals.clear();
+    }
+    
+    // Phases that did not run this frame count as zero
+    for (Window& window : phaseWindows) 
+    {
+        std::int64_t total = 0;
+        for (auto& entry : mergedTotals) 
+        {
+            if (entry.first == window.name) 
+            {
+                total = entry.second;
+                entry.first = nullptr; // Consumed
+            }
+        }
+        window.push(total);
+    }
+    
+    // First sighting of a phase opens a new window
+    for (const auto& entry : mergedTotals) 
+    {
+        if (entry.first) 
+        {
+            phaseWindows.emplace_back();
+            phaseWindows.back().name = entry.first;
+            phaseWindows.back().push(entry.second);
+        }
+    }
+}
+
+PhaseStats Profiler::getFrameStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    PhaseStats stats = frameWindow.stats();
+    stats.name = "frame";
+    return stats;
+}
+
+std::vector<PhaseStats> Profiler::getPhaseStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<PhaseStats> stats;
+    stats.reserve(phaseWindows.size());
+    for (const Window& window : phaseWindows) 
+    {
+        stats.push_back(window.stats());
+    }
+    return stats;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) 
+    {
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (const auto& buffer : buffers) 
+    {
+        // Oldest surviving event to newest
+        std::uint64_t written = buffer->written.load(std::memory_order_acquire);
+        std::uint64_t begin = written > RING_CAPACITY ? written - RING_CAPACITY : 0;
+        for (std::uint64_t i = begin; i < written; i++) 
+        {
+            const ProfileEvent& event = buffer->events[i % RING_CAPACITY];
+            out << (first ? "" : ",\n") 
+                << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->threadIndex 
+                << ",\"ts\":" << event.startNs / 1000.0 << ",\"dur\":" << event.durationNs / 1000.0 << "}";
+            first = false;
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    return static_cast<bool>(out);
+}
+
+void Profiler::Window::push(std::int64_t sample)
+{
+    if (samples.size() < WINDOW_FRAMES) 
+    {
+        samples.push_back(sample);
+        return;
+    }
+    samples[next] = sample;
+    next = (next + 1) % WINDOW_FRAMES;
+}
+
+PhaseStats Profiler::Window::stats() const
+{
+    PhaseStats result;
+    result.name = name;
+    if (samples.empty()) 
+    {
+        return result;
+    }
+    
+    std::vector<std::int64_t> sorted(samples);
+    std::size_t p50 = sorted.size() / 2;
+    std::size_t p99 = std::min(sorted.size() - 1, sorted.size() * 99 / 100);
+    std::nth_element(sorted.begin(), sorted.begin() + p50, sorted.end());
+    result.p50Ms = sorted[p50] / 1e6f;
+    std::nth_element(sorted.begin(), sorted.begin() + p99, sorted.end());
+    result.p99Ms = sorted[p99] / 1e6f;
+    return result;
+}
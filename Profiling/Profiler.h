@@ -0,0 +1,198 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @def PROFILE_SCOPE(name)
+ * @brief Times the enclosing scope under a string-literal name
+ * 
+ * Compiles to nothing when GAME_DISABLE_PROFILING is defined, so shipping
+ * builds pay zero cost for the instrumentation.
+ */
+#ifdef GAME_DISABLE_PROFILING
+    #define PROFILE_SCOPE(name) ((void)0)
+#else
+    #define PROFILE_CONCAT_INNER(a, b) a##b
+    #define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+    #define PROFILE_SCOPE(name) ScopedTimer PROFILE_CONCAT(profileScope_, __LINE__)(name)
+#endif
+
+/**
+ * @struct ProfileEvent
+ * @brief One completed timed scope
+ */
+struct ProfileEvent
+{
+    const char* name;        ///< String literal passed to PROFILE_SCOPE
+    std::int64_t startNs;    ///< Start time relative to the profiler epoch
+    std::int64_t durationNs; ///< Length of the scope
+};
+
+/**
+ * @struct PhaseStats
+ * @brief Rolling per-frame totals for one named phase
+ */
+struct PhaseStats
+{
+    const char* name = nullptr;
+    float p50Ms = 0.0f;   ///< Median over the rolling window
+    float p99Ms = 0.0f;   ///< 99th percentile over the rolling window
+};
+
+/**
+ * @class Profiler
+ * @brief Low-overhead scoped-timer instrumentation with per-thread ring buffers
+ * 
+ * Each thread writes completed scopes into its own fixed-size ring buffer,
+ * so recording the event takes no shared lock; the oldest events are
+ * overwritten when a ring fills up. Every thread also sums its scopes by
+ * name, and endFrame() folds all threads' sums into one per-frame total
+ * per phase. Scopes timed on a simulation or worker thread therefore
+ * show up in the rolling p50/p99 statistics for the overlay alongside
+ * the render thread's own.
+ * 
+ * writeChromeTrace() dumps every ring as Chrome trace_event JSON that
+ * chrome://tracing or ui.perfetto.dev can open.
+ * 
+ * @note Export only while no other thread is recording (stop or join the
+ *       simulation thread first). The rings are read without locks, so
+ *       events written during the export would race with it.
+ * 
+ * @example
+ * @code
+ * void Collision::handleCollisions(Player& player, const AabbArrays& platforms) {
+ *     PROFILE_SCOPE("Collision::handleCollisions");
+ *     ...
+ * }
+ * 
+ * // Once per rendered frame:
+ * Profiler::global().endFrame();
+ * @endcode
+ */
+class Profiler
+{
+public:
+    /** @brief Events kept per thread before the ring wraps */
+    static constexpr std::size_t RING_CAPACITY = 1 << 16;
+    
+    /** @brief Frames kept for the rolling percentiles */
+    static constexpr std::size_t WINDOW_FRAMES = 300;
+    
+    /**
+     * @brief Gets the process-wide profiler
+     */
+    static Profiler& global();
+    
+    /**
+     * @brief Records a completed scope on the calling thread
+     * 
+     * @param name    String literal identifying the scope
+     * @param startNs Start time from now()
+     * @param endNs   End time from now()
+     */
+    void record(const char* name, std::int64_t startNs, std::int64_t endNs);
+    
+    /**
+     * @brief Closes the current frame
+     * 
+     * Pushes the frame time, and the per-phase totals every thread
+     * accumulated since the last call, into the rolling windows. Call from
+     * one thread only (the render loop).
+     */
+    void endFrame();
+    
+    /**
+     * @brief Rolling p50/p99 of whole frames (time between endFrame calls)
+     */
+    PhaseStats getFrameStats() const;
+    
+    /**
+     * @brief Rolling p50/p99 per phase, in first-seen order
+     */
+    std::vector<PhaseStats> getPhaseStats() const;
+    
+    /**
+     * @brief Writes all buffered events as Chrome trace_event JSON
+     * 
+     * @param path Output path (e.g. "trace.json")
+     * @return true if the file was written
+     */
+    bool writeChromeTrace(const std::string& path) const;
+    
+    /**
+     * @brief Nanoseconds since the profiler epoch
+     */
+    static std::int64_t now();
+    
+private:
+    /** @brief Lock-free single-writer ring owned by one thread */
+    struct ThreadBuffer
+    {
+        std::vector<ProfileEvent> events;
+        std::atomic<std::uint64_t> written{ 0 };
+        std::uint32_t threadIndex = 0;
+        
+        /** @brief This frame's per-name totals, emptied by endFrame() */
+        std::vector<std::pair<const char*, std::int64_t>> frameTotals;
+        
+        /** @brief Guards frameTotals; only contended while endFrame() collects them */
+        std::mutex totalsMutex;
+    };
+    
+    /** @brief Rolling window of per-frame samples in nanoseconds */
+    struct Window
+    {
+        const char* name = nullptr;
+        std::vector<std::int64_t> samples;
+        std::size_t next = 0;
+        
+        void push(std::int64_t sample);
+        PhaseStats stats() const;
+    };
+    
+    /** @brief Gets (creating on first use) the calling thread's ring */
+    ThreadBuffer& localBuffer();
+    
+    /** @brief Guards buffer registration and the rolling windows */
+    mutable std::mutex mutex;
+    
+    /** @brief Every thread's ring, kept alive after the thread exits */
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    
+    /** @brief Whole-frame window */
+    Window frameWindow;
+    
+    /** @brief One window per phase name */
+    std::vector<Window> phaseWindows;
+    
+    /** @brief Every thread's frameTotals added up, reused by each endFrame() */
+    std::vector<std::pair<const char*, std::int64_t>> mergedTotals;
+    
+    /** @brief Time of the previous endFrame() */
+    std::int64_t lastFrameEnd = -1;
+};
+
+/**
+ * @class ScopedTimer
+ * @brief RAII helper behind PROFILE_SCOPE
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const char* name) : name(name), startNs(Profiler::now()) {}
+    ~ScopedTimer() { Profiler::global().record(name, startNs, Profiler::now()); }
+    
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+    
+private:
+    const char* name;
+    std::int64_t startNs;
+};
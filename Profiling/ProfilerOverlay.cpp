@@ -0,0 +1,76 @@
+#include "ProfilerOverlay.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    constexpr float ROW_HEIGHT = 14.0f;
+    constexpr float BAR_HEIGHT = 10.0f;
+    constexpr float LABEL_WIDTH = 170.0f;
+}
+
+bool ProfilerOverlay::loadFont(const std::string& path)
+{
+    sf::Font loaded;
+    if (!loaded.openFromFile(path)) 
+    {
+        return false;
+    }
+    font = std::move(loaded);
+    return true;
+}
+
+void ProfilerOverlay::draw(sf::RenderTarget& target, const Profiler& profiler) const
+{
+    if (!visible) return;
+    
+    std::vector<PhaseStats> phases = profiler.getPhaseStats();
+    
+    // Draw in screen space regardless of any camera view
+    sf::View previousView = target.getView();
+    target.setView(target.getDefaultView());
+    
+    float labelWidth = font ? LABEL_WIDTH : 0.0f;
+    sf::RectangleShape panel(sf::Vector2f(labelWidth + width + 8.0f, ROW_HEIGHT * (phases.size() + 1) + 8.0f));
+    panel.setPosition(position - sf::Vector2f(4.0f, 4.0f));
+    panel.setFillColor(sf::Color(0, 0, 0, 160));
+    target.draw(panel);
+    
+    float y = position.y;
+    drawRow(target, profiler.getFrameStats(), y);
+    for (const PhaseStats& phase : phases) 
+    {
+        y += ROW_HEIGHT;
+        drawRow(target, phase, y);
+    }
+    
+    target.setView(previousView);
+}
+
+void ProfilerOverlay::drawRow(sf::RenderTarget& target, const PhaseStats& stats, float y) const
+{
+    float x = position.x;
+    if (font) 
+    {
+        char label[96];
+        std::snprintf(label, sizeof(label), "%-26s %5.2f %5.2f", stats.name, stats.p50Ms, stats.p99Ms);
+        sf::Text text(*font, label, 10);
+        text.setPosition(sf::Vector2f(x, y));
+        text.setFillColor(sf::Color::White);
+        target.draw(text);
+        x += LABEL_WIDTH;
+    }
+    
+    auto scale = [this](float ms) { return std::min(ms / budgetMs, 1.0f) * width; };
+    bool overBudget = stats.p99Ms > budgetMs;
+    
+    sf::RectangleShape p50Bar(sf::Vector2f(std::max(scale(stats.p50Ms), 1.0f), BAR_HEIGHT));
+    p50Bar.setPosition(sf::Vector2f(x, y));
+    p50Bar.setFillColor(overBudget ? sf::Color(220, 60, 60) : sf::Color(80, 200, 120));
+    target.draw(p50Bar);
+    
+    sf::RectangleShape p99Marker(sf::Vector2f(2.0f, BAR_HEIGHT));
+    p99Marker.setPosition(sf::Vector2f(x + scale(stats.p99Ms), y));
+    p99Marker.setFillColor(sf::Color::Yellow);
+    target.draw(p99Marker);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <optional>
+#include <string>
+#include "Profiler.h"
+
+/**
+ * @class ProfilerOverlay
+ * @brief On-screen bar chart of rolling p50/p99 phase times
+ * 
+ * Draws one row per phase: a solid bar for p50 and a thin marker line for
+ * p99, scaled so the full width equals the frame budget. Rows whose p99
+ * exceeds the budget turn red. Phase names are printed only when a font
+ * has been loaded, since the game ships no font asset.
+ */
+class ProfilerOverlay
+{
+public:
+    /**
+     * @brief Loads an optional font for phase labels
+     * 
+     * @param path Path to a TTF/OTF file
+     * @return true if the font was loaded
+     */
+    bool loadFont(const std::string& path);
+    
+    /**
+     * @brief Draws the overlay in screen space
+     * 
+     * @param target   Window or texture to draw onto
+     * @param profiler Source of the rolling statistics
+     */
+    void draw(sf::RenderTarget& target, const Profiler& profiler) const;
+    
+    bool visible = false;              ///< Toggled by the game loop
+    float budgetMs = 1000.0f / 75.0f;  ///< Bar width that spans the full panel
+    sf::Vector2f position{ 10.0f, 10.0f };
+    float width = 300.0f;
+    
+private:
+    /** @brief Draws a single p50/p99 row */
+    void drawRow(sf::RenderTarget& target, const PhaseStats& stats, float y) const;
+    
+    std::optional<sf::Font> font;
+};
@@ -0,0 +1,499 @@
+#include "ProjectilePool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+    // Chunk size for parallel casts: each one runs up to two grid queries
+    // and a few slab tests, so chunks can be smaller than EnemyPool's
+    constexpr std::size_t PARALLEL_GRAIN = 512;
+    
+    // Cast outcomes in ProjectilePool::result besides entity indices and ProjectileHit::LEVEL
+    constexpr std::uint32_t NOT_HIT = 0xFFFFFFFDu;
+    constexpr std::uint32_t EXPIRED = 0xFFFFFFFEu;
+    
+    // Grid queries cover the cast's bounds plus this many cells each way,
+    // rounded out to whole cells, so the candidates also serve the casts
+    // of the projectiles sorted next to it
+    constexpr float QUERY_PADDING = 0.5f;
+    
+    // Widest radix digit; cell indices are below SpatialGrid::MAX_CELLS, so
+    // two passes always sort them
+    constexpr unsigned int MAX_RADIX_BITS = 11;
+    static_assert(SpatialGrid::MAX_CELLS <= (std::size_t(1) << (2 * MAX_RADIX_BITS)), "cell indices need more radix passes");
+    
+    bool contains(const sf::FloatRect& outer, const sf::FloatRect& inner)
+    {
+        return inner.position.x >= outer.position.x && inner.position.y >= outer.position.y &&
+               inner.position.x + inner.size.x <= outer.position.x + outer.size.x &&
+               inner.position.y + inner.size.y <= outer.position.y + outer.size.y;
+    }
+    
+    struct KindParams
+    {
+        float radius;        // Collision radius in pixels
+        float gravityScale;  // Fraction of ProjectilePool::gravity applied
+        float lifetime;      // Seconds before it fizzles out
+    };
+    
+    constexpr KindParams KIND_PARAMS[static_cast<std::size_t>(ProjectileKind::COUNT)] = 
+    {
+        { 10.0f, 0.3f, 4.0f },   // fireball
+        { 6.0f, 0.0f, 2.0f },    // magic bolt
+        { 12.0f, 0.0f, 0.25f },  // slash
+    };
+    
+    // Bytes per projectile across the dense columns
+    constexpr std::size_t DENSE_BYTES = 5 * sizeof(float) + sizeof(ProjectileKind) + sizeof(ProjectileOwner);
+    
+    // Slab test of the segment (x, y) + t * (dx, dy), t in [0, limit), against
+    // a box grown by radius. Returns the entry t (0 if the segment starts
+    // inside), or limit if it does not get in before limit.
+    float segmentEntry(float x, float y, float dx, float dy, float radius, float limit,
+                       float minX, float minY, float maxX, float maxY)
+    {
+        float enter = 0.0f;
+        float leave = limit;
+        
+        float low = minX - radius;
+        float high = maxX + radius;
+        if (dx == 0.0f) 
+        {
+            if (x < low || x > high) 
+            {
+                return limit;
+            }
+        }
+        else 
+        {
+            float inverse = 1.0f / dx;
+            float t0 = (low - x) * inverse;
+            float t1 = (high - x) * inverse;
+            enter = std::max(enter, std::min(t0, t1));
+            leave = std::min(leave, std::max(t0, t1));
+        }
+        
+        low = minY - radius;
+        high = maxY + radius;
+        if (dy == 0.0f) 
+        {
+            if (y < low || y > high) 
+            {
+                return limit;
+            }
+        }
+        else 
+        {
+            float inverse = 1.0f / dy;
+            float t0 = (low - y) * inverse;
+            float t1 = (high - y) * inverse;
+            enter = std::max(enter, std::min(t0, t1));
+            leave = std::min(leave, std::max(t0, t1));
+        }
+        
+        return enter <= leave && enter < limit ? enter : limit;
+    }
+    
+    // Reorders the first n entries of column so entry i comes from order[i];
+    // buffer (the column's size) is swapped in and keeps the old contents
+    template <typename T>
+    void gather(std::vector<T>& column, const std::vector<std::uint32_t>& order, std::vector<T>& buffer, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; i++) 
+        {
+            buffer[i] = column[order[i]];
+        }
+        column.swap(buffer);
+    }
+    
+    template <typename T>
+    void putArray(std::uint8_t*& out, const T* values, std::size_t n)
+    {
+        std::memcpy(out, values, n * sizeof(T));
+        out += n * sizeof(T);
+    }
+    
+    template <typename T>
+    void takeArray(const std::uint8_t*& in, T* values, std::size_t n)
+    {
+        std::memcpy(values, in, n * sizeof(T));
+        in += n * sizeof(T);
+    }
+}
+
+ProjectilePool::ProjectilePool(std::size_t capacity)
+    : positionX(capacity), positionY(capacity), velocityX(capacity), velocityY(capacity),
+      lifetime(capacity), kind(capacity), owner(capacity), result(capacity, NOT_HIT),
+      sortOrder(capacity), sortCells(capacity), sortedOrder(capacity), sortedCells(capacity),
+      floatBuffer(capacity), kindBuffer(capacity), ownerBuffer(capacity)
+{
+}
+
+bool ProjectilePool::spawn(ProjectileKind projectileKind, ProjectileOwner projectileOwner, const sf::Vector2f& position, const sf::Vector2f& velocity)
+{
+    if (count == capacity() || projectileKind >= ProjectileKind::COUNT || projectileOwner > ProjectileOwner::ENEMY) 
+    {
+        return false;
+    }
+    
+    // A NaN would reach the grid's cell index conversion, which cannot clamp it
+    if (!std::isfinite(position.x) || !std::isfinite(position.y) || 
+        !std::isfinite(velocity.x) || !std::isfinite(velocity.y)) 
+    {
+        return false;
+    }
+    positionX[count] = position.x;
+    positionY[count] = position.y;
+    velocityX[count] = velocity.x;
+    velocityY[count] = velocity.y;
+    lifetime[count] = KIND_PARAMS[static_cast<std::size_t>(projectileKind)].lifetime;
+    kind[count] = projectileKind;
+    owner[count] = projectileOwner;
+    count++;
+    return true;
+}
+
+void ProjectilePool::despawn(std::size_t index)
+{
+    // Move the last projectile into the hole so the arrays stay packed
+    std::size_t last = count - 1;
+    if (index != last) 
+    {
+        positionX[index] = positionX[last];
+        positionY[index] = positionY[last];
+        velocityX[index] = velocityX[last];
+        velocityY[index] = velocityY[last];
+        lifetime[index] = lifetime[last];
+        kind[index] = kind[last];
+        owner[index] = owner[last];
+    }
+    count--;
+}
+
+void ProjectilePool::clear()
+{
+    count = 0;
+}
+
+void ProjectilePool::update(float deltaTime, const SpatialGrid& platforms, const SpatialGrid& entities,
+                            std::size_t playerCount, std::vector<ProjectileHit>& hits)
+{
+    sortByCell(platforms);
+    ProjectileStats stats;
+    castRange(deltaTime, platforms, entities, playerCount, 0, count, scratch, stats);
+    addStats(stats);
+    removeFinished(hits);
+}
+
+void ProjectilePool::update(float deltaTime, const SpatialGrid& platforms, const SpatialGrid& entities,
+                            std::size_t playerCount, std::vector<ProjectileHit>& hits, JobSystem& jobs)
+{
+    sortByCell(platforms);
+    jobs.parallelFor(0, count, PARALLEL_GRAIN,
+                     [this, deltaTime, &platforms, &entities, playerCount](std::size_t first, std::size_t last) 
+    {
+        thread_local CastScratch chunkScratch;
+        ProjectileStats stats;
+        castRange(deltaTime, platforms, entities, playerCount, first, last, chunkScratch, stats);
+        addStats(stats);
+    });
+    removeFinished(hits);
+}
+
+void ProjectilePool::sortByCell(const SpatialGrid& grid)
+{
+    // Row-major cell of each position, clamped into the grid like its
+    // queries are. Only the grouping matters, so truncation is fine
+    const float inverseCell = 1.0f / grid.cellSize;
+    const float lastColumn = static_cast<float>(std::max(grid.columns - 1, 0));
+    const float lastRow = static_cast<float>(std::max(grid.rows - 1, 0));
+    const std::uint32_t columns = static_cast<std::uint32_t>(grid.columns);
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        float column = std::clamp((positionX[i] - grid.origin.x) * inverseCell, 0.0f, lastColumn);
+        float row = std::clamp((positionY[i] - grid.origin.y) * inverseCell, 0.0f, lastRow);
+        sortOrder[i] = static_cast<std::uint32_t>(i);
+        sortCells[i] = static_cast<std::uint32_t>(row) * columns + static_cast<std::uint32_t>(column);
+    }
+    
+    // LSD radix sort, low digit first; stable, so equal cells keep dense
+    // order. Digits are as narrow as the grid allows: small histograms
+    // scatter into few places at once
+    unsigned int bits = 1;
+    while (bits < 2 * MAX_RADIX_BITS && (std::size_t(1) << bits) < static_cast<std::size_t>(grid.columns) * grid.rows) 
+    {
+        bits++;
+    }
+    unsigned int passes = bits > MAX_RADIX_BITS ? 2 : 1;
+    unsigned int digitBits = (bits + passes - 1) / passes;
+    std::uint32_t mask = (1u << digitBits) - 1;
+    for (unsigned int shift = 0; shift < passes * digitBits; shift += digitBits) 
+    {
+        std::uint32_t offsets[(1u << MAX_RADIX_BITS) + 1] = {};
+        for (std::size_t i = 0; i < count; i++) 
+        {
+            offsets[((sortCells[i] >> shift) & mask) + 1]++;
+        }
+        for (std::uint32_t digit = 0; digit < mask; digit++) 
+        {
+            offsets[digit + 1] += offsets[digit];
+        }
+        for (std::size_t i = 0; i < count; i++) 
+        {
+            std::uint32_t slot = offsets[(sortCells[i] >> shift) & mask]++;
+            sortedOrder[slot] = sortOrder[i];
+            sortedCells[slot] = sortCells[i];
+        }
+        sortOrder.swap(sortedOrder);
+        sortCells.swap(sortedCells);
+    }
+    
+    gather(positionX, sortOrder, floatBuffer, count);
+    gather(positionY, sortOrder, floatBuffer, count);
+    gather(velocityX, sortOrder, floatBuffer, count);
+    gather(velocityY, sortOrder, floatBuffer, count);
+    gather(lifetime, sortOrder, floatBuffer, count);
+    gather(kind, sortOrder, kindBuffer, count);
+    gather(owner, sortOrder, ownerBuffer, count);
+}
+
+void ProjectilePool::castRange(float deltaTime, const SpatialGrid& platforms, const SpatialGrid& entities, std::size_t playerCount,
+                               std::size_t first, std::size_t last, CastScratch& scratch, ProjectileStats& stats)
+{
+    const AabbArrays& platformBoxes = platforms.getArrays();
+    const AabbArrays& entityBoxes = entities.getArrays();
+    
+    // Candidates left over from another range (or another tick's grid) are not reusable
+    scratch.platforms.valid = false;
+    scratch.entities.valid = false;
+    
+    for (std::size_t i = first; i < last; i++) 
+    {
+        const KindParams& params = KIND_PARAMS[static_cast<std::size_t>(kind[i])];
+        velocityY[i] += gravity * params.gravityScale * deltaTime;
+        
+        float x = positionX[i];
+        float y = positionY[i];
+        float dx = velocityX[i] * deltaTime;
+        float dy = velocityY[i] * deltaTime;
+        float radius = params.radius;
+        
+        // Everything the grown segment can touch lies inside its bounds
+        sf::FloatRect area(sf::Vector2f(std::min(x, x + dx) - radius, std::min(y, y + dy) - radius),
+                           sf::Vector2f(std::abs(dx) + 2.0f * radius, std::abs(dy) + 2.0f * radius));
+        stats.casts++;
+        
+        float nearest = 1.0f;
+        std::uint32_t target = NOT_HIT;
+        
+        for (std::size_t p : candidatesFor(platforms, area, scratch.platforms, stats)) 
+        {
+            float t = segmentEntry(x, y, dx, dy, radius, nearest,
+                                   platformBoxes.minX[p], platformBoxes.minY[p], platformBoxes.maxX[p], platformBoxes.maxY[p]);
+            if (t < nearest) 
+            {
+                nearest = t;
+                target = ProjectileHit::LEVEL;
+            }
+        }
+        
+        // Entities only count if they are strictly closer, so a projectile
+        // that meets a wall and an enemy at once stops on the wall. Players
+        // come first in the ascending candidates; only the other side is tested
+        const std::vector<std::size_t>& nearby = candidatesFor(entities, area, scratch.entities, stats);
+        auto firstEnemy = std::lower_bound(nearby.begin(), nearby.end(), playerCount);
+        bool hitsPlayers = owner[i] == ProjectileOwner::ENEMY;
+        auto from = hitsPlayers ? nearby.begin() : firstEnemy;
+        auto to = hitsPlayers ? firstEnemy : nearby.end();
+        for (auto it = from; it != to; ++it) 
+        {
+            std::size_t e = *it;
+            float t = segmentEntry(x, y, dx, dy, radius, nearest,
+                                   entityBoxes.minX[e], entityBoxes.minY[e], entityBoxes.maxX[e], entityBoxes.maxY[e]);
+            if (t < nearest) 
+            {
+                nearest = t;
+                target = static_cast<std::uint32_t>(e);
+            }
+        }
+        
+        positionX[i] = x + dx * nearest;
+        positionY[i] = y + dy * nearest;
+        lifetime[i] -= deltaTime;
+        if (target == NOT_HIT && lifetime[i] <= 0.0f) 
+        {
+            target = EXPIRED;
+        }
+        result[i] = target;
+    }
+}
+
+const std::vector<std::size_t>& ProjectilePool::candidatesFor(const SpatialGrid& grid, const sf::FloatRect& area,
+                                                             CandidateCache& cache, ProjectileStats& stats)
+{
+    if (cache.valid && contains(cache.area, area)) 
+    {
+        stats.queriesReused++;
+        return cache.items;
+    }
+    
+    // A superset of the exact candidates changes nothing: they are still
+    // tested in ascending index order, and the extra ones are misses
+    float cell = grid.cellSize;
+    float padding = cell * QUERY_PADDING;
+    float left = grid.origin.x + std::floor((area.position.x - padding - grid.origin.x) / cell) * cell;
+    float top = grid.origin.y + std::floor((area.position.y - padding - grid.origin.y) / cell) * cell;
+    float right = grid.origin.x + std::ceil((area.position.x + area.size.x + padding - grid.origin.x) / cell) * cell;
+    float bottom = grid.origin.y + std::ceil((area.position.y + area.size.y + padding - grid.origin.y) / cell) * cell;
+    cache.area = sf::FloatRect(sf::Vector2f(left, top), sf::Vector2f(right - left, bottom - top));
+    cache.valid = true;
+    grid.query(cache.area, cache.items);
+    stats.queries++;
+    return cache.items;
+}
+
+void ProjectilePool::removeFinished(std::vector<ProjectileHit>& hits)
+{
+    // Backwards, so the projectile despawn() moves into a hole has already
+    // been looked at and is known to stay
+    hits.clear();
+    for (std::size_t i = count; i-- > 0; ) 
+    {
+        std::uint32_t target = result[i];
+        if (target == NOT_HIT) 
+        {
+            continue;
+        }
+        if (target == EXPIRED) 
+        {
+            expiredCount++;
+        }
+        else 
+        {
+            hits.push_back(ProjectileHit{ target, sf::Vector2f(positionX[i], positionY[i]), kind[i], owner[i] });
+            hitCount++;
+        }
+        despawn(i);
+    }
+}
+
+void ProjectilePool::addStats(const ProjectileStats& stats)
+{
+    castCount.fetch_add(stats.casts, std::memory_order_relaxed);
+    queryCount.fetch_add(stats.queries, std::memory_order_relaxed);
+    reusedCount.fetch_add(stats.queriesReused, std::memory_order_relaxed);
+}
+
+std::size_t ProjectilePool::stateSize() const
+{
+    return sizeof(std::uint32_t) + count * DENSE_BYTES;
+}
+
+void ProjectilePool::writeState(std::uint8_t* out) const
+{
+    std::uint32_t live = static_cast<std::uint32_t>(count);
+    putArray(out, &live, 1);
+    putArray(out, positionX.data(), count);
+    putArray(out, positionY.data(), count);
+    putArray(out, velocityX.data(), count);
+    putArray(out, velocityY.data(), count);
+    putArray(out, lifetime.data(), count);
+    putArray(out, kind.data(), count);
+    putArray(out, owner.data(), count);
+}
+
+bool ProjectilePool::validateState(const std::uint8_t* data, std::size_t size) const
+{
+    std::uint32_t live;
+    if (size < sizeof(live)) 
+    {
+        return false;
+    }
+    std::memcpy(&live, data, sizeof(live));
+    if (live > capacity() || size < sizeof(live) + live * DENSE_BYTES) 
+    {
+        return false;
+    }
+    
+    // Positions end up as grid cell indices; a NaN would turn into garbage
+    const std::uint8_t* in = data + sizeof(live);
+    for (std::size_t i = 0; i < 4 * static_cast<std::size_t>(live); i++) 
+    {
+        float value;
+        std::memcpy(&value, in + i * sizeof(float), sizeof(float));
+        if (!std::isfinite(value)) 
+        {
+            return false;
+        }
+    }
+    
+    // kind indexes the per-kind parameters
+    const std::uint8_t* kinds = in + 5 * live * sizeof(float);
+    const std::uint8_t* owners = kinds + live * sizeof(ProjectileKind);
+    for (std::size_t i = 0; i < live; i++) 
+    {
+        if (kinds[i] >= static_cast<std::uint8_t>(ProjectileKind::COUNT) || 
+            owners[i] > static_cast<std::uint8_t>(ProjectileOwner::ENEMY)) 
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ProjectilePool::readState(const std::uint8_t* data, std::size_t size)
+{
+    if (!validateState(data, size)) 
+    {
+        return false;
+    }
+    std::uint32_t live;
+    std::memcpy(&live, data, sizeof(live));
+    
+    const std::uint8_t* in = data + sizeof(live);
+    count = live;
+    takeArray(in, positionX.data(), count);
+    takeArray(in, positionY.data(), count);
+    takeArray(in, velocityX.data(), count);
+    takeArray(in, velocityY.data(), count);
+    takeArray(in, lifetime.data(), count);
+    takeArray(in, kind.data(), count);
+    takeArray(in, owner.data(), count);
+    return true;
+}
+
+ProjectileStats ProjectilePool::getStats() const
+{
+    ProjectileStats stats;
+    stats.casts = castCount.load(std::memory_order_relaxed);
+    stats.queries = queryCount.load(std::memory_order_relaxed);
+    stats.queriesReused = reusedCount.load(std::memory_order_relaxed);
+    stats.hits = hitCount;
+    stats.expired = expiredCount;
+    return stats;
+}
+
+void ProjectilePool::resetStats()
+{
+    castCount.store(0, std::memory_order_relaxed);
+    queryCount.store(0, std::memory_order_relaxed);
+    reusedCount.store(0, std::memory_order_relaxed);
+    hitCount = 0;
+    expiredCount = 0;
+}
+
+std::size_t ProjectilePool::size() const
+{
+    return count;
+}
+
+std::size_t ProjectilePool::capacity() const
+{
+    return positionX.size();
+}
+
+float ProjectilePool::radiusOf(ProjectileKind projectileKind)
+{
+    return KIND_PARAMS[static_cast<std::size_t>(projectileKind)].radius;
+}
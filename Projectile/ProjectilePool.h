@@ -0,0 +1,290 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Physics/SpatialGrid.h"
+#include "../Jobs/JobSystem.h"
+
+/**
+ * @enum ProjectileKind
+ * @brief What was fired, which sets its size, drop and lifetime
+ */
+enum class ProjectileKind : std::uint8_t
+{
+    FIREBALL,    ///< Dragon and small dragon Fire_Attack; slow, falls a little
+    MAGIC_BOLT,  ///< Jinn Magic_Attack; fast and straight
+    SLASH,       ///< Player ATTACK 1/2/3; short-lived wave in front of the player
+    COUNT        ///< Number of kinds (not a valid kind)
+};
+
+/**
+ * @enum ProjectileOwner
+ * @brief Side a projectile was fired by; it only hits the other side
+ */
+enum class ProjectileOwner : std::uint8_t
+{
+    PLAYER,
+    ENEMY
+};
+
+/**
+ * @struct ProjectileHit
+ * @brief A projectile that struck something during the last update()
+ */
+struct ProjectileHit
+{
+    /** @brief target value of a hit on level geometry */
+    static constexpr std::uint32_t LEVEL = 0xFFFFFFFFu;
+    
+    std::uint32_t target;        ///< Entity index in the entity grid, or LEVEL
+    sf::Vector2f position;       ///< Projectile center at contact
+    ProjectileKind kind;
+    ProjectileOwner owner;
+};
+
+/**
+ * @struct ProjectileStats
+ * @brief Work done by ProjectilePool::update() since the last resetStats()
+ */
+struct ProjectileStats
+{
+    std::size_t casts = 0;            ///< Segment casts (one per live projectile per update)
+    std::size_t queries = 0;          ///< Grid queries that actually ran
+    std::size_t queriesReused = 0;    ///< Lookups answered by an earlier cast's query
+    std::size_t hits = 0;             ///< Projectiles that struck a platform or an entity
+    std::size_t expired = 0;          ///< Projectiles whose lifetime ran out
+};
+
+/**
+ * @class ProjectilePool
+ * @brief Fixed-capacity structure-of-arrays storage for fireballs, bolts and slashes
+ * 
+ * Like EnemyPool, every field lives in its own array and live projectiles
+ * are packed into [0, size()): spawning appends and despawning moves the
+ * last projectile into the hole, both O(1), and neither ever allocates:
+ * all storage is sized to the capacity up front.
+ * 
+ * update() moves every projectile as a segment cast: the segment from its
+ * position to where its velocity takes it this step is tested against the
+ * platforms and the entities near it, found through a SpatialGrid for
+ * each, and the projectile stops at the earliest contact. Nothing can pass
+ * through a platform or an entity however fast it flies.
+ * 
+ * Casts are batched by neighbourhood: update() first reorders the pool by
+ * the platform grid cell each projectile is in (a radix sort, then one
+ * gather per array), so neighbours sit next to each other. A grid query
+ * covers a block of whole cells around a cast, and its candidates serve
+ * every following cast that fits inside the block, so most casts skip the
+ * query altogether.
+ * 
+ * Entities are indexed as in World: the first playerCount entries of the
+ * entity grid are players, the rest enemies. PLAYER projectiles only hit
+ * enemies and ENEMY projectiles only hit players.
+ * 
+ * @note Dense indices (0..size()-1) change on despawn and on every
+ *       update(); projectiles have no handles because nothing holds on to
+ *       one across ticks.
+ * 
+ * @example
+ * @code
+ * ProjectilePool projectiles(20000);
+ * projectiles.spawn(ProjectileKind::FIREBALL, ProjectileOwner::ENEMY, mouth, sf::Vector2f(-300.f, 0.f));
+ * 
+ * // Every tick, after entities have moved:
+ * entityGrid.build(entityBounds);
+ * projectiles.update(dt, platformGrid, entityGrid, 1, hits);
+ * @endcode
+ */
+class ProjectilePool
+{
+public:
+    /**
+     * @brief Constructs an empty pool and allocates all storage up front
+     * 
+     * @param capacity Maximum number of live projectiles
+     */
+    explicit ProjectilePool(std::size_t capacity);
+    
+    /**
+     * @brief Fires a projectile
+     * 
+     * @param projectileKind  What is fired (sets radius, drop and lifetime)
+     * @param projectileOwner Side that fired it
+     * @param position        Initial center
+     * @param velocity        Initial velocity in pixels per second
+     * @return false if the pool is full, the kind or owner does not exist, or
+     *         position or velocity is not finite (nothing is spawned)
+     */
+    bool spawn(ProjectileKind projectileKind, ProjectileOwner projectileOwner, const sf::Vector2f& position, const sf::Vector2f& velocity);
+    
+    /**
+     * @brief Removes a projectile by moving the last one into its place
+     * 
+     * @param index Dense index of the projectile
+     */
+    void despawn(std::size_t index);
+    
+    /** @brief Removes every projectile */
+    void clear();
+    
+    /**
+     * @brief Moves every projectile, resolving hits and expiry
+     * 
+     * Applies each kind's drop to the velocity, casts the step's segment
+     * against platforms and entities, and moves to the end of the segment
+     * or to the first contact. Projectiles that hit something or outlive
+     * their kind's lifetime are despawned; each hit is appended to hits.
+     * 
+     * @param deltaTime   Step length in seconds
+     * @param platforms   Broadphase over the level's platforms
+     * @param entities    Broadphase over this tick's entity bounds
+     * @param playerCount Number of leading entities that are players
+     * @param hits        Receives the hits (cleared first), in descending dense index order
+     */
+    void update(float deltaTime, const SpatialGrid& platforms, const SpatialGrid& entities,
+                std::size_t playerCount, std::vector<ProjectileHit>& hits);
+    
+    /**
+     * @brief update() with the segment casts split across a job system
+     * 
+     * Every cast is independent, and despawning runs afterwards in dense
+     * order, so the result is identical to the serial version.
+     */
+    void update(float deltaTime, const SpatialGrid& platforms, const SpatialGrid& entities,
+                std::size_t playerCount, std::vector<ProjectileHit>& hits, JobSystem& jobs);
+    
+    /** @brief Bytes writeState() will produce for the current contents */
+    std::size_t stateSize() const;
+    
+    /**
+     * @brief Copies every live projectile into a flat buffer
+     * 
+     * @param out At least stateSize() bytes
+     */
+    void writeState(std::uint8_t* out) const;
+    
+    /**
+     * @brief Checks a buffer before readState() trusts it
+     * 
+     * @param data Buffer written by writeState()
+     * @param size Its size in bytes
+     * @return false if the buffer is truncated, holds more than capacity(), has
+     *         a position or velocity that is not finite, or a kind or owner
+     *         that does not exist
+     */
+    bool validateState(const std::uint8_t* data, std::size_t size) const;
+    
+    /**
+     * @brief Restores the pool from a buffer filled by writeState()
+     * 
+     * @param data Buffer written by writeState()
+     * @param size Its size in bytes
+     * @return false if validateState() rejects the buffer (the pool is then unchanged)
+     */
+    bool readState(const std::uint8_t* data, std::size_t size);
+    
+    /** @brief Counters accumulated by update() */
+    ProjectileStats getStats() const;
+    
+    /** @brief Zeroes the counters returned by getStats() */
+    void resetStats();
+    
+    /** @brief Number of live projectiles */
+    std::size_t size() const;
+    
+    /** @brief Maximum number of live projectiles */
+    std::size_t capacity() const;
+    
+    /** @brief Collision radius of a kind in pixels */
+    static float radiusOf(ProjectileKind projectileKind);
+    
+    /** @brief Gravity acceleration in pixels per second squared (scaled per kind) */
+    float gravity = 980.0f;
+    
+    /// @name Dense Per-Projectile Arrays (valid in [0, size()))
+    /// @{
+    
+    std::vector<float> positionX;          ///< Center X
+    std::vector<float> positionY;          ///< Center Y
+    std::vector<float> velocityX;          ///< Pixels per second
+    std::vector<float> velocityY;          ///< Pixels per second
+    std::vector<float> lifetime;           ///< Seconds left before it fizzles out
+    std::vector<ProjectileKind> kind;
+    std::vector<ProjectileOwner> owner;
+    
+    /// @}
+    
+private:
+    /**
+     * @brief Grid query result kept for the casts that follow
+     * 
+     * Holds every item whose cells overlap area, so it serves any later
+     * cast whose bounds lie inside area.
+     */
+    struct CandidateCache
+    {
+        std::vector<std::size_t> items;
+        sf::FloatRect area;
+        bool valid = false;
+    };
+    
+    /** @brief One CandidateCache per grid; one per thread, invalidated at the start of every range */
+    struct CastScratch
+    {
+        CandidateCache platforms;
+        CandidateCache entities;
+    };
+    
+    /** @brief Candidates for a cast's bounds, querying the grid only if the cache does not cover them */
+    static const std::vector<std::size_t>& candidatesFor(const SpatialGrid& grid, const sf::FloatRect& area,
+                                                         CandidateCache& cache, ProjectileStats& stats);
+    
+    /** @brief Reorders the live projectiles by the grid cell each one is in */
+    void sortByCell(const SpatialGrid& grid);
+    
+    /** @brief Casts and moves dense indices [first, last), recording outcomes in result */
+    void castRange(float deltaTime, const SpatialGrid& platforms, const SpatialGrid& entities, std::size_t playerCount,
+                   std::size_t first, std::size_t last, CastScratch& scratch, ProjectileStats& stats);
+    
+    /** @brief Despawns everything castRange() marked, appending the hits */
+    void removeFinished(std::vector<ProjectileHit>& hits);
+    
+    /** @brief Adds a range's counters to the shared totals */
+    void addStats(const ProjectileStats& stats);
+    
+    /** @brief Number of live projectiles */
+    std::size_t count = 0;
+    
+    /**
+     * @brief Outcome of the last cast per projectile
+     * 
+     * NOT_HIT, EXPIRED, ProjectileHit::LEVEL or the entity index. Only
+     * meaningful between castRange() and removeFinished().
+     */
+    std::vector<std::uint32_t> result;
+    
+    /// @name sortByCell() Buffers
+    /// @{
+    
+    std::vector<std::uint32_t> sortOrder;      ///< Dense indices, sorted by cell
+    std::vector<std::uint32_t> sortCells;      ///< Cell per sortOrder entry
+    std::vector<std::uint32_t> sortedOrder;    ///< Radix pass output
+    std::vector<std::uint32_t> sortedCells;    ///< Radix pass output
+    std::vector<float> floatBuffer;            ///< Swapped with each float column as it is reordered
+    std::vector<ProjectileKind> kindBuffer;
+    std::vector<ProjectileOwner> ownerBuffer;
+    
+    /// @}
+    
+    /** @brief Candidate lists for the serial update() */
+    CastScratch scratch;
+    
+    /** @brief Totals behind getStats(), added to once per chunk */
+    std::atomic<std::size_t> castCount{ 0 };
+    std::atomic<std::size_t> queryCount{ 0 };
+    std::atomic<std::size_t> reusedCount{ 0 };
+    std::size_t hitCount = 0;
+    std::size_t expiredCount = 0;
+};
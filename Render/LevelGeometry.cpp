@@ -0,0 +1,107 @@
+#include "LevelGeometry.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace
+{
+    constexpr std::size_t VERTICES_PER_PLATFORM = 6;
+    constexpr std::size_t CLEAN = SIZE_MAX;
+}
+
+LevelGeometry::LevelGeometry()
+    : buffer(sf::PrimitiveType::Triangles, sf::VertexBuffer::Usage::Static),
+    useBuffer(false),
+    dirtyBegin(CLEAN),
+    dirtyEnd(0)
+{
+}
+
+void LevelGeometry::build(const std::vector<Platform>& platforms)
+{
+    vertices.resize(platforms.size() * VERTICES_PER_PLATFORM);
+    for (std::size_t i = 0; i < platforms.size(); i++) 
+    {
+        writePlatform(i, platforms[i]);
+    }
+    
+    // Upload once; fall back to drawing the CPU array if buffers are unsupported
+    useBuffer = sf::VertexBuffer::isAvailable() && 
+                buffer.create(vertices.size()) && 
+                buffer.update(vertices.data());
+    
+    dirtyBegin = CLEAN;
+    dirtyEnd = 0;
+    fullBuilds++;
+}
+
+void LevelGeometry::markDirty(std::size_t index)
+{
+    dirtyBegin = std::min(dirtyBegin, index);
+    dirtyEnd = std::max(dirtyEnd, index + 1);
+}
+
+void LevelGeometry::refresh(const std::vector<Platform>& platforms)
+{
+    if (platforms.size() * VERTICES_PER_PLATFORM != vertices.size()) 
+    {
+        build(platforms);
+        return;
+    }
+    if (dirtyBegin == CLEAN) 
+    {
+        return;
+    }
+    
+    for (std::size_t i = dirtyBegin; i < dirtyEnd; i++) 
+    {
+        writePlatform(i, platforms[i]);
+    }
+    
+    // Upload just the span covering the dirty platforms
+    if (useBuffer) 
+    {
+        std::size_t first = dirtyBegin * VERTICES_PER_PLATFORM;
+        std::size_t count = (dirtyEnd - dirtyBegin) * VERTICES_PER_PLATFORM;
+        useBuffer = buffer.update(vertices.data() + first, count, static_cast<unsigned int>(first));
+    }
+    
+    dirtyBegin = CLEAN;
+    dirtyEnd = 0;
+    partialUploads++;
+}
+
+void LevelGeometry::draw(sf::RenderTarget& target) const
+{
+    if (vertices.empty()) 
+    {
+        return;
+    }
+    
+    if (useBuffer) 
+    {
+        target.draw(buffer);
+    }
+    else 
+    {
+        target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::Triangles);
+    }
+}
+
+void LevelGeometry::writePlatform(std::size_t index, const Platform& platform)
+{
+    sf::FloatRect bounds = platform.shape.getGlobalBounds();
+    sf::Color color = platform.shape.getFillColor();
+    
+    sf::Vector2f topLeft = bounds.position;
+    sf::Vector2f topRight(bounds.position.x + bounds.size.x, bounds.position.y);
+    sf::Vector2f bottomRight = bounds.position + bounds.size;
+    sf::Vector2f bottomLeft(bounds.position.x, bounds.position.y + bounds.size.y);
+    
+    sf::Vertex* quad = &vertices[index * VERTICES_PER_PLATFORM];
+    quad[0] = sf::Vertex{ topLeft, color };
+    quad[1] = sf::Vertex{ topRight, color };
+    quad[2] = sf::Vertex{ bottomRight, color };
+    quad[3] = sf::Vertex{ topLeft, color };
+    quad[4] = sf::Vertex{ bottomRight, color };
+    quad[5] = sf::Vertex{ bottomLeft, color };
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "../Platform/Platform.h"
+
+/**
+ * @class LevelGeometry
+ * @brief Static platforms baked into a single GPU vertex buffer
+ * 
+ * Platforms never move, so instead of drawing every sf::RectangleShape each
+ * frame the level is converted to one triangle list once, uploaded with
+ * static usage, and drawn with a single call. Individual platforms can be
+ * marked dirty (destructible or moving platforms); refresh() then re-uploads
+ * only the vertex range that covers the changed platforms.
+ * 
+ * @note Falls back to a CPU-side vertex array (still one draw call) on
+ *       drivers without vertex buffer support.
+ * 
+ * @example
+ * @code
+ * LevelGeometry level;
+ * level.build(platforms);
+ * 
+ * // When platform 3 changes:
+ * level.markDirty(3);
+ * level.refresh(platforms);
+ * 
+ * // In game loop:
+ * level.draw(window);
+ * @endcode
+ */
+class LevelGeometry
+{
+public:
+    /**
+     * @brief Constructs empty geometry (nothing is drawn until build())
+     */
+    LevelGeometry();
+    
+    /**
+     * @brief Bakes every platform into the vertex buffer
+     * 
+     * @param platforms Level platforms; vertex ranges follow their order
+     */
+    void build(const std::vector<Platform>& platforms);
+    
+    /**
+     * @brief Flags one platform as changed since the last build/refresh
+     * 
+     * @param index Index into the platform vector passed to build()
+     */
+    void markDirty(std::size_t index);
+    
+    /**
+     * @brief Re-uploads the vertices of all dirty platforms
+     * 
+     * Only the contiguous range spanning the dirty platforms is sent to the
+     * GPU. If the number of platforms changed, the whole level is rebuilt.
+     * 
+     * @param platforms Same platform vector that was passed to build()
+     */
+    void refresh(const std::vector<Platform>& platforms);
+    
+    /**
+     * @brief Draws the whole level with one draw call
+     * 
+     * @param target Render target to draw into
+     */
+    void draw(sf::RenderTarget& target) const;
+    
+    /// @name Statistics
+    /// @{
+    
+    /** @brief Number of full rebuilds */
+    unsigned int fullBuilds = 0;
+    
+    /** @brief Number of partial (dirty-range) uploads */
+    unsigned int partialUploads = 0;
+    
+    /// @}
+    
+private:
+    /** @brief Writes the six vertices of one platform into `vertices` */
+    void writePlatform(std::size_t index, const Platform& platform);
+    
+    /** @brief GPU copy of the level (static usage) */
+    sf::VertexBuffer buffer;
+    
+    /** @brief CPU copy, used for partial rebuilds and as the fallback path */
+    std::vector<sf::Vertex> vertices;
+    
+    /** @brief Whether the GPU buffer is in use */
+    bool useBuffer;
+    
+    /** @brief First dirty platform, or SIZE_MAX when clean */
+    std::size_t dirtyBegin;
+    
+    /** @brief One past the last dirty platform */
+    std::size_t dirtyEnd;
+};
@@ -0,0 +1,121 @@
+#include "SnapshotRenderer.h"
+#include <algorithm>
+
+SnapshotRenderer::SnapshotRenderer() 
+    : puppet(0.0f, 0.0f)
+{
+}
+
+bool SnapshotRenderer::loadPlayer(const std::string& basePath)
+{
+    return puppet.loadAllAnimations(basePath);
+}
+
+bool SnapshotRenderer::loadPlayer(ClipResidency& clipResidency, const std::string& basePath)
+{
+    return puppet.bindAnimations(clipResidency, basePath);
+}
+
+void SnapshotRenderer::setEnemyClips(const EnemyPool& enemies)
+{
+    residency = nullptr;
+    for (std::size_t t = 0; t < static_cast<std::size_t>(EnemyType::COUNT); t++) 
+    {
+        for (std::size_t s = 0; s < 3; s++) 
+        {
+            enemyClips[t][s] = enemies.getClip(static_cast<EnemyType>(t), static_cast<EnemyState>(s));
+        }
+    }
+}
+
+void SnapshotRenderer::setEnemyClips(ClipResidency& clipResidency, const std::string& basePath)
+{
+    residency = &clipResidency;
+    Enemy::declareClips(clipResidency, basePath);
+    for (std::size_t t = 0; t < static_cast<std::size_t>(EnemyType::COUNT); t++) 
+    {
+        std::string family = Enemy::familyName(static_cast<EnemyType>(t));
+        enemyClipIds[t][0] = clipResidency.find(family + "/Idle");
+        enemyClipIds[t][1] = clipResidency.find(family + "/Attack");
+        enemyClipIds[t][2] = clipResidency.find(family + "/Death");
+        for (std::size_t s = 0; s < 3; s++) 
+        {
+            enemyClips[t][s] = nullptr;
+        }
+    }
+}
+
+void SnapshotRenderer::prefetchEnemies(const EnemySpawn* spawns, std::size_t count)
+{
+    if (!residency) 
+    {
+        return;
+    }
+    
+    bool present[static_cast<std::size_t>(EnemyType::COUNT)] = {};
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        if (spawns[i].type < static_cast<std::uint32_t>(EnemyType::COUNT)) 
+        {
+            present[spawns[i].type] = true;
+        }
+    }
+    for (std::size_t t = 0; t < static_cast<std::size_t>(EnemyType::COUNT); t++) 
+    {
+        for (std::size_t s = 0; present[t] && s < 3; s++) 
+        {
+            residency->prefetch(enemyClipIds[t][s]);
+        }
+    }
+}
+
+void SnapshotRenderer::draw(SpriteBatch& batch, const RenderSnapshot& snapshot, float alpha)
+{
+    // The batch that used last frame's clips has been flushed by now, so
+    // clips no enemy needed last frame can go back to the residency
+    if (residency) 
+    {
+        for (std::size_t t = 0; t < static_cast<std::size_t>(EnemyType::COUNT); t++) 
+        {
+            for (std::size_t s = 0; s < 3; s++) 
+            {
+                if (!enemyClipUsed[t][s]) 
+                {
+                    enemyClips[t][s] = nullptr;
+                }
+                enemyClipUsed[t][s] = false;
+            }
+        }
+    }
+    
+    for (const EnemySnapshot& enemy : snapshot.enemies) 
+    {
+        std::size_t t = static_cast<std::size_t>(enemy.type);
+        std::size_t s = static_cast<std::size_t>(enemy.state);
+        ClipHandle& clip = enemyClips[t][s];
+        if (!clip && residency) 
+        {
+            clip = residency->acquire(enemyClipIds[t][s]);
+            if (!clip) 
+            {
+                enemyClipIds[t][s] = ClipResidency::NO_CLIP; // Do not retry missing files every frame
+            }
+        }
+        enemyClipUsed[t][s] = true;
+        if (!clip || clip->frames.empty()) 
+        {
+            continue;
+        }
+        
+        std::size_t f = std::min<std::size_t>(enemy.frame, clip->frames.size() - 1);
+        sf::Vector2f origin = f < clip->pivots.size() ? clip->pivots[f] : sf::Vector2f(0.f, 0.f);
+        sf::Vector2f position(enemy.previousX + (enemy.x - enemy.previousX) * alpha, 
+                              enemy.previousY + (enemy.y - enemy.previousY) * alpha);
+        batch.draw(*clip->texture, clip->frames[f], position, origin, enemy.flipX, sf::Color::White, 0);
+    }
+    
+    const PlayerSnapshot& player = snapshot.player;
+    sf::Vector2f position = player.previousPosition + (player.position - player.previousPosition) * alpha;
+    puppet.setPose(player.state, player.frame, player.facingRight, position);
+    puppet.draw(batch, 1);
+}
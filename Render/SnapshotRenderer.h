@@ -0,0 +1,101 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include "SpriteBatch.h"
+#include "../Player/Player.h"
+#include "../Enemy/EnemyPool.h"
+#include "../Level/LevelFormat.h"
+#include "../Sim/RenderSnapshot.h"
+
+/**
+ * @class SnapshotRenderer
+ * @brief Draws interpolated RenderSnapshots on the render thread
+ * 
+ * Owns its own posed copy of the player and its own table of enemy clips,
+ * so drawing never touches objects the simulation thread is writing.
+ * 
+ * @example
+ * @code
+ * SnapshotRenderer renderer;
+ * renderer.loadPlayer();
+ * renderer.setEnemyClips(world.enemies);  // before the sim thread starts
+ * 
+ * // Render loop:
+ * renderer.draw(batch, sim.latest(), sim.getAlpha());
+ * @endcode
+ */
+class SnapshotRenderer
+{
+public:
+    SnapshotRenderer();
+    
+    /**
+     * @brief Loads the player animations for the posed copy
+     * 
+     * @param basePath Directory holding the player sheets
+     * @return true if every animation loaded
+     */
+    bool loadPlayer(const std::string& basePath = "assets/with_outline/");
+    
+    /**
+     * @brief Binds the posed player to lazily loaded clips (Player::bindAnimations)
+     * 
+     * @param residency Residency to declare the clips in (must outlive the renderer)
+     * @param basePath  Directory holding the player sheets
+     * @return true if the idle animation loaded
+     */
+    bool loadPlayer(ClipResidency& residency, const std::string& basePath = "assets/with_outline/");
+    
+    /**
+     * @brief Copies the clip table of a pool that had setClips() called
+     * 
+     * @param enemies Pool to take clips from (not touched afterwards)
+     */
+    void setEnemyClips(const EnemyPool& enemies);
+    
+    /**
+     * @brief Draws enemies with clips that load the first time they are needed
+     * 
+     * Declares the enemy clips (Enemy::declareClips) in the residency. A
+     * clip is acquired when an enemy of its family and state first shows up
+     * and released after a frame without one, so the residency may evict it.
+     * 
+     * @param residency Residency to declare the clips in (must outlive the renderer)
+     * @param basePath  Directory holding one folder per enemy family
+     */
+    void setEnemyClips(ClipResidency& residency, const std::string& basePath = "assets/Enemies/");
+    
+    /**
+     * @brief Loads the clips of every enemy family in a spawn table ahead of use
+     * 
+     * Prefetches all three states of each family present, so neither the
+     * first sighting nor the first attack or death waits for the disk.
+     * Does nothing unless the clips come from a residency.
+     * 
+     * @param spawns Spawn table (e.g. LevelFile::spawns() or a chunk's spawns)
+     * @param count  Entries in the table
+     */
+    void prefetchEnemies(const EnemySpawn* spawns, std::size_t count);
+    
+    /**
+     * @brief Queues the snapshot's sprites, interpolated by alpha
+     * 
+     * @param batch    Batch to draw into (enemies on layer 0, player on 1)
+     * @param snapshot Latest snapshot
+     * @param alpha    0 draws the previous tick, 1 draws the latest tick
+     */
+    void draw(SpriteBatch& batch, const RenderSnapshot& snapshot, float alpha);
+    
+private:
+    Player puppet;
+    ClipHandle enemyClips[static_cast<std::size_t>(EnemyType::COUNT)][3];
+    
+    /** @brief Source of enemy clips loaded on demand (nullptr for a fixed table) */
+    ClipResidency* residency = nullptr;
+    
+    /** @brief Residency clip per family and state */
+    ClipResidency::ClipId enemyClipIds[static_cast<std::size_t>(EnemyType::COUNT)][3];
+    
+    /** @brief Clips drawn since the previous draw(); the others are released */
+    bool enemyClipUsed[static_cast<std::size_t>(EnemyType::COUNT)][3] = {};
+};
@@ -0,0 +1,99 @@
+#include "SpriteBatch.h"
+#include <algorithm>
+
+void SpriteBatch::begin()
+{
+    entries.clear();
+    quads.clear();
+    spriteCount = 0;
+    drawCalls = 0;
+}
+
+void SpriteBatch::draw(const sf::Texture& texture, 
+                       const sf::IntRect& textureRect, 
+                       const sf::Vector2f& position, 
+                       const sf::Vector2f& origin, 
+                       bool flipX, 
+                       sf::Color color, 
+                       int layer)
+{
+    entries.push_back(Entry{ &texture, layer, static_cast<std::uint32_t>(entries.size()) });
+    
+    // Corners relative to the origin; flipping mirrors around it like setScale(-1, 1)
+    float width = static_cast<float>(textureRect.size.x);
+    float height = static_cast<float>(textureRect.size.y);
+    float left = -origin.x;
+    float right = width - origin.x;
+    if (flipX) 
+    {
+        left = -left;
+        right = -right;
+    }
+    float top = position.y - origin.y;
+    float bottom = top + height;
+    left += position.x;
+    right += position.x;
+    
+    float u0 = static_cast<float>(textureRect.position.x);
+    float v0 = static_cast<float>(textureRect.position.y);
+    float u1 = u0 + width;
+    float v1 = v0 + height;
+    
+    sf::Vertex topLeft{ sf::Vector2f(left, top), color, sf::Vector2f(u0, v0) };
+    sf::Vertex topRight{ sf::Vector2f(right, top), color, sf::Vector2f(u1, v0) };
+    sf::Vertex bottomRight{ sf::Vector2f(right, bottom), color, sf::Vector2f(u1, v1) };
+    sf::Vertex bottomLeft{ sf::Vector2f(left, bottom), color, sf::Vector2f(u0, v1) };
+    
+    // Two triangles per quad (SFML 3 has no Quads primitive)
+    quads.push_back(topLeft);
+    quads.push_back(topRight);
+    quads.push_back(bottomRight);
+    quads.push_back(topLeft);
+    quads.push_back(bottomRight);
+    quads.push_back(bottomLeft);
+}
+
+void SpriteBatch::flush(sf::RenderTarget& target)
+{
+    if (entries.empty()) 
+    {
+        return;
+    }
+    
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) 
+    {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        if (a.texture != b.texture) return a.texture < b.texture;
+        return a.order < b.order;
+    });
+    
+    // Gather vertices in sorted order so each run is contiguous
+    sorted.resize(quads.size());
+    for (std::size_t i = 0; i < entries.size(); i++) 
+    {
+        std::copy_n(quads.begin() + entries[i].order * 6, 6, sorted.begin() + i * 6);
+    }
+    
+    // One draw per run of quads sharing layer and texture
+    std::size_t runStart = 0;
+    for (std::size_t i = 1; i <= entries.size(); i++) 
+    {
+        bool runEnds = i == entries.size() || 
+                       entries[i].texture != entries[runStart].texture || 
+                       entries[i].layer != entries[runStart].layer;
+        if (!runEnds) 
+        {
+            continue;
+        }
+        
+        sf::RenderStates states;
+        states.texture = entries[runStart].texture;
+        target.draw(&sorted[runStart * 6], (i - runStart) * 6, sf::PrimitiveType::Triangles, states);
+        drawCalls++;
+        runStart = i;
+    }
+    
+    spriteCount += entries.size();
+    entries.clear();
+    quads.clear();
+}
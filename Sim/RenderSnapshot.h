@@ -0,0 +1,51 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <cstdint>
+#include <vector>
+#include "../Player/Player.h"
+#include "../Enemy/Enemy.h"
+
+/**
+ * @struct PlayerSnapshot
+ * @brief What the renderer needs to draw the player for one tick
+ */
+struct PlayerSnapshot
+{
+    sf::Vector2f previousPosition;   ///< Position at the end of the previous tick
+    sf::Vector2f position;           ///< Position at the end of this tick
+    PlayerState state = PlayerState::IDLE;
+    unsigned int frame = 0;          ///< Frame within the state's animation
+    bool facingRight = true;
+};
+
+/**
+ * @struct EnemySnapshot
+ * @brief What the renderer needs to draw one enemy for one tick
+ */
+struct EnemySnapshot
+{
+    float previousX;
+    float previousY;
+    float x;
+    float y;
+    EnemyType type;
+    EnemyState state;
+    std::uint16_t frame;
+    bool flipX;                      ///< Moving left
+};
+
+/**
+ * @struct RenderSnapshot
+ * @brief Immutable copy of the drawable world state after one tick
+ * 
+ * Each snapshot carries both the previous and the current positions, so
+ * the render thread can interpolate between the last two ticks from a
+ * single snapshot without keeping history of its own.
+ */
+struct RenderSnapshot
+{
+    unsigned long long tick = 0;     ///< World::tickCount after the tick
+    std::int64_t tickTimeNs = 0;     ///< Scheduled steady-clock time of the tick
+    PlayerSnapshot player;
+    std::vector<EnemySnapshot> enemies;
+};
@@ -0,0 +1,149 @@
+#include "SimulationThread.h"
+#include "../Profiling/Profiler.h"
+#include <algorithm>
+
+namespace
+{
+    const std::chrono::nanoseconds TICK = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::duration<double>(World::TIMESTEP));
+    
+    std::int64_t toNs(std::chrono::steady_clock::time_point time)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count();
+    }
+}
+
+SimulationThread::SimulationThread(World& world, InputSource& input)
+    : world(world), input(input)
+{
+}
+
+SimulationThread::~SimulationThread()
+{
+    stop();
+}
+
+void SimulationThread::start()
+{
+    if (running.exchange(true)) 
+    {
+        return;
+    }
+    
+    // Renderer has something to show before the first tick
+    rememberPositions();
+    publish(std::chrono::steady_clock::now());
+    
+    thread = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop()
+{
+    running.store(false);
+    if (thread.joinable()) 
+    {
+        thread.join();
+    }
+}
+
+float SimulationThread::getAlpha() const
+{
+    std::int64_t sinceTick = toNs(std::chrono::steady_clock::now()) - latest().tickTimeNs;
+    return std::clamp(static_cast<float>(sinceTick) / TICK.count(), 0.0f, 1.0f);
+}
+
+void SimulationThread::run()
+{
+    auto nextTick = std::chrono::steady_clock::now() + TICK;
+    while (running.load(std::memory_order_relaxed)) 
+    {
+        std::this_thread::sleep_until(nextTick);
+        
+        int steps = 0;
+        while (std::chrono::steady_clock::now() >= nextTick && steps < World::MAX_STEPS_PER_ADVANCE) 
+        {
+            if (input.exhausted()) 
+            {
+                finished.store(true, std::memory_order_release);
+                return;
+            }
+            
+            // Remember where everything was for the renderer's interpolation
+            rememberPositions();
+            
+            world.step(input.next());
+            publish(nextTick);
+            nextTick += TICK;
+            steps++;
+        }
+        
+        // Too far behind: drop the backlog rather than spiral
+        auto now = std::chrono::steady_clock::now();
+        if (steps == World::MAX_STEPS_PER_ADVANCE && now >= nextTick) 
+        {
+            droppedTicks.fetch_add(static_cast<unsigned long long>((now - nextTick) / TICK) + 1, std::memory_order_relaxed);
+            nextTick = now + TICK;
+        }
+    }
+}
+
+void SimulationThread::publish(std::chrono::steady_clock::time_point tickTime)
+{
+    PROFILE_SCOPE("SimulationThread::publish");
+    RenderSnapshot& snapshot = snapshots.writeBuffer();
+    snapshot.tick = world.tickCount;
+    snapshot.tickTimeNs = toNs(tickTime);
+    
+    const Player& player = world.player;
+    snapshot.player.previousPosition = previousPlayer;
+    snapshot.player.position = player.getPosition();
+    snapshot.player.state = player.currentState;
+    snapshot.player.frame = player.currentAnimation ? player.currentAnimation->getCurrentFrame() : 0;
+    snapshot.player.facingRight = player.facingRight;
+    
+    // Enemies spawned this tick have no previous position; they don't move
+    const EnemyPool& enemies = world.enemies;
+    std::size_t count = enemies.size();
+    snapshot.enemies.resize(count);
+    for (std::size_t i = 0; i < count; i++) 
+    {
+        EnemySnapshot& enemy = snapshot.enemies[i];
+        EnemyHandle handle = enemies.handleAt(i);
+        bool known = handle.slot < previousStamp.size() && previousStamp[handle.slot] == stamp && 
+                     previousGeneration[handle.slot] == handle.generation;
+        enemy.x = enemies.positionX[i];
+        enemy.y = enemies.positionY[i];
+        enemy.previousX = known ? previousX[handle.slot] : enemy.x;
+        enemy.previousY = known ? previousY[handle.slot] : enemy.y;
+        enemy.type = enemies.type[i];
+        enemy.state = enemies.state[i];
+        enemy.frame = enemies.frame[i];
+        enemy.flipX = enemies.velocityX[i] < 0.0f;
+    }
+    
+    snapshots.publish();
+}
+
+void SimulationThread::rememberPositions()
+{
+    const EnemyPool& enemies = world.enemies;
+    if (previousStamp.size() != enemies.capacity()) 
+    {
+        previousX.assign(enemies.capacity(), 0.0f);
+        previousY.assign(enemies.capacity(), 0.0f);
+        previousGeneration.assign(enemies.capacity(), 0);
+        previousStamp.assign(enemies.capacity(), 0);
+    }
+    
+    // A fresh stamp retires every entry left by enemies that are gone now
+    stamp++;
+    previousPlayer = world.player.getPosition();
+    for (std::size_t i = 0; i < enemies.size(); i++) 
+    {
+        EnemyHandle handle = enemies.handleAt(i);
+        previousX[handle.slot] = enemies.positionX[i];
+        previousY[handle.slot] = enemies.positionY[i];
+        previousGeneration[handle.slot] = handle.generation;
+        previousStamp[handle.slot] = stamp;
+    }
+}
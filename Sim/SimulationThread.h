@@ -0,0 +1,125 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "../World/World.h"
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+
+/**
+ * @class SimulationThread
+ * @brief Runs the world at a fixed tick on its own thread
+ * 
+ * The thread steps the world every World::TIMESTEP on a steady-clock
+ * schedule, independent of how long frames take to render or present. After
+ * each tick it publishes a RenderSnapshot through a lock-free triple buffer.
+ * If it falls behind it runs at most World::MAX_STEPS_PER_ADVANCE ticks
+ * back to back and then drops the rest of the backlog.
+ * 
+ * While running, the world and the input source belong to this thread. Read
+ * the world only after stop().
+ * 
+ * @example
+ * @code
+ * SharedInput keyboard;
+ * SimulationThread sim(world, keyboard);
+ * sim.start();
+ * 
+ * // Render loop:
+ * keyboard.set(readKeyboard());
+ * sim.acquire();
+ * renderer.draw(batch, sim.latest(), sim.getAlpha());
+ * @endcode
+ */
+class SimulationThread
+{
+public:
+    /**
+     * @param world World to simulate (must outlive the thread)
+     * @param input Source pulled once per tick, on the simulation thread
+     */
+    SimulationThread(World& world, InputSource& input);
+    
+    /** @brief Stops and joins the thread */
+    ~SimulationThread();
+    
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+    
+    /**
+     * @brief Publishes the initial state and starts ticking
+     */
+    void start();
+    
+    /**
+     * @brief Stops ticking and joins the thread
+     */
+    void stop();
+    
+    /**
+     * @brief Picks up the newest snapshot (render thread)
+     * 
+     * @return true if a new snapshot arrived since the last call
+     */
+    bool acquire() { return snapshots.acquire(); }
+    
+    /**
+     * @brief Snapshot picked up by the last acquire() (render thread)
+     */
+    const RenderSnapshot& latest() const { return snapshots.readBuffer(); }
+    
+    /**
+     * @brief How far the present is past the latest snapshot's tick (0..1)
+     * 
+     * Rendering at previous + (current - previous) * alpha shows the world
+     * one tick behind real time, smoothly at any display rate.
+     */
+    float getAlpha() const;
+    
+    /**
+     * @brief True once the input source ran out (end of a replay)
+     */
+    bool isFinished() const { return finished.load(std::memory_order_acquire); }
+    
+    /// @name Statistics
+    /// @{
+    
+    /** @brief Ticks skipped because the thread fell too far behind */
+    std::atomic<unsigned long long> droppedTicks{ 0 };
+    
+    /// @}
+    
+private:
+    /** @brief Thread body */
+    void run();
+    
+    /** @brief Fills the write slot from the world and publishes it */
+    void publish(std::chrono::steady_clock::time_point tickTime);
+    
+    /** @brief Records where the player and every enemy are before a tick */
+    void rememberPositions();
+    
+    World& world;
+    InputSource& input;
+    TripleBuffer<RenderSnapshot> snapshots;
+    
+    /**
+     * @brief Enemy positions before the current tick, indexed by pool slot
+     * 
+     * Dense indices shift when an enemy despawns, so positions are keyed by
+     * identity: an entry belongs to an enemy only if its generation matches
+     * and it was written by the latest rememberPositions() (stamp).
+     */
+    std::vector<float> previousX;
+    std::vector<float> previousY;
+    std::vector<std::uint32_t> previousGeneration;
+    std::vector<std::uint32_t> previousStamp;
+    std::uint32_t stamp = 0;
+    sf::Vector2f previousPlayer;
+    
+    std::thread thread;
+    std::atomic<bool> running{ false };
+    std::atomic<bool> finished{ false };
+};
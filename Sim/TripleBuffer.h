@@ -0,0 +1,80 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Lock-free single-producer/single-consumer hand-off of the latest value
+ * 
+ * Three slots rotate between the writer, the reader and a shared "middle"
+ * slot. publish() swaps the writer's slot into the middle and acquire()
+ * swaps the middle into the reader's slot, each with one atomic exchange,
+ * so neither side ever waits for the other. The reader always sees the
+ * newest complete value; values it was too slow to see are skipped.
+ * 
+ * Slots are reused, so T's buffers (e.g. vectors) keep their capacity and
+ * steady-state publishing does not allocate.
+ * 
+ * @example
+ * @code
+ * TripleBuffer<Snapshot> buffer;
+ * 
+ * // Producer thread:
+ * fill(buffer.writeBuffer());
+ * buffer.publish();
+ * 
+ * // Consumer thread:
+ * buffer.acquire();
+ * draw(buffer.readBuffer());
+ * @endcode
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    /**
+     * @brief Slot the producer may fill (producer thread only)
+     */
+    T& writeBuffer() { return slots[writeIndex]; }
+    
+    /**
+     * @brief Makes the write slot the newest value and takes a fresh slot
+     */
+    void publish()
+    {
+        std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(writeIndex | FRESH_BIT), std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+    
+    /**
+     * @brief Moves the newest published value into the read slot
+     * 
+     * @return true if a value newer than the previous read was picked up
+     */
+    bool acquire()
+    {
+        if ((middle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) 
+        {
+            return false;
+        }
+        std::uint8_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+    
+    /**
+     * @brief Latest value picked up by acquire() (consumer thread only)
+     */
+    const T& readBuffer() const { return slots[readIndex]; }
+    
+private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH_BIT = 0x4;
+    
+    T slots[3];
+    std::uint8_t writeIndex = 0;
+    std::uint8_t readIndex = 1;
+    
+    /** @brief Index of the shared slot, plus FRESH_BIT if unread */
+    std::atomic<std::uint8_t> middle{ 2 };
+};
@@ -0,0 +1,292 @@
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include "../Animation/TextureAtlas.h"
+
+// Offline atlas builder for the per-frame enemy PNGs.
+//
+// Scans <inputDir>/<family>/<Animation><N>.png, trims fully transparent
+// borders, shelf-packs every frame into pages of at most pageSize x pageSize
+// and writes <outputDir>/atlas_<page>.png plus <outputDir>/atlas.txt
+// (format documented in Animation/TextureAtlas.h).
+//
+// Usage: AtlasPacker [inputDir] [outputDir] [pageSize]
+//        (default: assets/Enemies assets/Enemies 2048)
+
+namespace fs = std::filesystem;
+
+// Padding between packed frames, avoids bleeding when sprites are scaled
+static const int PADDING = 2;
+
+// Largest texture side most GPUs accept
+static const int MAX_PAGE_SIZE = 16384;
+
+struct Frame
+{
+    std::string clip;       // "<family>/<Animation>"
+    unsigned int number;    // Numeric suffix from the file name
+    unsigned int index;     // Position within the clip after sorting
+    sf::Image image;
+    sf::IntRect trimmed;    // Opaque region inside the source image
+    unsigned int page = 0;
+    sf::Vector2i placed;    // Top-left inside the page
+};
+
+// Shelf packer state for one page
+struct Shelf
+{
+    int cursorX = 0;
+    int cursorY = 0;
+    int shelfHeight = 0;
+    int usedHeight = 0;
+};
+
+// Split "Magic_Attack10" into ("Magic_Attack", 10)
+static bool splitFrameName(const std::string& stem, std::string& name, unsigned int& number)
+{
+    std::size_t digits = stem.size();
+    while (digits > 0 && std::isdigit(static_cast<unsigned char>(stem[digits - 1]))) 
+    {
+        digits--;
+    }
+    if (digits == 0 || digits == stem.size()) 
+    {
+        return false;
+    }
+    name = stem.substr(0, digits);
+    number = static_cast<unsigned int>(std::strtoul(stem.c_str() + digits, nullptr, 10));
+    return true;
+}
+
+// Smallest rectangle containing every pixel with non-zero alpha
+static sf::IntRect trimTransparent(const sf::Image& image)
+{
+    sf::Vector2u size = image.getSize();
+    int minX = static_cast<int>(size.x), minY = static_cast<int>(size.y), maxX = -1, maxY = -1;
+    for (unsigned int y = 0; y < size.y; y++) 
+    {
+        for (unsigned int x = 0; x < size.x; x++) 
+        {
+            if (image.getPixel(sf::Vector2u(x, y)).a != 0) 
+            {
+                minX = std::min(minX, static_cast<int>(x));
+                minY = std::min(minY, static_cast<int>(y));
+                maxX = std::max(maxX, static_cast<int>(x));
+                maxY = std::max(maxY, static_cast<int>(y));
+            }
+        }
+    }
+    
+    // Fully transparent frame: keep a single pixel so the clip keeps its length
+    if (maxX < 0) 
+    {
+        return sf::IntRect(sf::Vector2i(0, 0), sf::Vector2i(1, 1));
+    }
+    return sf::IntRect(sf::Vector2i(minX, minY), sf::Vector2i(maxX - minX + 1, maxY - minY + 1));
+}
+
+// Place a w x h rectangle on the shelf, or return false if the page is full
+static bool place(Shelf& shelf, int w, int h, int pageSize, sf::Vector2i& out)
+{
+    if (shelf.cursorX + w > pageSize) 
+    {
+        shelf.cursorY += shelf.shelfHeight + PADDING;
+        shelf.cursorX = 0;
+        shelf.shelfHeight = 0;
+    }
+    if (w > pageSize || shelf.cursorY + h > pageSize) 
+    {
+        return false;
+    }
+    out = sf::Vector2i(shelf.cursorX, shelf.cursorY);
+    shelf.cursorX += w + PADDING;
+    shelf.shelfHeight = std::max(shelf.shelfHeight, h);
+    shelf.usedHeight = std::max(shelf.usedHeight, shelf.cursorY + h);
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    fs::path inputDir = argc > 1 ? argv[1] : "assets/Enemies";
+    fs::path outputDir = argc > 2 ? argv[2] : "assets/Enemies";
+    int pageSize = argc > 3 ? std::atoi(argv[3]) : 2048;
+    if (pageSize <= 0 || pageSize > MAX_PAGE_SIZE) 
+    {
+        std::cerr << "pageSize must be between 1 and " << MAX_PAGE_SIZE << std::endl;
+        return 1;
+    }
+    
+    // Gather and decode every frame, grouped by clip
+    std::map<std::string, std::vector<Frame>> clips;
+    std::size_t sourceBytes = 0;
+    for (const auto& family : fs::directory_iterator(inputDir)) 
+    {
+        if (!family.is_directory()) 
+        {
+            continue;
+        }
+        for (const auto& entry : fs::directory_iterator(family.path())) 
+        {
+            if (entry.path().extension() != ".png") 
+            {
+                continue;
+            }
+            
+            Frame frame;
+            std::string animation;
+            if (!splitFrameName(entry.path().stem().string(), animation, frame.number)) 
+            {
+                std::cerr << "Skipping " << entry.path() << " (no frame number)" << std::endl;
+                continue;
+            }
+            if (!frame.image.loadFromFile(entry.path())) 
+            {
+                std::cerr << "Failed to load " << entry.path() << std::endl;
+                return 1;
+            }
+            frame.clip = family.path().filename().string() + "/" + animation;
+            frame.trimmed = trimTransparent(frame.image);
+            sourceBytes += static_cast<std::size_t>(frame.image.getSize().x) * frame.image.getSize().y * 4;
+            clips[frame.clip].push_back(std::move(frame));
+        }
+    }
+    
+    // Number frames within each clip by their numeric suffix
+    std::vector<std::vector<Frame>*> order;
+    for (auto& entry : clips) 
+    {
+        std::vector<Frame>& frames = entry.second;
+        std::sort(frames.begin(), frames.end(), 
+                  [](const Frame& a, const Frame& b) { return a.number < b.number; });
+        for (unsigned int i = 0; i < frames.size(); i++) 
+        {
+            frames[i].index = i;
+        }
+        order.push_back(&frames);
+    }
+    
+    // Tallest clips first keeps shelves tight
+    auto tallest = [](const std::vector<Frame>& frames) 
+    {
+        int height = 0;
+        for (const Frame& frame : frames) 
+        {
+            height = std::max(height, frame.trimmed.size.y);
+        }
+        return height;
+    };
+    std::stable_sort(order.begin(), order.end(), 
+                     [&](const std::vector<Frame>* a, const std::vector<Frame>* b) { return tallest(*a) > tallest(*b); });
+    
+    // Pack clip by clip so a clip never straddles two pages
+    std::vector<Shelf> shelves(1);
+    for (std::vector<Frame>* frames : order) 
+    {
+        Shelf attempt = shelves.back();
+        bool fits = true;
+        for (Frame& frame : *frames) 
+        {
+            if (!place(attempt, frame.trimmed.size.x, frame.trimmed.size.y, pageSize, frame.placed)) 
+            {
+                fits = false;
+                break;
+            }
+        }
+        
+        if (!fits) 
+        {
+            attempt = Shelf();
+            for (Frame& frame : *frames) 
+            {
+                if (!place(attempt, frame.trimmed.size.x, frame.trimmed.size.y, pageSize, frame.placed)) 
+                {
+                    std::cerr << "Clip " << frame.clip << " does not fit on one " 
+                              << pageSize << "px page" << std::endl;
+                    return 1;
+                }
+            }
+            shelves.push_back(Shelf());
+        }
+        
+        shelves.back() = attempt;
+        for (Frame& frame : *frames) 
+        {
+            frame.page = static_cast<unsigned int>(shelves.size() - 1);
+        }
+    }
+    
+    if (shelves.size() > TextureAtlas::MAX_PAGES) 
+    {
+        std::cerr << "Frames need " << shelves.size() << " pages, TextureAtlas loads at most " 
+                  << TextureAtlas::MAX_PAGES << "; use a larger pageSize" << std::endl;
+        return 1;
+    }
+    
+    // Compose pages, cropped to the rows actually used
+    std::vector<sf::Image> pages;
+    for (const Shelf& shelf : shelves) 
+    {
+        pages.emplace_back(sf::Vector2u(pageSize, std::max(1, shelf.usedHeight)), sf::Color::Transparent);
+    }
+    for (const auto& entry : clips) 
+    {
+        for (const Frame& frame : entry.second) 
+        {
+            if (!pages[frame.page].copy(frame.image, sf::Vector2u(frame.placed), frame.trimmed)) 
+            {
+                std::cerr << "Failed to copy " << frame.clip << frame.number << std::endl;
+                return 1;
+            }
+        }
+    }
+    
+    // Write pages and manifest
+    std::ofstream manifest(outputDir / "atlas.txt");
+    if (!manifest) 
+    {
+        std::cerr << "Failed to write " << (outputDir / "atlas.txt") << std::endl;
+        return 1;
+    }
+    manifest << "# Generated by Tools/AtlasPacker - do not edit\n";
+    
+    std::size_t atlasBytes = 0;
+    for (std::size_t i = 0; i < pages.size(); i++) 
+    {
+        std::string pageFile = "atlas_" + std::to_string(i) + ".png";
+        if (!pages[i].saveToFile(outputDir / pageFile)) 
+        {
+            std::cerr << "Failed to write " << (outputDir / pageFile) << std::endl;
+            return 1;
+        }
+        manifest << "page " << i << " " << pageFile << "\n";
+        atlasBytes += static_cast<std::size_t>(pages[i].getSize().x) * pages[i].getSize().y * 4;
+    }
+    
+    std::size_t frameCount = 0;
+    for (const auto& entry : clips) 
+    {
+        for (const Frame& frame : entry.second) 
+        {
+            manifest << "frame " << frame.clip << " " << frame.index << " " << frame.page << " "
+                     << frame.placed.x << " " << frame.placed.y << " "
+                     << frame.trimmed.size.x << " " << frame.trimmed.size.y << " "
+                     << frame.trimmed.position.x << " " << frame.trimmed.position.y << " "
+                     << frame.image.getSize().x << " " << frame.image.getSize().y << "\n";
+            frameCount++;
+        }
+    }
+    
+    std::cout << "Packed " << frameCount << " frames from " << clips.size() << " clips into " 
+              << pages.size() << " page(s)\n"
+              << "Texture memory: " << sourceBytes / 1024 << " KiB as separate frames, " 
+              << atlasBytes / 1024 << " KiB as atlas" << std::endl;
+    
+    return 0;
+}
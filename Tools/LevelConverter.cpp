@@ -0,0 +1,56 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "../Level/LevelSource.h"
+
+// Converts a text level (format in Level/LevelSource.h) to the binary .lvl
+// format, or generates a synthetic level for load/collision benchmarks.
+//
+// Usage: LevelConverter <input.txt> <output.lvl>
+//        LevelConverter --generate <platforms> <output.lvl> [output.txt]
+//        LevelConverter --chunks <input.txt> <output directory> [chunk width]   (default: 2048)
+
+
+int main(int argc, char* argv[])
+{
+    if (argc >= 4 && std::string(argv[1]) == "--generate") 
+    {
+        LevelSource level = LevelSource::generate(std::strtoul(argv[2], nullptr, 10));
+        if (!level.writeBinary(argv[3]) || (argc >= 5 && !level.writeText(argv[4]))) 
+        {
+            return 1;
+        }
+        std::cout << "Generated " << level.platformX.size() << " platforms" << std::endl;
+        return 0;
+    }
+    
+    if (argc >= 4 && std::string(argv[1]) == "--chunks") 
+    {
+        float chunkWidth = argc >= 5 ? std::strtof(argv[4], nullptr) : 2048.0f;
+        LevelSource level;
+        if (!level.loadFromText(argv[2]) || !level.writeChunks(argv[3], chunkWidth)) 
+        {
+            return 1;
+        }
+        std::cout << "Wrote " << level.platformX.size() << " platforms in " << chunkWidth 
+                  << " px chunks to " << argv[3] << std::endl;
+        return 0;
+    }
+    
+    if (argc != 3) 
+    {
+        std::cerr << "Usage: LevelConverter <input.txt> <output.lvl>\n"
+                  << "       LevelConverter --generate <platforms> <output.lvl> [output.txt]\n"
+                  << "       LevelConverter --chunks <input.txt> <output directory> [chunk width]" << std::endl;
+        return 1;
+    }
+    
+    LevelSource level;
+    if (!level.loadFromText(argv[1]) || !level.writeBinary(argv[2])) 
+    {
+        return 1;
+    }
+    std::cout << "Wrote " << level.platformX.size() << " platforms and " 
+              << level.spawns.size() << " spawns to " << argv[2] << std::endl;
+    return 0;
+}
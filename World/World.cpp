@@ -0,0 +1,464 @@
+#include "World.h"
+#include "../Profiling/Profiler.h"
+#include <cmath>
+#include <cstring>
+
+World::World(float playerX, float playerY)
+    : player(playerX, playerY),
+      enemies(MAX_ENEMIES),
+      projectiles(MAX_PROJECTILES)
+{
+    Platform::createPlatforms(platforms);
+    rebuildCollisionIndex();
+}
+
+void World::step(const InputFrame& input)
+{
+    PROFILE_SCOPE("World::step");
+    
+    // Keep the chunks around the player resident (only waits for the disk
+    // when asked to)
+    if (streamer) 
+    {
+        PROFILE_SCOPE("ChunkStreamer::update");
+        if (waitForChunks) 
+        {
+            streamer->waitUntilReady(player.getPosition().x);
+        }
+        else 
+        {
+            streamer->update(player.getPosition().x);
+        }
+        syncChunks();
+    }
+    
+    simulatePlayer(player, collisionHandler, input);
+    
+    // Point grounded enemies at the player's new position
+    if (navigator) 
+    {
+        sf::FloatRect bounds = player.getGlobalBounds();
+        sf::Vector2f target(player.getPosition().x, bounds.position.y + bounds.size.y);
+        if (aiScheduler) 
+        {
+            PROFILE_SCOPE("AIScheduler::run");
+            aiScheduler->run(enemies, *navigator, platformGrid, target);
+        }
+        else 
+        {
+            PROFILE_SCOPE("EnemyNavigator::steer");
+            navigator->steer(enemies, platformGrid, target);
+        }
+    }
+    
+    // Enemies are independent of each other, so these may run on workers
+    {
+        PROFILE_SCOPE("EnemyPool::update");
+        if (jobs) 
+        {
+            enemies.update(TIMESTEP, *jobs);
+        }
+        else 
+        {
+            enemies.update(TIMESTEP);
+        }
+    }
+    {
+        PROFILE_SCOPE("EnemyPool::collide");
+        if (continuousCollision) 
+        {
+            if (jobs) 
+            {
+                enemies.sweep(platformGrid, TIMESTEP, *jobs);
+            }
+            else 
+            {
+                enemies.sweep(platformGrid, TIMESTEP);
+            }
+        }
+        if (jobs) 
+        {
+            enemies.collide(platformGrid, *jobs);
+        }
+        else 
+        {
+            enemies.collide(platformGrid);
+        }
+    }
+    
+    // Player/enemy and enemy/enemy overlaps for hit detection
+    {
+        PROFILE_SCOPE("SweepAndPrune::update");
+        findEntityContacts();
+    }
+    
+    // Projectiles cast against the platforms and this tick's entity bounds
+    projectileHits.clear();
+    if (projectiles.size() > 0) 
+    {
+        PROFILE_SCOPE("ProjectilePool::update");
+        entityGrid.build(entityBounds);
+        if (jobs) 
+        {
+            projectiles.update(TIMESTEP, platformGrid, entityGrid, 1, projectileHits, *jobs);
+        }
+        else 
+        {
+            projectiles.update(TIMESTEP, platformGrid, entityGrid, 1, projectileHits);
+        }
+    }
+    
+    tickCount++;
+}
+
+void World::simulatePlayer(Player& body, Collision& collision, const InputFrame& input)
+{
+    // Handle user input
+    {
+        PROFILE_SCOPE("input");
+        body.velocity.x = 0; // Reset horizontal velocity
+        
+        if (input.left) 
+        {
+            body.velocity.x = -body.RUN_SPEED;
+        }
+        if (input.right) 
+        {
+            body.velocity.x = body.RUN_SPEED;
+        }
+        if (input.jump) 
+        {
+            body.jump();
+        }
+    }
+    
+    // Update player (position, velocity, etc.)
+    sf::Vector2f start = body.getPosition();
+    {
+        PROFILE_SCOPE("Player::update");
+        body.update(TIMESTEP);
+    }
+    
+    // Check collisions with the platforms near the player; the sweep keeps
+    // fast moves from skipping through platforms, overlap resolution then
+    // fixes anything that started the tick inside a platform
+    {
+        PROFILE_SCOPE("collision");
+        if (continuousCollision) 
+        {
+            collision.sweepPlayer(body, start, platformGrid);
+        }
+        collision.handleCollisions(body, platformGrid);
+    }
+    
+    // Update animation state AFTER collision detection
+    // This ensures onGround is correctly set before determining animation
+    {
+        PROFILE_SCOPE("Player::updateAnimationState");
+        body.updateAnimationState();
+    }
+    
+    // Update the animation AFTER state is determined to avoid flashing
+    {
+        PROFILE_SCOPE("Player::updateAnimation");
+        body.updateAnimation(TIMESTEP);
+    }
+    
+    // Keep the player inside the world horizontally
+    sf::Vector2f playerPos = body.getPosition();
+    if (playerPos.x < 0) 
+    {
+        body.setPosition(sf::Vector2f(0, playerPos.y));
+    }
+    if (playerPos.x > worldWidth) 
+    {
+        body.setPosition(sf::Vector2f(worldWidth, playerPos.y));
+    }
+}
+
+void World::findEntityContacts()
+{
+    entityBounds.clear();
+    entityBounds.push(player.getGlobalBounds());
+    for (std::size_t i = 0; i < enemies.size(); i++) 
+    {
+        entityBounds.push(enemies.getBounds(i));
+    }
+    entityBroadphase.update(entityBounds);
+    
+    enemiesTouchingPlayer.clear();
+    for (const EntityPair& pair : entityBroadphase.getPairs()) 
+    {
+        if (pair.first == 0) 
+        {
+            enemiesTouchingPlayer.push_back(pair.second - 1);
+        }
+    }
+}
+
+int World::advance(float frameTime, const InputFrame& input)
+{
+    HeldInput held(input);
+    return advance(frameTime, held);
+}
+
+int World::advance(float frameTime, InputSource& source)
+{
+    accumulator += frameTime;
+    
+    int steps = 0;
+    while (accumulator >= TIMESTEP && steps < MAX_STEPS_PER_ADVANCE && !source.exhausted()) 
+    {
+        step(source.next());
+        accumulator -= TIMESTEP;
+        steps++;
+    }
+    
+    // Drop time we could not catch up on instead of carrying it forever
+    if (steps == MAX_STEPS_PER_ADVANCE && accumulator >= TIMESTEP) 
+    {
+        accumulator = 0.0f;
+    }
+    
+    return steps;
+}
+
+std::uint64_t World::checksum() const
+{
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](const void* data, std::size_t size) 
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; i++) 
+        {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    };
+    
+    // Hash exact float bits so any drift, even -0 vs +0, shows up
+    float values[4] = { player.position.x, player.position.y, player.velocity.x, player.velocity.y };
+    std::uint32_t bits[4];
+    std::memcpy(bits, values, sizeof(bits));
+    mix(bits, sizeof(bits));
+    
+    std::uint8_t flags[3] = { 
+        static_cast<std::uint8_t>(player.onGround), 
+        static_cast<std::uint8_t>(player.facingRight), 
+        static_cast<std::uint8_t>(player.currentState) 
+    };
+    mix(flags, sizeof(flags));
+    
+    for (const std::vector<float>* column : { &enemies.positionX, &enemies.positionY, &enemies.velocityX, &enemies.velocityY }) 
+    {
+        mix(column->data(), enemies.size() * sizeof(float));
+    }
+    for (const std::vector<float>* column : { &projectiles.positionX, &projectiles.positionY, &projectiles.velocityX, &projectiles.velocityY }) 
+    {
+        mix(column->data(), projectiles.size() * sizeof(float));
+    }
+    mix(&tickCount, sizeof(tickCount));
+    return hash;
+}
+
+void World::saveState(WorldState& state) const
+{
+    PROFILE_SCOPE("World::saveState");
+    
+    WorldStateHeader header;
+    std::memcpy(header.magic, WORLD_STATE_MAGIC, sizeof(header.magic));
+    header.version = WorldState::VERSION;
+    header.enemyBytes = enemies.stateSize();
+    header.size = sizeof(header) + header.enemyBytes + projectiles.stateSize();
+    header.tickCount = tickCount;
+    header.checksum = checksum();
+    header.accumulator = accumulator;
+    header.playerX = player.position.x;
+    header.playerY = player.position.y;
+    header.playerVelocityX = player.velocity.x;
+    header.playerVelocityY = player.velocity.y;
+    header.playerFrameTime = player.currentAnimation ? player.currentAnimation->frameTime : 0.0f;
+    header.playerFrame = player.currentAnimation ? player.currentAnimation->getCurrentFrame() : 0;
+    header.playerState = static_cast<std::uint8_t>(player.currentState);
+    header.playerOnGround = static_cast<std::uint8_t>(player.onGround);
+    header.playerFacingRight = static_cast<std::uint8_t>(player.facingRight);
+    header.playerAnimating = static_cast<std::uint8_t>(player.currentAnimation && player.currentAnimation->isPlaying);
+    header.playerContacts = collisionHandler.playerContacts;
+    
+    state.bytes.resize(header.size);
+    std::memcpy(state.bytes.data(), &header, sizeof(header));
+    enemies.writeState(state.bytes.data() + sizeof(header));
+    projectiles.writeState(state.bytes.data() + sizeof(header) + header.enemyBytes);
+}
+
+bool World::restoreState(const WorldState& state)
+{
+    PROFILE_SCOPE("World::restoreState");
+    
+    if (!state.isValid() || state.header().playerState > static_cast<std::uint8_t>(PlayerState::JUMP)) 
+    {
+        return false;
+    }
+    const WorldStateHeader header = state.header();
+    const std::uint8_t* enemyBlock = state.bytes.data() + sizeof(header);
+    std::size_t blocks = state.bytes.size() - sizeof(header);
+    if (header.enemyBytes > blocks) 
+    {
+        return false;
+    }
+    const std::uint8_t* projectileBlock = enemyBlock + header.enemyBytes;
+    std::size_t projectileBytes = blocks - header.enemyBytes;
+    
+    // Nothing changes until everything has been checked, so a bad state
+    // leaves the world as it was instead of half restored: the enemy pool
+    // validates its block before copying any of it, and is read last
+    if (!std::isfinite(header.playerX) || !std::isfinite(header.playerY) || 
+        !std::isfinite(header.playerVelocityX) || !std::isfinite(header.playerVelocityY) || 
+        !header.playerContacts.fits(platformGrid.version, platformGrid.size()) || 
+        !projectiles.validateState(projectileBlock, projectileBytes) || 
+        !enemies.readState(enemyBlock, header.enemyBytes, platformGrid)) 
+    {
+        return false;
+    }
+    projectiles.readState(projectileBlock, projectileBytes);
+    
+    tickCount = header.tickCount;
+    accumulator = header.accumulator;
+    
+    // setPose switches the animation (resetting it on a change) and moves
+    // the sprites; the frame time is not part of a pose
+    player.setPose(static_cast<PlayerState>(header.playerState), header.playerFrame, 
+                   header.playerFacingRight != 0, sf::Vector2f(header.playerX, header.playerY));
+    if (player.currentAnimation) 
+    {
+        player.currentAnimation->frameTime = header.playerFrameTime;
+        player.currentAnimation->isPlaying = header.playerAnimating != 0;
+    }
+    player.velocity = sf::Vector2f(header.playerVelocityX, header.playerVelocityY);
+    player.onGround = header.playerOnGround != 0;
+    collisionHandler.playerContacts = header.playerContacts;
+    
+    // Refilled by the next step(); the broadphase's sort order is only a
+    // starting point, so it is left as it is
+    enemiesTouchingPlayer.clear();
+    projectileHits.clear();
+    return true;
+}
+
+void World::loadLevel(const LevelFile& level)
+{
+    const LevelHeader& header = level.header();
+    streamer = nullptr;
+    worldWidth = header.worldWidth;
+    player.setPosition(sf::Vector2f(header.playerX, header.playerY));
+    player.velocity = sf::Vector2f(0.f, 0.f);
+    
+    // Grid reads the mapped arrays in place
+    platformGrid.build(level.platformX(), level.platformY(), 
+                       level.platformWidth(), level.platformHeight(), 
+                       level.platformCount());
+    level.createPlatforms(platforms);
+    
+    enemies.clear();
+    entityBroadphase.clear();
+    projectiles.clear();
+    projectileHits.clear();
+    const EnemySpawn* spawns = level.spawns();
+    for (std::size_t i = 0; i < level.spawnCount(); i++) 
+    {
+        if (spawns[i].type < static_cast<std::uint32_t>(EnemyType::COUNT)) 
+        {
+            enemies.spawn(static_cast<EnemyType>(spawns[i].type), sf::Vector2f(spawns[i].x, spawns[i].y));
+        }
+    }
+}
+
+void World::attachStreamer(ChunkStreamer& chunkStreamer)
+{
+    streamer = &chunkStreamer;
+    const ChunkIndexHeader& header = chunkStreamer.header();
+    worldWidth = header.worldWidth;
+    player.setPosition(sf::Vector2f(header.playerX, header.playerY));
+    player.velocity = sf::Vector2f(0.f, 0.f);
+    
+    platforms.clear();
+    platformGrid.build(nullptr, 0);
+    enemies.clear();
+    entityBroadphase.clear();
+    projectiles.clear();
+    projectileHits.clear();
+    appliedChunks = nullptr;
+    chunkGeneration = 0;
+    syncChunks();
+}
+
+void World::syncChunks()
+{
+    std::uint64_t generation = streamer->getGeneration();
+    if (generation == chunkGeneration) 
+    {
+        return;
+    }
+    chunkGeneration = generation;
+    std::shared_ptr<const ChunkSet> chunks = streamer->getResident();
+    
+    // Both sets are sorted by index: walk them together to find what changed
+    static const ChunkSet none;
+    const ChunkSet& before = appliedChunks ? *appliedChunks : none;
+    std::size_t b = 0;
+    std::size_t a = 0;
+    while (b < before.size() || a < chunks->size()) 
+    {
+        bool evicted = a == chunks->size() || (b < before.size() && before[b]->index < (*chunks)[a]->index);
+        bool loaded = b == before.size() || (a < chunks->size() && (*chunks)[a]->index < before[b]->index);
+        if (evicted) 
+        {
+            // Enemies go with the chunk they are standing in
+            const LevelChunk& chunk = *before[b++];
+            for (std::size_t i = enemies.size(); i > 0; i--) 
+            {
+                if (enemies.positionX[i - 1] >= chunk.left && enemies.positionX[i - 1] < chunk.right) 
+                {
+                    enemies.despawn(enemies.handleAt(i - 1));
+                }
+            }
+        }
+        else if (loaded) 
+        {
+            const LevelChunk& chunk = *(*chunks)[a++];
+            for (const EnemySpawn& spawn : chunk.spawns) 
+            {
+                if (spawn.type < static_cast<std::uint32_t>(EnemyType::COUNT)) 
+                {
+                    enemies.spawn(static_cast<EnemyType>(spawn.type), sf::Vector2f(spawn.x, spawn.y));
+                }
+            }
+        }
+        else 
+        {
+            a++;
+            b++;
+        }
+    }
+    appliedChunks = chunks;
+    
+    chunkPlatforms.clear();
+    for (const auto& chunk : *chunks) 
+    {
+        for (std::size_t i = 0; i < chunk->platformX.size(); i++) 
+        {
+            chunkPlatforms.push_back(sf::FloatRect(sf::Vector2f(chunk->platformX[i], chunk->platformY[i]), 
+                                                   sf::Vector2f(chunk->platformWidth[i], chunk->platformHeight[i])));
+        }
+    }
+    platformGrid.build(chunkPlatforms.data(), chunkPlatforms.size());
+}
+
+void World::rebuildCollisionIndex()
+{
+    platformGrid.build(platforms);
+}
+
+float World::getInterpolationAlpha() const
+{
+    return accumulator / TIMESTEP;
+}
@@ -0,0 +1,321 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "../Player/Player.h"
+#include "../Platform/Platform.h"
+#include "../Physics/Collision.h"
+#include "../Physics/SpatialGrid.h"
+#include "../Physics/SweepAndPrune.h"
+#include "../Level/LevelFile.h"
+#include "../Level/ChunkStreamer.h"
+#include "../Input/InputSource.h"
+#include "../Enemy/EnemyPool.h"
+#include "../Jobs/JobSystem.h"
+#include "../Nav/EnemyNavigator.h"
+#include "../AI/AIScheduler.h"
+#include "../Projectile/ProjectilePool.h"
+#include "WorldState.h"
+
+/**
+ * @class World
+ * @brief Owns the simulation state and advances it with a fixed timestep
+ * 
+ * The world holds the player, the enemy and projectile pools, the platform
+ * list and the collision handler, and runs input, physics, collision and
+ * animation state for one tick at a time. Nothing in here touches a
+ * window, so the same code runs in the windowed game and in the headless
+ * executable.
+ * 
+ * @note World is neither copyable nor movable because Player keeps a pointer
+ *       to one of its own Animation members.
+ * 
+ * @example
+ * @code
+ * World world;
+ * 
+ * // In game loop:
+ * world.advance(frameSeconds, input);
+ * window.draw(world.player.getSprite());
+ * @endcode
+ */
+class World
+{
+public:
+    /** @brief Length of one simulation tick in seconds (120 Hz) */
+    static constexpr float TIMESTEP = 1.0f / 120.0f;
+    
+    /** @brief Upper bound on ticks run by a single advance() call */
+    static constexpr int MAX_STEPS_PER_ADVANCE = 8;
+    
+    /** @brief Capacity of the enemy pool */
+    static constexpr std::size_t MAX_ENEMIES = 65536;
+    
+    /** @brief Capacity of the projectile pool */
+    static constexpr std::size_t MAX_PROJECTILES = 32768;
+    
+    /**
+     * @brief Constructs the world with the default level layout
+     * 
+     * @param playerX Initial player X position (center point)
+     * @param playerY Initial player Y position (center point)
+     */
+    World(float playerX = 20.0f, float playerY = 550.0f);
+    
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+    
+    /**
+     * @brief Advances the simulation by exactly one tick of TIMESTEP seconds
+     * 
+     * Order matches the original game loop: input, player update, collision,
+     * animation state, animation advance, world bounds; enemies then update
+     * and collide (in parallel if a job system is set), after being
+     * steered towards the player if a navigator is set (through the AI
+     * scheduler if there is one). Then the entity broadphase finds which
+     * enemies the player touches. Finally projectiles fly, stopping at
+     * platforms and entities (projectileHits).
+     * 
+     * @param input Input held during this tick
+     */
+    void step(const InputFrame& input);
+    
+    /**
+     * @brief Runs the player part of step() for any player body
+     * 
+     * Input, movement, platform collision, animation state and the world
+     * bounds, exactly as step() applies them to player. Lets a server move
+     * many players through one level, and a client predict its own.
+     * 
+     * @param body      Player to move
+     * @param collision Collision handler owned by that player (holds its contact cache)
+     * @param input     Input held during this tick
+     */
+    void simulatePlayer(Player& body, Collision& collision, const InputFrame& input);
+    
+    /**
+     * @brief Feeds variable frame time into the fixed-timestep accumulator
+     * 
+     * Runs as many whole ticks as fit into the accumulated time, capped at
+     * MAX_STEPS_PER_ADVANCE so a long stall cannot spiral.
+     * 
+     * @param frameTime Wall-clock time since the previous call in seconds
+     * @param input     Input held during this frame (applied to every tick)
+     * @return Number of ticks that were run
+     */
+    int advance(float frameTime, const InputFrame& input);
+    
+    /**
+     * @brief Same as advance(), but pulls a fresh input for every tick
+     * 
+     * Stops early once the source is exhausted, so a replay runs exactly
+     * the ticks it recorded.
+     * 
+     * @param frameTime Wall-clock time since the previous call in seconds
+     * @param source    Supplies one InputFrame per tick (keyboard, recorder, replay)
+     * @return Number of ticks that were run
+     */
+    int advance(float frameTime, InputSource& source);
+    
+    /**
+     * @brief Hash of the simulation state that input can affect
+     * 
+     * Covers the player's position, velocity, flags and animation state,
+     * every enemy's and projectile's position and velocity, and the tick
+     * count, bit for bit. Animation frames are left out because headless
+     * runs load no clips. Two runs that agree on this value after the same
+     * ticks have not diverged.
+     * 
+     * @return 64-bit FNV-1a hash
+     */
+    std::uint64_t checksum() const;
+    
+    /**
+     * @brief Captures all mutable simulation state into a flat buffer
+     * 
+     * The player (position, velocity, flags, animation state, frame and
+     * frame time, contact cache), every enemy with its handle slot, contact
+     * cache and AI plan, every projectile, tickCount and accumulator, plus
+     * checksum() for desync detection. The buffer is reused, so saving
+     * every tick into a ring of states stops allocating once the buffers
+     * have grown.
+     * 
+     * Level geometry, the streamer and settings such as continuousCollision
+     * are not captured.
+     * 
+     * @param state Receives the state (previous contents are replaced)
+     */
+    void saveState(WorldState& state) const;
+    
+    /**
+     * @brief Puts the simulation back to a state taken by saveState()
+     * 
+     * Afterwards checksum() equals state.getChecksum(), enemy handles are
+     * valid exactly when they were at the save, and stepping with the same
+     * inputs repeats the original ticks bit for bit. enemiesTouchingPlayer
+     * and projectileHits are empty until the next step().
+     * 
+     * @param state A state saved from a world with the same level
+     * @return false if the state is invalid, names platforms the level
+     *         does not have or does not fit the enemy or projectile pool
+     *         (the world is then unchanged)
+     */
+    bool restoreState(const WorldState& state);
+    
+    /**
+     * @brief Replaces the level with one loaded from a mapped level file
+     * 
+     * Moves the player to the level's spawn, takes over its world width,
+     * builds the collision grid straight from the file's platform arrays and
+     * replaces the enemies with the level's spawn table. Projectiles in
+     * flight are dropped. The platform list is recreated for rendering.
+     * 
+     * @param level An open LevelFile
+     */
+    void loadLevel(const LevelFile& level);
+    
+    /**
+     * @brief Switches to a streamed level
+     * 
+     * Moves the player to the level's spawn, takes over its world width and
+     * drops every enemy and projectile. From then on every step() moves the
+     * streamer's load window to the player and, when the resident chunks
+     * change, rebuilds the collision grid from them, spawns the enemies of
+     * newly resident chunks and despawns the enemies standing in evicted
+     * ones. platforms is left empty; renderers read the streamer's resident
+     * set instead.
+     * 
+     * @param chunkStreamer An open streamer (not owned; must outlive the world's use of it)
+     */
+    void attachStreamer(ChunkStreamer& chunkStreamer);
+    
+    /**
+     * @brief Rebuilds the platform broadphase from the platform list
+     * 
+     * Call after adding, removing or moving platforms.
+     */
+    void rebuildCollisionIndex();
+    
+    /**
+     * @brief Fraction of a tick left in the accumulator (0..1)
+     * 
+     * @return Accumulated time divided by TIMESTEP, for render interpolation
+     */
+    float getInterpolationAlpha() const;
+    
+    /// @name Simulation State
+    /// @{
+    
+    /** @brief The player character */
+    Player player;
+    
+    /** @brief Enemies spawned by the level */
+    EnemyPool enemies;
+    
+    /** @brief Fireballs, bolts and slashes in flight; spawn into it to fire */
+    ProjectilePool projectiles;
+    
+    /**
+     * @brief Projectiles that struck something during the last step()
+     * 
+     * Targets index entities the way entityBroadphase does.
+     */
+    std::vector<ProjectileHit> projectileHits;
+    
+    /** @brief Static level geometry */
+    std::vector<Platform> platforms;
+    
+    /** @brief Collision handler from physics/ */
+    Collision collisionHandler;
+    
+    /** @brief Broadphase over platforms, built once from the platform list */
+    SpatialGrid platformGrid;
+    
+    /** @brief Broadphase over moving entities: index 0 is the player, 1 + i is enemy i */
+    SweepAndPrune entityBroadphase;
+    
+    /** @brief Dense indices of the enemies overlapping the player after the last step() */
+    std::vector<std::size_t> enemiesTouchingPlayer;
+    
+    /** @brief Horizontal extent the player is clamped to (0..worldWidth) */
+    float worldWidth = 800.0f;
+    
+    /** @brief Number of ticks simulated since construction */
+    unsigned long long tickCount = 0;
+    
+    /** @brief Unsimulated time carried over between advance() calls */
+    float accumulator = 0.0f;
+    
+    /** 
+     * @brief Sweep movement against platforms before resolving overlaps
+     * 
+     * Prevents tunneling at low tick rates and high speeds. With it off the
+     * world uses overlap resolution only, as it originally did.
+     */
+    bool continuousCollision = true;
+    
+    /** @brief Streams the level around the player when set (see attachStreamer) */
+    ChunkStreamer* streamer = nullptr;
+    
+    /** 
+     * @brief Makes step() wait until the chunks around the player are resident
+     * 
+     * Off, step() never waits for the disk, and a chunk that is still
+     * loading is not there to collide with, so the outcome of a tick can
+     * depend on load times. On, every tick starts with the whole load
+     * window resident, which makes streamed runs repeat exactly; set it
+     * when recording, replaying or running headless.
+     */
+    bool waitForChunks = false;
+    
+    /** 
+     * @brief Runs the per-enemy phases in parallel when set (not owned)
+     * 
+     * step() returns only after every chunk has finished, so rendering
+     * always sees a complete tick. Results do not depend on thread count.
+     */
+    JobSystem* jobs = nullptr;
+    
+    /** 
+     * @brief Makes enemies chase the player when set (not owned)
+     * 
+     * Steering runs after the player has moved and before the enemies do.
+     * Without it enemies keep whatever velocity they were spawned with.
+     */
+    EnemyNavigator* navigator = nullptr;
+    
+    /** 
+     * @brief Spreads the navigator's decisions over ticks when set (not owned)
+     * 
+     * Only used with a navigator. Without it every grounded enemy thinks
+     * on every tick (EnemyNavigator::steer()).
+     */
+    AIScheduler* aiScheduler = nullptr;
+    
+    /// @}
+    
+private:
+    /** @brief Runs the entity broadphase and fills enemiesTouchingPlayer */
+    void findEntityContacts();
+    
+    /** @brief Player and enemy bounds fed to entityBroadphase, reused every tick */
+    AabbArrays entityBounds;
+    
+    /**
+     * @brief entityBounds bucketed for projectile casts
+     * 
+     * Only built on ticks that have projectiles in flight.
+     */
+    SpatialGrid entityGrid;
+    
+    /** @brief Applies a changed resident chunk set to the grid and enemies */
+    void syncChunks();
+    
+    /** @brief Streamer generation last applied by syncChunks() */
+    std::uint64_t chunkGeneration = 0;
+    
+    /** @brief Chunks whose platforms and enemies are in the world */
+    std::shared_ptr<const ChunkSet> appliedChunks;
+    
+    /** @brief Platform bounds of appliedChunks, as fed to the grid */
+    std::vector<sf::FloatRect> chunkPlatforms;
+};
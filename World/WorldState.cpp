@@ -0,0 +1,66 @@
+#include "WorldState.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+bool WorldState::isValid() const
+{
+    if (bytes.size() < sizeof(WorldStateHeader)) 
+    {
+        return false;
+    }
+    WorldStateHeader fixed = header();
+    return std::memcmp(fixed.magic, WORLD_STATE_MAGIC, sizeof(WORLD_STATE_MAGIC)) == 0 &&
+           fixed.version == VERSION &&
+           fixed.size == bytes.size();
+}
+
+WorldStateHeader WorldState::header() const
+{
+    WorldStateHeader fixed;
+    std::memcpy(&fixed, bytes.data(), sizeof(fixed));
+    return fixed;
+}
+
+std::uint64_t WorldState::getChecksum() const
+{
+    return header().checksum;
+}
+
+unsigned long long WorldState::getTick() const
+{
+    return header().tickCount;
+}
+
+bool WorldState::saveToFile(const std::string& path) const
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) 
+    {
+        std::cerr << "Failed to write world state: " << path << std::endl;
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    return static_cast<bool>(out);
+}
+
+bool WorldState::loadFromFile(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) 
+    {
+        std::cerr << "Failed to open world state: " << path << std::endl;
+        return false;
+    }
+    
+    std::streamoff size = in.tellg();
+    in.seekg(0);
+    bytes.resize(static_cast<std::size_t>(size));
+    if (!in.read(reinterpret_cast<char*>(bytes.data()), size) || !isValid()) 
+    {
+        std::cerr << "Not a world state (or wrong version): " << path << std::endl;
+        bytes.clear();
+        return false;
+    }
+    return true;
+}
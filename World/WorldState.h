@@ -0,0 +1,102 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../Physics/ContactCache.h"
+
+/** @brief Magic bytes at the start of every saved world state */
+constexpr char WORLD_STATE_MAGIC[4] = { 'W', 'S', 'T', 'B' };
+
+/**
+ * @struct WorldStateHeader
+ * @brief Fixed part of a WorldState: tick, checksum and the player
+ * 
+ * Only plain values; the player's animation is reduced to its state,
+ * frame and frame time, which is all the simulation reads back.
+ */
+struct WorldStateHeader
+{
+    char magic[4];                   ///< WORLD_STATE_MAGIC
+    std::uint32_t version;           ///< WorldState::VERSION
+    std::uint64_t size;              ///< Total bytes, this header included
+    std::uint64_t tickCount;         ///< World::tickCount
+    std::uint64_t checksum;          ///< World::checksum() when saved
+    std::uint64_t enemyBytes;        ///< Size of the enemy block that follows the header
+    float accumulator;               ///< World::accumulator
+    float playerX;                   ///< Player center
+    float playerY;
+    float playerVelocityX;           ///< Pixels per second
+    float playerVelocityY;
+    float playerFrameTime;           ///< Time into the current animation frame
+    std::uint32_t playerFrame;       ///< Current animation frame
+    std::uint8_t playerState;        ///< PlayerState
+    std::uint8_t playerOnGround;
+    std::uint8_t playerFacingRight;
+    std::uint8_t playerAnimating;    ///< Current animation's isPlaying
+    ContactCache playerContacts;     ///< World::collisionHandler's cache
+};
+
+/**
+ * @class WorldState
+ * @brief All mutable simulation state of a World in one flat buffer
+ * 
+ * Filled by World::saveState() and applied by World::restoreState(). The
+ * buffer holds no pointers: a WorldStateHeader followed by the enemy pool's
+ * columns and slot tables (EnemyPool::writeState()) and the projectile
+ * pool's columns (ProjectilePool::writeState()), so saving and restoring
+ * are a handful of memcpy calls. Its size follows the number of enemies
+ * and projectiles, not the pools' capacities.
+ * 
+ * Level geometry is not part of the state; restore into a world that has
+ * the level the state was saved with. Files written by saveToFile() are
+ * meant for the same build on the same machine (raw, native-endian).
+ * 
+ * @example
+ * @code
+ * // Rollback: keep one state per tick, then on a late input
+ * world.restoreState(history[lateTick % HISTORY]);
+ * for (tick = lateTick; tick < now; tick++) world.step(inputs[tick]);
+ * @endcode
+ */
+class WorldState
+{
+public:
+    /** @brief Current layout version; bump on any layout change */
+    static constexpr std::uint32_t VERSION = 3;
+    
+    /**
+     * @brief Checks that the buffer holds a complete state of this version
+     */
+    bool isValid() const;
+    
+    /**
+     * @brief Copy of the fixed header (call isValid() first)
+     */
+    WorldStateHeader header() const;
+    
+    /** @brief World::checksum() at the time of the save, for desync checks */
+    std::uint64_t getChecksum() const;
+    
+    /** @brief World::tickCount at the time of the save */
+    unsigned long long getTick() const;
+    
+    /**
+     * @brief Writes the state to disk as a save-state
+     * 
+     * @param path Output path (e.g. "quick.sav")
+     * @return true if the file was written
+     */
+    bool saveToFile(const std::string& path) const;
+    
+    /**
+     * @brief Replaces this state with one read from disk
+     * 
+     * @param path Path to a file written by saveToFile()
+     * @return true if the file held a valid state
+     */
+    bool loadFromFile(const std::string& path);
+    
+    /** @brief Header followed by the enemy pool's and the projectile pool's state blocks */
+    std::vector<std::uint8_t> bytes;
+};
@@ -0,0 +1,227 @@
+#include <SFML/System.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "World/World.h"
+#include "Level/LevelFile.h"
+#include "Level/ChunkStreamer.h"
+#include <filesystem>
+#include "Input/InputRecording.h"
+#include "Jobs/JobSystem.h"
+
+// Headless simulation runner: steps the world as fast as possible with no
+// window, textures or vsync. Useful for profiling the sim on CI boxes.
+// --replay runs a recorded session and exits non-zero if its final
+// checksum does not match; --record saves the scripted run as a session.
+// --threads sets the job system size for the enemy phases (1 = serial).
+// --chase makes the enemies chase the player as in the game, with their
+// decisions spread over ticks by the AI scheduler; replays of sessions
+// recorded in the game need it. --ai-budget gives the scheduler a time
+// budget in microseconds per tick instead of its fixed think count, which
+// makes the results depend on machine speed.
+// A directory written by LevelConverter --chunks is streamed; each tick
+// waits for the chunks around the player so results do not depend on disk
+// speed, and the streaming stats are printed at the end.
+//
+// Usage: headless [ticks] [level.lvl | chunk directory] [--record out.inp | --replay in.inp] [--threads N] [--chase [--ai-budget US]]
+//        (default: 10000000, built-in level, one thread per core)
+
+
+// Deterministic scripted input: run back and forth and jump periodically
+class ScriptedInput : public InputSource
+{
+public:
+    InputFrame next() override
+    {
+        InputFrame input;
+        unsigned long long phase = tick % 480;
+        input.right = phase < 240;
+        input.left = phase >= 240;
+        input.jump = (tick % 90) == 0;
+        tick++;
+        return input;
+    }
+    
+private:
+    unsigned long long tick = 0;
+};
+
+int main(int argc, char* argv[])
+{
+    unsigned long long ticks = 10000000ULL;
+    std::string levelPath;
+    std::string recordPath;
+    std::string replayPath;
+    std::size_t threads = 0;
+    bool chase = false;
+    float aiBudget = 0.0f;
+    int positional = 0;
+    for (int i = 1; i < argc; i++) 
+    {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) 
+        {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc) 
+        {
+            replayPath = argv[++i];
+        }
+        else if (arg == "--threads" && i + 1 < argc) 
+        {
+            threads = std::strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--chase") 
+        {
+            chase = true;
+        }
+        else if (arg == "--ai-budget" && i + 1 < argc) 
+        {
+            aiBudget = std::strtof(argv[++i], nullptr);
+        }
+        else if (positional++ == 0) 
+        {
+            ticks = std::strtoull(arg.c_str(), nullptr, 10);
+        }
+        else 
+        {
+            levelPath = arg;
+        }
+    }
+    
+    World world(100, 400);
+    JobSystem jobs(threads > 0 ? threads - 1 : SIZE_MAX);
+    world.jobs = &jobs;
+    
+    EnemyNavigator navigator;
+    AIScheduler scheduler;
+    scheduler.budgetMicroseconds = aiBudget;
+    if (chase) 
+    {
+        world.navigator = &navigator;
+        world.aiScheduler = &scheduler;
+    }
+    LevelFile level;
+    ChunkStreamer streamer;
+    bool streaming = !levelPath.empty() && std::filesystem::is_directory(levelPath);
+    if (streaming) 
+    {
+        if (!streamer.open(levelPath)) 
+        {
+            return 1;
+        }
+        world.attachStreamer(streamer);
+        world.waitForChunks = true;
+    }
+    else if (!levelPath.empty()) 
+    {
+        if (!level.open(levelPath)) 
+        {
+            return 1;
+        }
+        world.loadLevel(level);
+    }
+    
+    InputRecording recording;
+    if (!replayPath.empty()) 
+    {
+        if (!recording.loadFromFile(replayPath)) 
+        {
+            return 1;
+        }
+        if (recording.timestep != World::TIMESTEP) 
+        {
+            std::cerr << "Recording timestep " << recording.timestep << " does not match " << World::TIMESTEP << std::endl;
+            return 1;
+        }
+        world.player.setPosition(sf::Vector2f(recording.startX, recording.startY));
+        if (recording.initialChecksum != world.checksum()) 
+        {
+            std::cerr << "Warning: replay starts from a different world state (wrong level?)" << std::endl;
+        }
+        ticks = recording.ticks.size();
+    }
+    else 
+    {
+        recording.timestep = World::TIMESTEP;
+        recording.startX = world.player.getPosition().x;
+        recording.startY = world.player.getPosition().y;
+        recording.initialChecksum = world.checksum();
+        recording.ticks.reserve(recordPath.empty() ? 0 : ticks);
+    }
+    
+    ScriptedInput script;
+    InputRecorder recorder(script, recording);
+    InputReplay replay(recording);
+    InputSource& input = !replayPath.empty() ? static_cast<InputSource&>(replay) 
+                       : !recordPath.empty() ? static_cast<InputSource&>(recorder) 
+                       : static_cast<InputSource&>(script);
+    
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long long i = 0; i < ticks; i++) 
+    {
+        world.step(input.next());
+    }
+    auto end = std::chrono::steady_clock::now();
+    
+    double seconds = std::chrono::duration<double>(end - start).count();
+    double ticksPerSecond = seconds > 0.0 ? ticks / seconds : 0.0;
+    sf::Vector2f pos = world.player.getPosition();
+    // Every grid query, plus at most one avoided lookup per body per tick
+    ContactStats contacts = world.enemies.getContactStats();
+    contacts += world.collisionHandler.stats;
+    double perTick = ticks > 0 ? 1.0 / ticks : 0.0;
+    
+    std::cout << "ticks:            " << world.tickCount << "\n"
+              << "simulated time:   " << world.tickCount * World::TIMESTEP << " s\n"
+              << "wall time:        " << seconds << " s\n"
+              << "ticks per second: " << static_cast<unsigned long long>(ticksPerSecond) << "\n"
+              << "threads:          " << jobs.threadCount() << "\n"
+              << "enemies:          " << world.enemies.size() << "\n"
+              << "grid queries:     " << contacts.queries * perTick << " per tick\n"
+              << "queries avoided:  " << contacts.queriesAvoided * perTick << " per tick\n"
+              << "final position:   (" << pos.x << ", " << pos.y << ")\n"
+              << "checksum:         " << std::hex << world.checksum() << std::dec << "\n";
+    
+    if (streaming) 
+    {
+        StreamingStats stream = streamer.getStats();
+        std::cout << "resident chunks:  " << stream.residentChunks << " (" << stream.residentBytes / 1024 << " KB)\n"
+                  << "chunk loads:      " << stream.loadsCompleted << " (" << stream.evictions << " evicted, " 
+                  << stream.loadsDiscarded << " discarded, " << stream.loadsFailed << " failed)\n"
+                  << "load latency:     " << stream.averageLoadMs << " ms avg, " << stream.maxLoadMs << " ms max\n";
+    }
+    if (chase) 
+    {
+        PathCacheStats routes = navigator.pathCache.getStats();
+        std::cout << "nav graph:        " << navigator.graph.spanCount() << " spans, " 
+                  << navigator.graph.linkCount() << " links\n"
+                  << "route lookups:    " << routes.hits << " hits, " << routes.misses << " searches ("
+                  << routes.expanded << " nodes expanded)\n";
+        
+        AISchedulerStats ai = scheduler.getStats();
+        double aiTicks = ai.ticks > 0 ? double(ai.ticks) : 1.0;
+        std::cout << "ai thinks:        " << ai.thinks / aiTicks << " per tick (" << ai.overdueThinks 
+                  << " over budget, longest wait " << ai.longestWait << " ticks)\n"
+                  << "ai deferred:      " << ai.deferred / aiTicks << " per tick\n"
+                  << "ai time:          " << ai.microseconds / aiTicks << " us per tick avg, " 
+                  << ai.worstTickMicroseconds << " us worst\n";
+    }
+    
+    if (!recordPath.empty()) 
+    {
+        recording.finalChecksum = world.checksum();
+        if (!recording.saveToFile(recordPath)) 
+        {
+            return 1;
+        }
+    }
+    if (!replayPath.empty() && world.checksum() != recording.finalChecksum) 
+    {
+        std::cerr << "Replay DIVERGED: expected checksum " << std::hex << recording.finalChecksum << std::dec << std::endl;
+        return 2;
+    }
+    
+    return 0;
+}
@@ -2,112 +2,354 @@
 #include <vector>
 #include <string>
 #include <optional>
-#include "Player/Player.h"
-#include "Platform/Platform.h"
-#include "Physics/Collision.h"
+#include "World/World.h"
+#include "Render/SpriteBatch.h"
+#include "Render/LevelGeometry.h"
+#include "Render/SnapshotRenderer.h"
+#include "Sim/SimulationThread.h"
+#include "Assets/AssetLoader.h"
+#include "Level/LevelFile.h"
+#include "Level/ChunkStreamer.h"
+#include "Input/InputRecording.h"
+#include "Jobs/JobSystem.h"
+#include "Animation/TextureAtlas.h"
+#include "Animation/ClipResidency.h"
+#include "Profiling/Profiler.h"
+#include "Profiling/ProfilerOverlay.h"
+#include <algorithm>
+#include <filesystem>
 #include <iostream>
 
 
+// Sample the keyboard into a simulation input frame
+InputFrame readKeyboard()
+{
+    InputFrame input;
+    input.left = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A) || 
+                 sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left);
+    input.right = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D) || 
+                  sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right);
+    input.jump = sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) || 
+                 sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) ||
+                 sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up);
+    return input;
+}
 
-int main()
+// Usage: main [level.lvl | chunk directory] [--record out.inp | --replay in.inp]   (default: built-in level)
+int main(int argc, char* argv[])
 {
+    std::string levelPath;
+    std::string recordPath;
+    std::string replayPath;
+    for (int i = 1; i < argc; i++) 
+    {
+        std::string arg = argv[i];
+        if (arg == "--record" && i + 1 < argc) 
+        {
+            recordPath = argv[++i];
+        }
+        else if (arg == "--replay" && i + 1 < argc) 
+        {
+            replayPath = argv[++i];
+        }
+        else 
+        {
+            levelPath = arg;
+        }
+    }
+    
     // Create window
     sf::RenderWindow window(sf::VideoMode(sf::Vector2u(800, 600)), "SFML Game");
-    window.setFramerateLimit(75);
-    // Create player
-    Player player(20, 550);
-    // Load all animations once at startup
-    if (!player.loadAllAnimations()) 
+    window.setVerticalSyncEnabled(true); // Physics runs on its own clock now
+    // Create world (player, enemies, platforms and collision handler)
+    World world(20, 550);
+    
+    // Per-enemy phases fan out over one thread per core
+    JobSystem jobs;
+    world.jobs = &jobs;
+    
+    // Enemies chase the player across platforms
+    EnemyNavigator navigator;
+    world.navigator = &navigator;
+    
+    // Their decisions get a millisecond per tick in live play; recorded and
+    // replayed sessions keep the fixed think count so replays stay identical
+    AIScheduler aiScheduler;
+    if (recordPath.empty() && replayPath.empty()) 
     {
-        std::cerr << "Failed to load player animations!" << std::endl;
-        return -1;
+        aiScheduler.budgetMicroseconds = 1000.0f;
+        aiScheduler.maxThinksPerTick = 0;
+    }
+    world.aiScheduler = &aiScheduler;
+    LevelFile level;
+    ChunkStreamer streamer;
+    bool streaming = !levelPath.empty() && std::filesystem::is_directory(levelPath);
+    if (streaming) 
+    {
+        // Long levels stream around the player; only startup waits for the
+        // disk, unless the session is recorded or replayed: then the
+        // simulation thread waits for the chunks too, so the replay sees
+        // the same level on every tick
+        if (!streamer.open(levelPath)) 
+        {
+            return -1;
+        }
+        world.attachStreamer(streamer);
+        world.waitForChunks = !recordPath.empty() || !replayPath.empty();
+        streamer.waitUntilReady(world.player.getPosition().x);
+    }
+    else if (!levelPath.empty()) 
+    {
+        if (!level.open(levelPath)) 
+        {
+            return -1;
+        }
+        world.loadLevel(level);
     }
-    // Create platforms
-    std::vector<Platform> platforms;
-    Platform::createPlatforms(platforms);
     
-    // Collision handler from physics/
-    Collision collisionHandler;
-
-    // Clock for delta time
-    sf::Clock clock;
+    // Per-tick input: live keyboard, optionally recorded, or a replayed session
+    InputRecording recording;
+    if (!replayPath.empty()) 
+    {
+        if (!recording.loadFromFile(replayPath)) 
+        {
+            return -1;
+        }
+        if (recording.timestep != World::TIMESTEP) 
+        {
+            std::cerr << "Recording timestep " << recording.timestep << " does not match " << World::TIMESTEP << std::endl;
+            return -1;
+        }
+        world.player.setPosition(sf::Vector2f(recording.startX, recording.startY));
+        if (recording.initialChecksum != world.checksum()) 
+        {
+            std::cerr << "Warning: replay starts from a different world state (wrong level?)" << std::endl;
+        }
+    }
+    else 
+    {
+        recording.timestep = World::TIMESTEP;
+        recording.startX = world.player.getPosition().x;
+        recording.startY = world.player.getPosition().y;
+        recording.initialChecksum = world.checksum();
+    }
     
-    // Enter game loop
-    while ( window.isOpen() )
+    SharedInput keyboard;
+    InputRecorder recorder(keyboard, recording);
+    InputReplay replay(recording);
+    InputSource& input = !replayPath.empty() ? static_cast<InputSource&>(replay) 
+                       : !recordPath.empty() ? static_cast<InputSource&>(recorder) 
+                       : static_cast<InputSource&>(keyboard);
+    
+    // Decode player sheets on worker threads while a loading bar renders
+    AssetLoader assetLoader;
+    for (const std::string& path : Player::getAnimationPaths()) 
+    {
+        assetLoader.requestTexture(path);
+    }
+    
+    while (window.isOpen() && !assetLoader.isFinished()) 
     {
-        // Calculate delta time
-        float deltaTime = clock.restart().asSeconds();
-        
-        // Handle close event
         while (const std::optional event = window.pollEvent())
         {
             if (event->is<sf::Event::Closed>())
                 window.close();
         }
         
-        // Handle user input
+        // Upload a couple of textures per frame so the bar keeps moving
+        assetLoader.uploadPending(2);
         
-        player.velocity.x = 0; // Reset horizontal velocity
+        sf::RectangleShape barBackground(sf::Vector2f(400, 20));
+        barBackground.setPosition(sf::Vector2f(200, 290));
+        barBackground.setFillColor(sf::Color::Black);
+        sf::RectangleShape barFill(sf::Vector2f(400 * assetLoader.getProgress(), 20));
+        barFill.setPosition(sf::Vector2f(200, 290));
+        barFill.setFillColor(sf::Color::Green);
         
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left)) 
-        {
-            player.velocity.x = -player.RUN_SPEED; 
-        }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right)) 
+        window.clear(sf::Color(135, 206, 235));
+        window.draw(barBackground);
+        window.draw(barFill);
+        window.display();
+    }
+    if (!window.isOpen()) 
+    {
+        return 0;
+    }
+    
+    // Load all animations once at startup (served from the texture cache)
+    if (!world.player.loadAllAnimations()) 
+    {
+        std::cerr << "Failed to load player animations!" << std::endl;
+        return -1;
+    }
+
+    // Enemies are drawn from the packed atlas when one has been built
+    // (Tools/AtlasPacker). Without one, each clip loads from its frame files
+    // when first drawn, and the families in the spawn table load up front.
+    TextureAtlas enemyAtlas;
+    ClipResidency clipResidency(32u << 20);
+    SnapshotRenderer snapshotRenderer;
+    if (world.enemies.size() > 0 && enemyAtlas.loadFromFile("assets/Enemies/atlas.txt")) 
+    {
+        world.enemies.setClips(enemyAtlas);
+        snapshotRenderer.setEnemyClips(world.enemies);
+    }
+    else 
+    {
+        snapshotRenderer.setEnemyClips(clipResidency);
+        if (level.isOpen()) 
         {
-            player.velocity.x = player.RUN_SPEED;
+            snapshotRenderer.prefetchEnemies(level.spawns(), level.spawnCount());
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Space) || 
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) ||
-            sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up)) 
+    }
+    
+    // The render side poses its own copy of the player from snapshots; each
+    // sheet loads when its animation first plays
+    if (!snapshotRenderer.loadPlayer(clipResidency)) 
+    {
+        std::cerr << "Failed to load player animations!" << std::endl;
+        return -1;
+    }
+
+    // Platforms never move: bake them into one vertex buffer (rebuilt when
+    // streamed chunks come and go)
+    LevelGeometry levelGeometry;
+    levelGeometry.build(world.platforms);
+    std::vector<Platform> streamedPlatforms;
+    std::uint64_t levelGeneration = 0;
+    
+    // The camera follows the player and stops at the level's ends
+    const float worldWidth = world.worldWidth;
+
+    // Batches entity sprites into one draw call per texture
+    SpriteBatch spriteBatch;
+
+    // F3 toggles the phase timing overlay, F4 dumps a Chrome trace
+    Profiler& profiler = Profiler::global();
+    ProfilerOverlay profilerOverlay;
+    
+    // From here on the world belongs to the simulation thread
+    SimulationThread simulation(world, input);
+    simulation.start();
+    
+    // Enter game loop
+    while ( window.isOpen() )
+    {
+        // Handle close event
         {
-            player.jump();
+            PROFILE_SCOPE("events");
+            while (const std::optional event = window.pollEvent())
+            {
+                if (event->is<sf::Event::Closed>())
+                    window.close();
+                
+                if (const auto* key = event->getIf<sf::Event::KeyPressed>()) 
+                {
+                    if (key->code == sf::Keyboard::Key::F3) 
+                    {
+                        profilerOverlay.visible = !profilerOverlay.visible;
+                    }
+                    else if (key->code == sf::Keyboard::Key::F4) 
+                    {
+                        // The rings are read without locks: pause the
+                        // simulation (and its job workers) while exporting
+                        simulation.stop();
+                        profiler.writeChromeTrace("trace.json");
+                        simulation.start();
+                    }
+                }
+            }
         }
         
-        // Update player (position, velocity, etc.)
-        player.update(deltaTime);
+        // The simulation thread picks this up on its next tick
+        keyboard.set(readKeyboard());
         
-        // Check collisions with all platforms
-        for (auto& platform : platforms) 
+        // Replays end on their last recorded tick
+        if (simulation.isFinished()) 
         {
-            collisionHandler.handleCollision(player, platform);
+            window.close();
         }
         
-        // Update animation state AFTER collision detection
-        // This ensures onGround is correctly set before determining animation
-        player.updateAnimationState();
-        
-        // Update the animation AFTER state is determined to avoid flashing
-        player.updateAnimation(deltaTime);
-        
-
-        sf::Vector2f playerPos = player.getPosition();
-        if (playerPos.x < 0) 
         {
-            player.setPosition(sf::Vector2f(0, playerPos.y));
+            PROFILE_SCOPE("render");
+            
+            // Newest tick, drawn between it and the tick before
+            simulation.acquire();
+            float alpha = simulation.getAlpha();
+            
+            // Re-bake the level, and prefetch the enemy clips of new chunks,
+            // when the simulation's resident chunks changed
+            if (streaming && streamer.getGeneration() != levelGeneration) 
+            {
+                levelGeneration = streamer.getGeneration();
+                streamedPlatforms.clear();
+                for (const auto& chunk : *streamer.getResident()) 
+                {
+                    snapshotRenderer.prefetchEnemies(chunk->spawns.data(), chunk->spawns.size());
+                    for (std::size_t i = 0; i < chunk->platformX.size(); i++) 
+                    {
+                        streamedPlatforms.push_back(Platform(chunk->platformX[i], chunk->platformY[i], 
+                                                             chunk->platformWidth[i], chunk->platformHeight[i], 
+                                                             sf::Color(chunk->platformColor[i])));
+                    }
+                }
+                levelGeometry.build(streamedPlatforms);
+            }
+            
+            const PlayerSnapshot& shown = simulation.latest().player;
+            float playerX = shown.previousPosition.x + (shown.position.x - shown.previousPosition.x) * alpha;
+            sf::View camera = window.getDefaultView();
+            float halfWidth = camera.getSize().x / 2.0f;
+            camera.setCenter(sf::Vector2f(std::clamp(playerX, halfWidth, std::max(halfWidth, worldWidth - halfWidth)), 
+                                          camera.getCenter().y));
+            window.setView(camera);
+            
+            // Clear screen
+            window.clear(sf::Color(135, 206, 235)); // Random blue sky blue background (need to change to var later)
+             
+            // Draw platforms (one draw call for the whole level)
+            levelGeometry.draw(window);
+            
+            // Draw enemies and the player (automatically uses correct animation based on state)
+            spriteBatch.begin();
+            snapshotRenderer.draw(spriteBatch, simulation.latest(), alpha);
+            spriteBatch.flush(window);
+            
+            profilerOverlay.draw(window, profiler);
         }
-        if (playerPos.x > 800) 
+        
+        // display everything (includes the vsync wait)
         {
-            player.setPosition(sf::Vector2f(800, playerPos.y));
+            PROFILE_SCOPE("display");
+            window.display();
         }
-        
-        // Clear screen
-        window.clear(sf::Color(135, 206, 235)); // Random blue sky blue background (need to change to var later)
-         
-        // Draw platforms
-        for (auto& platform : platforms) 
+        profiler.endFrame();
+    }
+    
+    // Safe to read the world again once the thread has joined
+    simulation.stop();
+    
+    ResidencyStats clips = clipResidency.getStats();
+    std::cout << "Clips: " << clips.residentClips << "/" << clips.declaredClips << " resident (" 
+              << clips.residentBytes / 1024 << " KB), " << clips.hits << " hits, " << clips.misses << " misses, " 
+              << clips.prefetches << " prefetched, " << clips.evictions << " evicted" << std::endl;
+    
+    if (!recordPath.empty()) 
+    {
+        recording.finalChecksum = world.checksum();
+        if (!recording.saveToFile(recordPath)) 
         {
-            window.draw(platform.shape);
+            return -1;
         }
-        
-        // Draw player (automatically uses correct animation based on state)
-        window.draw(player.getSprite());
-        
-        // display everything
-        window.display();
+        std::cout << "Recorded " << recording.ticks.size() << " ticks to " << recordPath << std::endl;
+    }
+    if (!replayPath.empty()) 
+    {
+        bool matched = replay.exhausted() && world.checksum() == recording.finalChecksum;
+        std::cout << "Replayed " << replay.getPosition() << "/" << recording.ticks.size() << " ticks, checksum " 
+                  << std::hex << world.checksum() << std::dec << (matched ? " (match)" : " (DIVERGED)") << std::endl;
+        return matched ? 0 : 2;
     }
     
     return 0;
-}
\ No newline at end of file
+}
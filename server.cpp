@@ -0,0 +1,88 @@
+#include <SFML/Network.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "World/World.h"
+#include "Level/LevelFile.h"
+#include "Net/GameServer.h"
+#include "Net/Transport.h"
+
+// Dedicated server: runs GameServer on a UDP port at the simulation's tick
+// rate with no window, textures or audio. Clients must load the same level.
+// Every 5 seconds it prints the connected clients, the bytes sent per client
+// per second over that interval, and the tick cost.
+//
+// Usage: server [level.lvl] [--port N] [--seconds S]   (default: built-in level, port 40000, run until killed)
+
+
+int main(int argc, char* argv[])
+{
+    std::string levelPath;
+    unsigned short port = 40000;
+    double runSeconds = 0.0;
+    for (int i = 1; i < argc; i++) 
+    {
+        std::string arg = argv[i];
+        if (arg == "--port" && i + 1 < argc) 
+        {
+            port = static_cast<unsigned short>(std::strtoul(argv[++i], nullptr, 10));
+        }
+        else if (arg == "--seconds" && i + 1 < argc) 
+        {
+            runSeconds = std::atof(argv[++i]);
+        }
+        else 
+        {
+            levelPath = arg;
+        }
+    }
+    
+    World world(100, 400);
+    LevelFile level;
+    if (!levelPath.empty()) 
+    {
+        if (!level.open(levelPath)) 
+        {
+            return 1;
+        }
+        world.loadLevel(level);
+    }
+    
+    UdpTransport socket;
+    if (!socket.bind(port)) 
+    {
+        return 1;
+    }
+    GameServer server(world, socket);
+    std::cout << "Serving on UDP port " << socket.getLocalPort() << std::endl;
+    
+    using Clock = std::chrono::steady_clock;
+    const auto tickLength = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(World::TIMESTEP));
+    const unsigned long long reportTicks = static_cast<unsigned long long>(5.0 / World::TIMESTEP);
+    const unsigned long long runTicks = static_cast<unsigned long long>(runSeconds / World::TIMESTEP);
+    
+    auto nextTick = Clock::now();
+    NetServerStats lastReport = server.getStats();
+    for (unsigned long long tick = 1; runTicks == 0 || tick <= runTicks; tick++) 
+    {
+        server.tick();
+        
+        if (tick % reportTicks == 0) 
+        {
+            const NetServerStats& stats = server.getStats();
+            double bytesPerClient = stats.clients > 0 ? (stats.bytesSent - lastReport.bytesSent) / (stats.clients * 5.0) : 0.0;
+            std::cout << "clients: " << stats.clients
+                      << "  sent: " << static_cast<unsigned long long>(bytesPerClient) << " B/s per client"
+                      << "  tick: " << stats.averageTickMs << " ms avg, " << stats.maxTickMs << " ms max" << std::endl;
+            lastReport = stats;
+        }
+        
+        // Fixed rate; if we fall behind, run the late ticks back to back
+        nextTick += tickLength;
+        std::this_thread::sleep_until(nextTick);
+    }
+    
+    return 0;
+}